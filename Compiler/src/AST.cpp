@@ -29,3 +29,70 @@ std::string IndexAccessNode::toString() const
     }
     return "الوصول للمصفوفة: " + varName + "[فهرس]";
 }
+
+// المرور على كل عقد شجرة الاشتقاق تحت عقدة معينة
+void walkAST(ASTNode *node, const std::function<void(ASTNode *)> &visit)
+{
+    if (!node)
+        return;
+    visit(node);
+
+    auto walkList = [&visit](const std::vector<std::unique_ptr<ASTNode>> &list)
+    {
+        for (const auto &child : list)
+            walkAST(child.get(), visit);
+    };
+
+    if (auto n = dynamic_cast<VariableDeclarationNode *>(node))
+        walkAST(n->initialValue.get(), visit);
+    else if (auto n = dynamic_cast<ConstantDeclarationNode *>(node))
+        walkAST(n->value.get(), visit);
+    else if (auto n = dynamic_cast<AssignmentNode *>(node))
+    {
+        walkAST(n->left.get(), visit);
+        walkAST(n->value.get(), visit);
+    }
+    else if (auto n = dynamic_cast<PrintNode *>(node))
+        walkAST(n->expression.get(), visit);
+    else if (auto n = dynamic_cast<IfNode *>(node))
+    {
+        walkAST(n->condition.get(), visit);
+        walkList(n->thenBranch);
+        walkList(n->elseBranch);
+    }
+    else if (auto n = dynamic_cast<WhileNode *>(node))
+    {
+        walkAST(n->condition.get(), visit);
+        walkList(n->body);
+    }
+    else if (auto n = dynamic_cast<RepeatNode *>(node))
+    {
+        walkList(n->body);
+        walkAST(n->condition.get(), visit);
+    }
+    else if (auto n = dynamic_cast<ForNode *>(node))
+    {
+        walkAST(n->startValue.get(), visit);
+        walkAST(n->endValue.get(), visit);
+        walkAST(n->stepValue.get(), visit);
+        walkList(n->body);
+    }
+    else if (auto n = dynamic_cast<BinaryOpNode *>(node))
+    {
+        walkAST(n->left.get(), visit);
+        walkAST(n->right.get(), visit);
+    }
+    else if (auto n = dynamic_cast<UnaryOpNode *>(node))
+        walkAST(n->operand.get(), visit);
+    else if (auto n = dynamic_cast<IndexAccessNode *>(node))
+    {
+        walkAST(n->variable.get(), visit);
+        walkAST(n->index.get(), visit);
+    }
+    else if (auto n = dynamic_cast<FieldAccessNode *>(node))
+        walkAST(n->record.get(), visit);
+    else if (auto n = dynamic_cast<ProcedureCallNode *>(node))
+        walkList(n->arguments);
+    else if (auto n = dynamic_cast<ReturnNode *>(node))
+        walkAST(n->value.get(), visit);
+}
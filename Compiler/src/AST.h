@@ -5,7 +5,9 @@
 #include <memory>
 #include <vector>
 #include <iostream>
+#include <functional>
 #include "Lexer.h"
+#include "Console.h"
 
 // Forward declarations to resolve circular dependencies
 struct VariableNode;
@@ -595,6 +597,9 @@ struct RecordTypeNode : public TypeNode
     std::string getTypeName() const override { return "RecordTypeNode"; }
 };
 
+// المرور على كل عقد شجرة الاشتقاق تحت عقدة معينة (دون أجسام الإجراءات المعرفة)
+void walkAST(ASTNode *node, const std::function<void(ASTNode *)> &visit);
+
 // دالة مساعدة لعرض AST
 class ASTPrinter
 {
@@ -604,9 +609,9 @@ public:
         if (!node)
             return;
 
-        std::cout << prefix;
-        std::cout << (isLast ? "└── " : "├── ");
-        std::cout << node->toString() << " [" << node->getTypeName() << "]" << std::endl;
+        consoleOutput() << prefix;
+        consoleOutput() << (isLast ? "└── " : "├── ");
+        consoleOutput() << node->toString() << " [" << node->getTypeName() << "]" << std::endl;
 
         // حساب البادئة للأبناء
         std::string newPrefix = prefix + (isLast ? "    " : "│   ");
@@ -633,7 +638,7 @@ public:
             // عرض فرع then
             if (!ifStmt->thenBranch.empty())
             {
-                std::cout << newPrefix << "├── then:" << std::endl;
+                consoleOutput() << newPrefix << "├── then:" << std::endl;
                 for (size_t i = 0; i < ifStmt->thenBranch.size(); i++)
                 {
                     bool lastThen = (i == ifStmt->thenBranch.size() - 1) && ifStmt->elseBranch.empty();
@@ -643,7 +648,7 @@ public:
             // عرض فرع else إن وجد
             if (!ifStmt->elseBranch.empty())
             {
-                std::cout << newPrefix << "├── else:" << std::endl;
+                consoleOutput() << newPrefix << "├── else:" << std::endl;
                 for (size_t i = 0; i < ifStmt->elseBranch.size(); i++)
                 {
                     bool lastElse = (i == ifStmt->elseBranch.size() - 1);
@@ -657,7 +662,7 @@ public:
             // عرض جسم الحلقة
             if (!whileStmt->body.empty())
             {
-                std::cout << newPrefix << "└── body:" << std::endl;
+                consoleOutput() << newPrefix << "└── body:" << std::endl;
                 for (size_t i = 0; i < whileStmt->body.size(); i++)
                 {
                     bool lastBody = (i == whileStmt->body.size() - 1);
@@ -670,7 +675,7 @@ public:
             // عرض جسم الحلقة
             if (!repeatStmt->body.empty())
             {
-                std::cout << newPrefix << "├── body:" << std::endl;
+                consoleOutput() << newPrefix << "├── body:" << std::endl;
                 for (size_t i = 0; i < repeatStmt->body.size(); i++)
                 {
                     bool lastBody = (i == repeatStmt->body.size() - 1);
@@ -681,7 +686,7 @@ public:
         }
         else if (auto forStmt = dynamic_cast<ForNode *>(node.get()))
         {
-            std::cout << newPrefix << "├── iterator: " << forStmt->iteratorName << std::endl;
+            consoleOutput() << newPrefix << "├── iterator: " << forStmt->iteratorName << std::endl;
             print(forStmt->startValue, newPrefix, false);
             print(forStmt->endValue, newPrefix, false);
             if (forStmt->stepValue)
@@ -691,7 +696,7 @@ public:
             // Print body
             if (!forStmt->body.empty())
             {
-                std::cout << newPrefix << "└── body:" << std::endl;
+                consoleOutput() << newPrefix << "└── body:" << std::endl;
                 for (size_t i = 0; i < forStmt->body.size(); i++)
                 {
                     bool lastBody = (i == forStmt->body.size() - 1);
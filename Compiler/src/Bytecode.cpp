@@ -0,0 +1,432 @@
+#include "Bytecode.h"
+#include "CFG.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+
+namespace
+{
+    // خانات إضافية في كل إطار لقراءة المعاملات بالمرجع وكتابتها
+    const int32_t scratchSlots = 3;
+
+    int64_t constantValue(const std::string &operand)
+    {
+        if (operand == "صح")
+            return 1;
+        if (operand == "خطأ")
+            return 0;
+        if (operand.find('.') != std::string::npos)
+            return static_cast<int64_t>(std::stod(operand));
+        return std::stoll(operand);
+    }
+}
+
+BytecodeCompiler::BytecodeCompiler(const std::vector<Instruction> &code,
+                                   const std::vector<const ProcedureFrame *> &owner,
+                                   const std::unordered_map<std::string, ProcedureFrame> &frames,
+                                   const std::unordered_map<std::string, std::string> &symbolTable,
+                                   const std::vector<std::string> &stringLiterals)
+    : code(code), owner(owner), frames(frames), symbolTable(symbolTable), stringLiterals(stringLiterals),
+      frame(nullptr)
+{
+}
+
+int32_t BytecodeCompiler::slotCount(const std::string &meta)
+{
+    // array:<elem>:<len> يشغل خانة لكل عنصر متتالية
+    if (meta.rfind("array:", 0) == 0)
+    {
+        size_t colon = meta.rfind(':');
+        if (colon != std::string::npos && colon > strlen("array:"))
+            return std::max(1, std::atoi(meta.c_str() + colon + 1));
+    }
+    return 1;
+}
+
+int32_t BytecodeCompiler::allocateGlobal(const std::string &name, int32_t count)
+{
+    auto it = globalSlots.find(name);
+    if (it != globalSlots.end())
+        return it->second;
+    int32_t slot = static_cast<int32_t>(program.globals.size());
+    program.globals.resize(program.globals.size() + count, 0);
+    globalSlots[name] = slot;
+    return slot;
+}
+
+void BytecodeCompiler::layout()
+{
+    // الأسماء العامة: جدول الرموز ثم ما يلمسه البرنامج الرئيسي أو تلمسه
+    // الإجراءات دون أن تملكه، بترتيب ثابت
+    std::set<std::string> globalNames;
+    for (const auto &symbol : symbolTable)
+    {
+        globalNames.insert(symbol.first);
+    }
+    std::unordered_map<const ProcedureFrame *, std::set<std::string>> frameTemps;
+    std::unordered_map<const ProcedureFrame *, std::set<std::string>> frameFields; // حقول السجلات المحلية
+    std::vector<std::string> names;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        names.clear();
+        getUsedNames(code[i], names);
+        names.push_back(getDefinedName(code[i]));
+        for (const auto &name : names)
+        {
+            if (name.empty())
+                continue;
+            if (owner[i] && isTempName(name))
+                frameTemps[owner[i]].insert(name);
+            else if (owner[i] && !owner[i]->owns(name) && owner[i]->owns(name.substr(0, name.find('.'))))
+                frameFields[owner[i]].insert(name);
+            else if (!owner[i] || !owner[i]->owns(name))
+                globalNames.insert(name);
+        }
+    }
+    for (const auto &name : globalNames)
+    {
+        auto meta = symbolTable.find(name);
+        allocateGlobal(name, slotCount(meta == symbolTable.end() ? "" : meta->second));
+    }
+
+    // إطار كل إجراء: المعاملات أولاً بالترتيب، ثم المحليات وحقول سجلاتها والمؤقتات،
+    // ثم خانات مساعدة. الإطار كله يُصفّر عند الاستدعاء
+    for (const auto &entry : frames)
+    {
+        const ProcedureFrame *procedure = &entry.second;
+        auto &slots = frameSlots[procedure];
+        int32_t size = 0;
+        for (const auto &param : procedure->parameters)
+        {
+            slots[param] = size++;
+        }
+        for (const auto &local : procedure->locals)
+        {
+            if (slots.count(local))
+                continue;
+            slots[local] = size;
+            size += slotCount(procedure->symbols.at(local));
+        }
+        for (const auto &field : frameFields[procedure])
+        {
+            slots[field] = size++;
+        }
+        for (const auto &temp : frameTemps[procedure])
+        {
+            slots[temp] = size++;
+        }
+        frameSizes[procedure] = size + scratchSlots;
+    }
+
+    int32_t index = 0;
+    for (const auto &instr : code)
+    {
+        if (instr.type != InstructionType::FUNC || !frames.count(instr.operand1))
+            continue;
+        const ProcedureFrame *procedure = &frames.at(instr.operand1);
+        procedureIndex[instr.operand1] = index++;
+        program.procedures.push_back({0, frameSizes[procedure], static_cast<int32_t>(procedure->parameters.size())});
+    }
+}
+
+std::string BytecodeCompiler::metaOf(const std::string &name) const
+{
+    if (frame && frame->owns(name))
+        return frame->symbols.at(name);
+    auto it = symbolTable.find(name);
+    return it == symbolTable.end() ? "" : it->second;
+}
+
+bool BytecodeCompiler::isReference(const std::string &name) const
+{
+    return frame && frame->byReference.count(name) != 0;
+}
+
+int32_t BytecodeCompiler::constant(int64_t value)
+{
+    std::string key = "#" + std::to_string(value);
+    auto it = constantSlots.find(key);
+    if (it != constantSlots.end())
+        return it->second;
+    int32_t slot = static_cast<int32_t>(program.globals.size());
+    program.globals.push_back(value);
+    constantSlots[key] = slot;
+    return slot;
+}
+
+int32_t BytecodeCompiler::operand(const std::string &name)
+{
+    int32_t slot;
+    if (name.rfind("str_", 0) == 0)
+    {
+        auto it = constantSlots.find(name);
+        if (it == constantSlots.end())
+        {
+            slot = static_cast<int32_t>(program.globals.size());
+            program.globals.push_back(0);
+            program.stringSlots.push_back({slot, std::stoi(name.substr(4))});
+            it = constantSlots.emplace(name, slot).first;
+        }
+        slot = it->second;
+    }
+    else if (isConstantOperand(name))
+        slot = constant(constantValue(name));
+    else if (frame && frameSlots[frame].count(name))
+        return frameSlots[frame].at(name);
+    else
+        slot = allocateGlobal(name, 1);
+
+    // إطار البرنامج الرئيسي هو المنطقة العامة، فالرقم نفسه صالح نسبياً
+    return frame ? ~slot : slot;
+}
+
+int32_t BytecodeCompiler::scratch(int k) const
+{
+    return frameSizes.at(frame) - scratchSlots + k;
+}
+
+void BytecodeCompiler::emit(Bytecode op, std::initializer_list<int32_t> operands)
+{
+    program.code.push_back(static_cast<int32_t>(op));
+    program.code.insert(program.code.end(), operands.begin(), operands.end());
+}
+
+void BytecodeCompiler::emitJump(Bytecode op, std::initializer_list<int32_t> operands, const std::string &label)
+{
+    emit(op, operands);
+    jumps.push_back({program.code.size(), label});
+    program.code.push_back(0);
+}
+
+void BytecodeCompiler::lower(const Instruction &instr, std::string &lastCmpLeft, std::string &lastCmpRight)
+{
+    // المعامل بالمرجع يحمل العنوان المطلق لخانة المستدعي: يُقرأ إلى خانة
+    // مساعدة قبل العملية، ويُكتب الناتج عبره بعدها
+    auto read = [&](const std::string &name, int k)
+    {
+        if (!isReference(name))
+            return operand(name);
+        emit(Bytecode::LOADREF, {scratch(k), operand(name)});
+        return scratch(k);
+    };
+    auto target = [&](const std::string &name)
+    {
+        return isReference(name) ? scratch(2) : operand(name);
+    };
+    auto writeBack = [&](const std::string &name)
+    {
+        if (isReference(name))
+            emit(Bytecode::STOREREF, {operand(name), scratch(2)});
+    };
+    auto binary = [&](Bytecode op)
+    {
+        const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+        const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+        int32_t a = read(left, 0);
+        int32_t b = read(right, 1);
+        emit(op, {target(instr.operand1), a, b});
+        writeBack(instr.operand1);
+    };
+    auto immediate = [&](Bytecode op)
+    {
+        int32_t a = read(instr.operand2, 0);
+        emit(op, {target(instr.operand1), a, static_cast<int32_t>(constantValue(instr.operand3))});
+        writeBack(instr.operand1);
+    };
+    auto branch = [&](Bytecode op)
+    {
+        int32_t a = read(lastCmpLeft, 0);
+        int32_t b = read(lastCmpRight, 1);
+        emitJump(op, {a, b}, instr.operand1);
+    };
+
+    switch (instr.type)
+    {
+    case InstructionType::LOAD:
+    case InstructionType::STORE:
+        if (isReference(instr.operand2) && !isReference(instr.operand1))
+            emit(Bytecode::LOADREF, {operand(instr.operand1), operand(instr.operand2)});
+        else if (isReference(instr.operand1))
+            emit(Bytecode::STOREREF, {operand(instr.operand1), read(instr.operand2, 0)});
+        else
+            emit(Bytecode::MOVE, {operand(instr.operand1), operand(instr.operand2)});
+        break;
+
+    case InstructionType::ADD:
+        binary(Bytecode::ADD);
+        break;
+    case InstructionType::SUB:
+        binary(Bytecode::SUB);
+        break;
+    case InstructionType::MUL:
+        binary(Bytecode::MUL);
+        break;
+    case InstructionType::DIV:
+        binary(Bytecode::DIV);
+        break;
+    case InstructionType::MOD:
+        binary(Bytecode::MOD);
+        break;
+    case InstructionType::AND:
+        binary(Bytecode::AND);
+        break;
+    case InstructionType::OR:
+        binary(Bytecode::OR);
+        break;
+    case InstructionType::MULHI:
+        binary(Bytecode::MULHI);
+        break;
+    case InstructionType::SHL:
+        immediate(Bytecode::SHL);
+        break;
+    case InstructionType::SHR:
+        immediate(Bytecode::SHR);
+        break;
+    case InstructionType::SAR:
+        immediate(Bytecode::SAR);
+        break;
+    case InstructionType::BITAND:
+        immediate(Bytecode::BITAND);
+        break;
+
+    case InstructionType::LOAD_INDEXED:
+    {
+        int32_t index = read(instr.operand3, 1);
+        emit(Bytecode::LOADX, {target(instr.operand1), operand(instr.operand2), index});
+        writeBack(instr.operand1);
+        break;
+    }
+
+    case InstructionType::STORE_INDEXED:
+    {
+        int32_t index = read(instr.operand2, 0);
+        int32_t value = read(instr.operand3, 1);
+        emit(Bytecode::STOREX, {operand(instr.operand1), index, value});
+        break;
+    }
+
+    case InstructionType::BOUNDS:
+        emit(Bytecode::BOUNDS, {read(instr.operand1, 0), static_cast<int32_t>(constantValue(instr.operand2))});
+        break;
+
+    case InstructionType::CMP:
+        // المقارنة تُنفذ مع القفزة الشرطية التالية
+        lastCmpLeft = instr.operand1;
+        lastCmpRight = instr.operand2;
+        break;
+
+    case InstructionType::JE:
+        branch(Bytecode::JE);
+        break;
+    case InstructionType::JNE:
+        branch(Bytecode::JNE);
+        break;
+    case InstructionType::JG:
+        branch(Bytecode::JG);
+        break;
+    case InstructionType::JL:
+        branch(Bytecode::JL);
+        break;
+    case InstructionType::JGE:
+        branch(Bytecode::JGE);
+        break;
+    case InstructionType::JLE:
+        branch(Bytecode::JLE);
+        break;
+
+    case InstructionType::JZ:
+        emitJump(Bytecode::JZ, {read(instr.operand1, 0)}, instr.operand2);
+        break;
+    case InstructionType::JNZ:
+        emitJump(Bytecode::JNZ, {read(instr.operand1, 0)}, instr.operand2);
+        break;
+    case InstructionType::JMP:
+        emitJump(Bytecode::JMP, {}, instr.operand1);
+        break;
+
+    case InstructionType::LABEL:
+        labels[instr.operand1] = static_cast<int32_t>(program.code.size());
+        break;
+
+    case InstructionType::PRINT:
+        if (instr.operand1 == "STRING")
+            emit(Bytecode::PRINTS, {operand(instr.operand2)});
+        else if (instr.operand1 == "VARIABLE" && metaOf(instr.operand2) == "primitive:char*")
+            emit(Bytecode::PRINTS, {read(instr.operand2, 0)});
+        else
+            emit(Bytecode::PRINTI, {read(instr.operand2, 0)});
+        break;
+
+    case InstructionType::READ:
+        // scanf الفاشلة تترك القيمة السابقة كما في كود C
+        emit(Bytecode::READ, {read(instr.operand1, 2)});
+        writeBack(instr.operand1);
+        break;
+
+    case InstructionType::ARG:
+    {
+        int32_t k = std::stoi(instr.operand1);
+        program.maxArguments = std::max(program.maxArguments, k + 1);
+        if (!isReferenceArgument(instr))
+            emit(Bytecode::ARG, {k, read(instr.operand2, 0)});
+        else if (isElementReference(instr))
+            emit(Bytecode::ARGELEM, {k, operand(instr.operand2), read(instr.operand3, 0)});
+        else if (isReference(instr.operand2))
+            emit(Bytecode::ARG, {k, operand(instr.operand2)}); // العنوان الذي يحمله يمر كما هو
+        else
+            emit(Bytecode::ARGADDR, {k, operand(instr.operand2)});
+        break;
+    }
+
+    case InstructionType::CALL:
+    {
+        auto it = procedureIndex.find(instr.operand1);
+        if (it != procedureIndex.end())
+            emit(Bytecode::CALL, {it->second, instr.operand3 == "tail" && frame ? 1 : 0});
+        break;
+    }
+
+    case InstructionType::FUNC:
+        program.procedures[procedureIndex.at(instr.operand1)].entry = static_cast<int32_t>(program.code.size());
+        break;
+
+    case InstructionType::RET:
+        emit(Bytecode::RET);
+        break;
+
+    case InstructionType::HALT:
+        emit(Bytecode::HALT);
+        break;
+    }
+}
+
+BytecodeProgram BytecodeCompiler::compile()
+{
+    layout();
+
+    std::string lastCmpLeft;
+    std::string lastCmpRight;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        frame = owner[i];
+        lower(code[i], lastCmpLeft, lastCmpRight);
+
+        // نهاية جسم الإجراء تعود إلى المستدعي كما في خاتمة الإطار
+        if (frame && (i + 1 == code.size() || owner[i + 1] != frame))
+            emit(Bytecode::RET);
+    }
+    frame = nullptr;
+    emit(Bytecode::HALT);
+
+    for (const auto &jump : jumps)
+    {
+        auto it = labels.find(jump.second);
+        if (it == labels.end())
+            throw std::runtime_error("تسمية غير معرفة في الكود الوسيط: " + jump.second);
+        program.code[jump.first] = it->second;
+    }
+    program.strings = stringLiterals;
+    return program;
+}
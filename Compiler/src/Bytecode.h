@@ -0,0 +1,120 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include "Instruction.h"
+#include "ProcedureFrame.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ترميز مضغوط للكود الوسيط تنفذه BytecodeVM (--interpret). كل تعليمة كلمة
+// للعملية تليها معاملاتها، والمعامل رقم سجل: الموجب نسبي لإطار الإجراء
+// الجاري، والسالب (~رقم) خانة عامة. البرنامج الرئيسي إطاره المنطقة العامة نفسها
+#define BYTECODE_OPS(X)                                                    \
+    X(MOVE)    /* d, s */                                                  \
+    X(ADD)     /* d, a, b */                                               \
+    X(SUB)                                                                 \
+    X(MUL)                                                                 \
+    X(DIV)                                                                 \
+    X(MOD)                                                                 \
+    X(AND)     /* d, a, b: منطقي */                                        \
+    X(OR)                                                                  \
+    X(SHL)     /* d, a, #k */                                              \
+    X(SHR)                                                                 \
+    X(SAR)                                                                 \
+    X(BITAND)  /* d, a, #mask */                                           \
+    X(MULHI)   /* d, a, b */                                               \
+    X(LOADREF) /* d, r: d = خانة العنوان المطلق في r */                    \
+    X(STOREREF) /* r, s */                                                 \
+    X(LOADX)   /* d, arr, i */                                             \
+    X(STOREX)  /* arr, i, s */                                             \
+    X(BOUNDS)  /* i, #len */                                               \
+    X(JMP)     /* #pc */                                                   \
+    X(JZ)      /* a, #pc */                                                \
+    X(JNZ)                                                                 \
+    X(JE)      /* a, b, #pc */                                             \
+    X(JNE)                                                                 \
+    X(JG)                                                                  \
+    X(JL)                                                                  \
+    X(JGE)                                                                 \
+    X(JLE)                                                                 \
+    X(PRINTI)  /* s */                                                     \
+    X(PRINTS)  /* s: عنوان سلسلة */                                        \
+    X(READ)    /* d */                                                     \
+    X(ARG)     /* #k, s */                                                 \
+    X(ARGADDR) /* #k, x: العنوان المطلق لخانة x */                         \
+    X(ARGELEM) /* #k, arr, i: العنوان المطلق للعنصر arr[i] */              \
+    X(CALL)    /* #procedure, #tail */                                     \
+    X(RET)                                                                 \
+    X(HALT)
+
+enum class Bytecode : int32_t
+{
+#define BYTECODE_ENUM(name) name,
+    BYTECODE_OPS(BYTECODE_ENUM)
+#undef BYTECODE_ENUM
+};
+
+struct BytecodeProcedure
+{
+    int32_t entry;      // موضع أول تعليمة
+    int32_t frameSize;  // عدد خانات الإطار
+    int32_t parameters; // المعاملات في أول خانات الإطار
+};
+
+struct BytecodeProgram
+{
+    std::vector<int32_t> code;
+    std::vector<int64_t> globals;        // القيم الأولى للخانات العامة: صفر للمتغيرات، والثوابت بقيمها
+    std::vector<std::string> strings;    // نصوص str_N؛ الخانات تحمل عناوينها بعد التحميل
+    std::vector<std::pair<int32_t, int32_t>> stringSlots; // (خانة عامة، رقم النص)
+    std::vector<BytecodeProcedure> procedures;
+    int32_t maxArguments = 0;
+};
+
+// يحول الكود الوسيط بعد التحسين إلى BytecodeProgram
+class BytecodeCompiler
+{
+private:
+    const std::vector<Instruction> &code;
+    const std::vector<const ProcedureFrame *> &owner;
+    const std::unordered_map<std::string, ProcedureFrame> &frames;
+    const std::unordered_map<std::string, std::string> &symbolTable;
+    const std::vector<std::string> &stringLiterals;
+
+    BytecodeProgram program;
+    std::unordered_map<std::string, int32_t> globalSlots;
+    std::unordered_map<std::string, int32_t> constantSlots;
+    std::unordered_map<const ProcedureFrame *, std::unordered_map<std::string, int32_t>> frameSlots;
+    std::unordered_map<const ProcedureFrame *, int32_t> frameSizes;
+    std::unordered_map<std::string, int32_t> procedureIndex;
+    std::unordered_map<std::string, int32_t> labels;
+    std::vector<std::pair<size_t, std::string>> jumps; // موضع الهدف في الكود -> التسمية
+
+    const ProcedureFrame *frame; // إجراء التعليمة الجارية
+
+    static int32_t slotCount(const std::string &meta);
+    int32_t allocateGlobal(const std::string &name, int32_t count);
+    void layout();
+
+    std::string metaOf(const std::string &name) const;
+    bool isReference(const std::string &name) const;
+    int32_t operand(const std::string &name);
+    int32_t constant(int64_t value);
+    int32_t scratch(int k) const;
+
+    void emit(Bytecode op, std::initializer_list<int32_t> operands = {});
+    void emitJump(Bytecode op, std::initializer_list<int32_t> operands, const std::string &label);
+    void lower(const Instruction &instr, std::string &lastCmpLeft, std::string &lastCmpRight);
+
+public:
+    BytecodeCompiler(const std::vector<Instruction> &code, const std::vector<const ProcedureFrame *> &owner,
+                     const std::unordered_map<std::string, ProcedureFrame> &frames,
+                     const std::unordered_map<std::string, std::string> &symbolTable,
+                     const std::vector<std::string> &stringLiterals);
+
+    BytecodeProgram compile();
+};
+
+#endif
@@ -0,0 +1,302 @@
+#include "BytecodeVM.h"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BYTECODE_THREADED 1
+#endif
+
+namespace
+{
+    // حد عمق الإطارات بالخانات (512 ميغابايت) بدل انهيار العملية
+    const size_t stackLimit = size_t(64) << 20;
+
+    struct CallRecord
+    {
+        int32_t returnPc;
+        size_t base;
+        size_t top;
+    };
+}
+
+BytecodeVM::BytecodeVM(const BytecodeProgram &program) : program(program)
+{
+}
+
+int BytecodeVM::run()
+{
+    std::vector<int64_t> stack(std::max<size_t>(program.globals.size() * 2, 1 << 16), 0);
+    std::copy(program.globals.begin(), program.globals.end(), stack.begin());
+    for (const auto &slot : program.stringSlots)
+    {
+        stack[slot.first] = reinterpret_cast<intptr_t>(program.strings.at(slot.second).c_str());
+    }
+
+    std::vector<CallRecord> calls;
+    std::vector<int64_t> args(std::max(program.maxArguments, 1), 0);
+    int64_t *globals = stack.data();
+    int64_t *fp = globals;
+    size_t base = 0;
+    size_t top = program.globals.size();
+    const int32_t *code = program.code.data();
+    const int32_t *pc = code;
+
+// رقم السجل الموجب من الإطار الجاري، والسالب خانة عامة
+#define R(x) (*((x) >= 0 ? fp + (x) : globals + ~(x)))
+#define I(x) static_cast<int32_t>(R(x))
+#define WRAP(expr) static_cast<int64_t>(static_cast<int32_t>(static_cast<uint32_t>(expr)))
+
+#ifdef BYTECODE_THREADED
+    static const void *const dispatch[] = {
+#define BYTECODE_LABEL(name) &&op_##name,
+        BYTECODE_OPS(BYTECODE_LABEL)
+#undef BYTECODE_LABEL
+    };
+#define CASE(name) op_##name:
+#define NEXT() goto *dispatch[*pc]
+    NEXT();
+#else
+#define CASE(name) case Bytecode::name:
+#define NEXT() continue
+    for (;;)
+        switch (static_cast<Bytecode>(*pc))
+        {
+#endif
+
+    CASE(MOVE)
+    R(pc[1]) = R(pc[2]);
+    pc += 3;
+    NEXT();
+
+    CASE(ADD)
+    R(pc[1]) = WRAP(static_cast<uint32_t>(I(pc[2])) + static_cast<uint32_t>(I(pc[3])));
+    pc += 4;
+    NEXT();
+
+    CASE(SUB)
+    R(pc[1]) = WRAP(static_cast<uint32_t>(I(pc[2])) - static_cast<uint32_t>(I(pc[3])));
+    pc += 4;
+    NEXT();
+
+    CASE(MUL)
+    R(pc[1]) = WRAP(static_cast<uint32_t>(I(pc[2])) * static_cast<uint32_t>(I(pc[3])));
+    pc += 4;
+    NEXT();
+
+    CASE(DIV)
+    {
+        int64_t b = I(pc[3]);
+        if (b == 0)
+            throw std::runtime_error("خطأ وقت التنفيذ: قسمة على صفر");
+        R(pc[1]) = WRAP(I(pc[2]) / b); // INT_MIN / -1 يُحسب بعرض 64 ثم يُلف
+        pc += 4;
+        NEXT();
+    }
+
+    CASE(MOD)
+    {
+        int64_t b = I(pc[3]);
+        if (b == 0)
+            throw std::runtime_error("خطأ وقت التنفيذ: قسمة على صفر");
+        R(pc[1]) = WRAP(I(pc[2]) % b);
+        pc += 4;
+        NEXT();
+    }
+
+    CASE(AND)
+    R(pc[1]) = (I(pc[2]) != 0 && I(pc[3]) != 0) ? 1 : 0;
+    pc += 4;
+    NEXT();
+
+    CASE(OR)
+    R(pc[1]) = (I(pc[2]) != 0 || I(pc[3]) != 0) ? 1 : 0;
+    pc += 4;
+    NEXT();
+
+    CASE(SHL)
+    R(pc[1]) = WRAP(static_cast<uint32_t>(I(pc[2])) << pc[3]);
+    pc += 4;
+    NEXT();
+
+    CASE(SHR)
+    R(pc[1]) = WRAP(static_cast<uint32_t>(I(pc[2])) >> pc[3]);
+    pc += 4;
+    NEXT();
+
+    CASE(SAR)
+    R(pc[1]) = I(pc[2]) >> pc[3];
+    pc += 4;
+    NEXT();
+
+    CASE(BITAND)
+    R(pc[1]) = I(pc[2]) & pc[3];
+    pc += 4;
+    NEXT();
+
+    CASE(MULHI)
+    // الثابت السحري بعرضه الكامل في خانته، كما في (long long)x * M في C
+    R(pc[1]) = WRAP((static_cast<int64_t>(I(pc[2])) * R(pc[3])) >> 32);
+    pc += 4;
+    NEXT();
+
+    CASE(LOADREF)
+    R(pc[1]) = globals[R(pc[2])];
+    pc += 3;
+    NEXT();
+
+    CASE(STOREREF)
+    globals[R(pc[1])] = R(pc[2]);
+    pc += 3;
+    NEXT();
+
+    CASE(LOADX)
+    R(pc[1]) = (&R(pc[2]))[I(pc[3])];
+    pc += 4;
+    NEXT();
+
+    CASE(STOREX)
+    (&R(pc[1]))[I(pc[2])] = R(pc[3]);
+    pc += 4;
+    NEXT();
+
+    CASE(BOUNDS)
+    if (static_cast<uint32_t>(I(pc[1])) >= static_cast<uint32_t>(pc[2]))
+    {
+        std::fflush(stdout);
+        std::fprintf(stderr, "خطأ وقت التنفيذ: فهرس خارج حدود القائمة\n");
+        return 1;
+    }
+    pc += 3;
+    NEXT();
+
+    CASE(JMP)
+    pc = code + pc[1];
+    NEXT();
+
+    CASE(JZ)
+    pc = I(pc[1]) == 0 ? code + pc[2] : pc + 3;
+    NEXT();
+
+    CASE(JNZ)
+    pc = I(pc[1]) != 0 ? code + pc[2] : pc + 3;
+    NEXT();
+
+    CASE(JE)
+    pc = I(pc[1]) == I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(JNE)
+    pc = I(pc[1]) != I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(JG)
+    pc = I(pc[1]) > I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(JL)
+    pc = I(pc[1]) < I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(JGE)
+    pc = I(pc[1]) >= I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(JLE)
+    pc = I(pc[1]) <= I(pc[2]) ? code + pc[3] : pc + 4;
+    NEXT();
+
+    CASE(PRINTI)
+    std::printf("%d\n", I(pc[1]));
+    pc += 2;
+    NEXT();
+
+    CASE(PRINTS)
+    std::printf("%s\n", reinterpret_cast<const char *>(static_cast<intptr_t>(R(pc[1]))));
+    pc += 2;
+    NEXT();
+
+    CASE(READ)
+    {
+        // scanf الفاشلة لا تغير القيمة، كما في كود C
+        int value = I(pc[1]);
+        if (std::scanf("%d", &value) != 1)
+            value = I(pc[1]);
+        R(pc[1]) = value;
+        pc += 2;
+        NEXT();
+    }
+
+    CASE(ARG)
+    args[pc[1]] = R(pc[2]);
+    pc += 3;
+    NEXT();
+
+    CASE(ARGADDR)
+    args[pc[1]] = &R(pc[2]) - globals;
+    pc += 3;
+    NEXT();
+
+    CASE(ARGELEM)
+    args[pc[1]] = &R(pc[2]) + I(pc[3]) - globals;
+    pc += 4;
+    NEXT();
+
+    CASE(CALL)
+    {
+        const BytecodeProcedure &procedure = program.procedures[pc[1]];
+        if (pc[2] && !calls.empty())
+            top = base; // الاستدعاء الذيلي يعيد استخدام إطار المستدعي
+        else
+            calls.push_back({static_cast<int32_t>(pc + 3 - code), base, top});
+
+        size_t frameBase = top;
+        size_t frameTop = frameBase + procedure.frameSize;
+        if (frameTop > stack.size())
+        {
+            if (frameTop > stackLimit)
+                throw std::runtime_error("خطأ وقت التنفيذ: تجاوز عمق الاستدعاءات المسموح");
+            stack.resize(std::min(std::max(frameTop, stack.size() * 2), stackLimit));
+            globals = stack.data();
+        }
+        std::fill(globals + frameBase, globals + frameTop, 0);
+        std::copy(args.begin(), args.begin() + procedure.parameters, globals + frameBase);
+
+        base = frameBase;
+        top = frameTop;
+        fp = globals + base;
+        pc = code + procedure.entry;
+        NEXT();
+    }
+
+    CASE(RET)
+    {
+        if (calls.empty())
+        {
+            std::fflush(stdout);
+            return 0; // RET في البرنامج الرئيسي ينهيه
+        }
+        const CallRecord &caller = calls.back();
+        pc = code + caller.returnPc;
+        base = caller.base;
+        top = caller.top;
+        fp = globals + base;
+        calls.pop_back();
+        NEXT();
+    }
+
+    CASE(HALT)
+    std::fflush(stdout);
+    return 0;
+
+#ifndef BYTECODE_THREADED
+        }
+#endif
+
+#undef CASE
+#undef NEXT
+#undef WRAP
+#undef I
+#undef R
+}
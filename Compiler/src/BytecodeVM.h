@@ -0,0 +1,21 @@
+#ifndef BYTECODE_VM_H
+#define BYTECODE_VM_H
+
+#include "Bytecode.h"
+
+// مفسر قائم على السجلات لـ BytecodeProgram (--interpret). التوزيع مخيط
+// (computed goto) مع GCC وClang، وحلقة switch في غيرهما. الحساب بعرض int
+// كما في كود C المولد، ولا يحتاج مترجم C ولا معالجاً بعينه
+class BytecodeVM
+{
+private:
+    const BytecodeProgram &program;
+
+public:
+    explicit BytecodeVM(const BytecodeProgram &program);
+
+    // يعيد رمز خروج البرنامج
+    int run();
+};
+
+#endif
@@ -0,0 +1,523 @@
+#include "CFG.h"
+#include <algorithm>
+#include <cctype>
+
+bool isTempName(const std::string &name)
+{
+    if (name.size() < 2 || name[0] != 't')
+        return false;
+    for (size_t i = 1; i < name.size(); ++i)
+    {
+        if (!std::isdigit(static_cast<unsigned char>(name[i])))
+            return false;
+    }
+    return true;
+}
+
+bool isNumericOperand(const std::string &operand)
+{
+    size_t i = 0;
+    if (!operand.empty() && (operand[0] == '-' || operand[0] == '+'))
+        i = 1;
+    if (i >= operand.size() || !std::isdigit(static_cast<unsigned char>(operand[i])))
+        return false;
+    bool seenDot = false;
+    for (; i < operand.size(); ++i)
+    {
+        if (operand[i] == '.' && !seenDot)
+            seenDot = true;
+        else if (!std::isdigit(static_cast<unsigned char>(operand[i])))
+            return false;
+    }
+    return true;
+}
+
+bool isConstantOperand(const std::string &operand)
+{
+    if (isNumericOperand(operand))
+        return true;
+    // عناوين السلاسل النصية والقيم المنطقية ثوابت أيضاً
+    if (operand.rfind("str_", 0) == 0)
+        return true;
+    return operand == "صح" || operand == "خطأ";
+}
+
+bool isConditionalJump(InstructionType type)
+{
+    switch (type)
+    {
+    case InstructionType::JZ:
+    case InstructionType::JNZ:
+    case InstructionType::JE:
+    case InstructionType::JNE:
+    case InstructionType::JG:
+    case InstructionType::JL:
+    case InstructionType::JGE:
+    case InstructionType::JLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool isTerminator(InstructionType type)
+{
+    return type == InstructionType::JMP || type == InstructionType::HALT || type == InstructionType::RET;
+}
+
+bool isReferenceArgument(const Instruction &instr)
+{
+    return instr.type == InstructionType::ARG && !instr.operand3.empty();
+}
+
+bool isElementReference(const Instruction &instr)
+{
+    return isReferenceArgument(instr) && instr.operand3 != "ref";
+}
+
+std::string getJumpTarget(const Instruction &instr)
+{
+    switch (instr.type)
+    {
+    case InstructionType::JMP:
+    case InstructionType::JE:
+    case InstructionType::JNE:
+    case InstructionType::JG:
+    case InstructionType::JL:
+    case InstructionType::JGE:
+    case InstructionType::JLE:
+        return instr.operand1;
+    case InstructionType::JZ:
+    case InstructionType::JNZ:
+        return instr.operand2;
+    default:
+        return "";
+    }
+}
+
+std::string getDefinedName(const Instruction &instr)
+{
+    switch (instr.type)
+    {
+    case InstructionType::LOAD:
+    case InstructionType::STORE:
+    case InstructionType::ADD:
+    case InstructionType::SUB:
+    case InstructionType::MUL:
+    case InstructionType::DIV:
+    case InstructionType::MOD:
+    case InstructionType::AND:
+    case InstructionType::OR:
+    case InstructionType::LOAD_INDEXED:
+    case InstructionType::READ:
+    case InstructionType::SHL:
+    case InstructionType::SHR:
+    case InstructionType::SAR:
+    case InstructionType::BITAND:
+    case InstructionType::MULHI:
+        return instr.operand1;
+    default:
+        return "";
+    }
+}
+
+void getUsedNames(const Instruction &instr, std::vector<std::string> &uses)
+{
+    auto use = [&uses](const std::string &name)
+    {
+        if (!name.empty() && !isConstantOperand(name))
+            uses.push_back(name);
+    };
+
+    switch (instr.type)
+    {
+    case InstructionType::LOAD:
+    case InstructionType::STORE:
+        use(instr.operand2);
+        break;
+    case InstructionType::ADD:
+    case InstructionType::SUB:
+    case InstructionType::MUL:
+    case InstructionType::DIV:
+    case InstructionType::MOD:
+    case InstructionType::AND:
+    case InstructionType::OR:
+        if (instr.operand3.empty())
+        {
+            // الصيغة الثنائية: op1 = op1 (عملية) op2
+            use(instr.operand1);
+            use(instr.operand2);
+        }
+        else
+        {
+            use(instr.operand2);
+            use(instr.operand3);
+        }
+        break;
+    case InstructionType::JZ:
+    case InstructionType::JNZ:
+    case InstructionType::RET:
+        use(instr.operand1);
+        break;
+    case InstructionType::ARG:
+        use(instr.operand2);
+        if (isElementReference(instr))
+            use(instr.operand3);
+        break;
+    case InstructionType::CMP:
+    case InstructionType::BOUNDS:
+        use(instr.operand1);
+        use(instr.operand2);
+        break;
+    case InstructionType::PRINT:
+        if (instr.operand1 != "STRING")
+            use(instr.operand2);
+        break;
+    case InstructionType::LOAD_INDEXED:
+    case InstructionType::SHL:
+    case InstructionType::SHR:
+    case InstructionType::SAR:
+    case InstructionType::BITAND:
+    case InstructionType::MULHI:
+        use(instr.operand2);
+        use(instr.operand3);
+        break;
+    case InstructionType::STORE_INDEXED:
+        use(instr.operand1);
+        use(instr.operand2);
+        use(instr.operand3);
+        break;
+    default:
+        break;
+    }
+}
+
+std::string getWrittenMemory(const Instruction &instr)
+{
+    switch (instr.type)
+    {
+    case InstructionType::STORE:
+        return isTempName(instr.operand1) ? "" : instr.operand1;
+    case InstructionType::READ:
+    case InstructionType::STORE_INDEXED:
+        return instr.operand1;
+    default:
+        return "";
+    }
+}
+
+bool Loop::contains(size_t block) const
+{
+    return std::binary_search(blocks.begin(), blocks.end(), block);
+}
+
+ControlFlowGraph::ControlFlowGraph(const std::vector<Instruction> &code) : code(code)
+{
+    buildBlocks();
+    computeDominators();
+}
+
+void ControlFlowGraph::buildBlocks()
+{
+    blocks.clear();
+    blockIndex.assign(code.size(), 0);
+    if (code.empty())
+        return;
+
+    // تحديد بدايات الكتل: أول تعليمة، كل تسمية أو بداية إجراء، وما بعد كل قفزة
+    std::vector<bool> leader(code.size(), false);
+    leader[0] = true;
+    std::unordered_map<std::string, size_t> labelPositions;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        const Instruction &instr = code[i];
+        if (instr.type == InstructionType::LABEL)
+        {
+            leader[i] = true;
+            labelPositions[instr.operand1] = i;
+        }
+        else if (instr.type == InstructionType::FUNC)
+        {
+            leader[i] = true;
+        }
+        else if ((isTerminator(instr.type) || isConditionalJump(instr.type)) && i + 1 < code.size())
+        {
+            leader[i + 1] = true;
+        }
+    }
+
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        if (leader[i])
+        {
+            if (!blocks.empty())
+                blocks.back().end = i;
+            blocks.push_back(BasicBlock{i, code.size(), {}, {}});
+        }
+        blockIndex[i] = blocks.size() - 1;
+    }
+
+    auto addEdge = [this](size_t from, size_t to)
+    {
+        auto &succ = blocks[from].successors;
+        if (std::find(succ.begin(), succ.end(), to) == succ.end())
+        {
+            succ.push_back(to);
+            blocks[to].predecessors.push_back(from);
+        }
+    };
+
+    for (size_t b = 0; b < blocks.size(); ++b)
+    {
+        const Instruction &last = code[blocks[b].end - 1];
+        std::string target = getJumpTarget(last);
+        if (!target.empty())
+        {
+            auto it = labelPositions.find(target);
+            if (it != labelPositions.end())
+                addEdge(b, blockIndex[it->second]);
+        }
+        if (!isTerminator(last.type) && b + 1 < blocks.size())
+        {
+            addEdge(b, b + 1);
+        }
+    }
+}
+
+void ControlFlowGraph::computeDominators()
+{
+    size_t n = blocks.size();
+    idom.assign(n, -1);
+    rpo.clear();
+    rpoNumber.assign(n, n);
+    if (n == 0)
+        return;
+
+    // المداخل: بداية البرنامج وبداية كل إجراء ذي إطار (يُدخل إليه بـ CALL)
+    std::vector<size_t> entries;
+    for (size_t b = 0; b < n; ++b)
+    {
+        if (b == 0 || code[blocks[b].start].type == InstructionType::FUNC)
+            entries.push_back(b);
+    }
+
+    // ترتيب ما بعد الزيارة المعكوس بدون تعاود
+    std::vector<bool> visited(n, false);
+    std::vector<std::pair<size_t, size_t>> stack;
+    std::vector<size_t> postOrder;
+    for (size_t entry : entries)
+    {
+        if (visited[entry])
+            continue;
+        stack.push_back({entry, 0});
+        visited[entry] = true;
+        while (!stack.empty())
+        {
+            auto &top = stack.back();
+            const auto &succ = blocks[top.first].successors;
+            if (top.second < succ.size())
+            {
+                size_t next = succ[top.second++];
+                if (!visited[next])
+                {
+                    visited[next] = true;
+                    stack.push_back({next, 0});
+                }
+            }
+            else
+            {
+                postOrder.push_back(top.first);
+                stack.pop_back();
+            }
+        }
+    }
+    rpo.assign(postOrder.rbegin(), postOrder.rend());
+    for (size_t i = 0; i < rpo.size(); ++i)
+        rpoNumber[rpo[i]] = i;
+
+    // خوارزمية Cooper-Harvey-Kennedy التكرارية؛ كل مدخل جذر لشجرته
+    for (size_t entry : entries)
+        idom[entry] = static_cast<long>(entry);
+    auto intersect = [this](size_t a, size_t b)
+    {
+        while (a != b)
+        {
+            while (rpoNumber[a] > rpoNumber[b])
+                a = static_cast<size_t>(idom[a]);
+            while (rpoNumber[b] > rpoNumber[a])
+                b = static_cast<size_t>(idom[b]);
+        }
+        return a;
+    };
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 0; i < rpo.size(); ++i)
+        {
+            size_t b = rpo[i];
+            if (idom[b] == static_cast<long>(b))
+                continue;
+            long newIdom = -1;
+            for (size_t p : blocks[b].predecessors)
+            {
+                if (idom[p] < 0)
+                    continue;
+                newIdom = newIdom < 0 ? static_cast<long>(p)
+                                      : static_cast<long>(intersect(p, static_cast<size_t>(newIdom)));
+            }
+            if (newIdom != idom[b])
+            {
+                idom[b] = newIdom;
+                changed = true;
+            }
+        }
+    }
+}
+
+bool ControlFlowGraph::isReachable(size_t block) const
+{
+    return block < blocks.size() && idom[block] >= 0;
+}
+
+bool ControlFlowGraph::dominates(size_t a, size_t b) const
+{
+    if (!isReachable(a) || !isReachable(b))
+        return false;
+    while (true)
+    {
+        if (a == b)
+            return true;
+        if (idom[b] == static_cast<long>(b))
+            return false;
+        b = static_cast<size_t>(idom[b]);
+    }
+}
+
+std::vector<Loop> ControlFlowGraph::findLoops() const
+{
+    std::vector<Loop> loops;
+    std::unordered_map<size_t, size_t> loopOfHeader;
+
+    for (size_t b : rpo)
+    {
+        for (size_t h : blocks[b].successors)
+        {
+            if (!dominates(h, b))
+                continue;
+            // حافة خلفية b -> h
+            auto it = loopOfHeader.find(h);
+            if (it == loopOfHeader.end())
+            {
+                loopOfHeader[h] = loops.size();
+                loops.push_back(Loop{h, {}, {}, {}, 1});
+                it = loopOfHeader.find(h);
+            }
+            loops[it->second].latches.push_back(b);
+        }
+    }
+
+    for (auto &loop : loops)
+    {
+        std::vector<bool> inLoop(blocks.size(), false);
+        inLoop[loop.header] = true;
+        std::vector<size_t> work(loop.latches.begin(), loop.latches.end());
+        while (!work.empty())
+        {
+            size_t b = work.back();
+            work.pop_back();
+            if (inLoop[b])
+                continue;
+            inLoop[b] = true;
+            for (size_t p : blocks[b].predecessors)
+            {
+                if (isReachable(p) && !inLoop[p])
+                    work.push_back(p);
+            }
+        }
+        for (size_t b = 0; b < blocks.size(); ++b)
+        {
+            if (!inLoop[b])
+                continue;
+            loop.blocks.push_back(b);
+            for (size_t s : blocks[b].successors)
+            {
+                if (!inLoop[s])
+                {
+                    loop.exiting.push_back(b);
+                    break;
+                }
+            }
+        }
+    }
+
+    for (auto &loop : loops)
+    {
+        loop.depth = 0;
+        for (const auto &other : loops)
+        {
+            if (other.contains(loop.header))
+                loop.depth++;
+        }
+    }
+
+    std::sort(loops.begin(), loops.end(), [](const Loop &a, const Loop &b)
+              { return a.blocks.size() < b.blocks.size(); });
+    return loops;
+}
+
+Liveness ControlFlowGraph::computeLiveness(const std::function<bool(const std::string &)> &tracked) const
+{
+    size_t n = blocks.size();
+    Liveness result;
+    result.liveIn.assign(n, {});
+    result.liveOut.assign(n, {});
+
+    // use/def لكل كتلة
+    std::vector<std::unordered_set<std::string>> useSets(n), defSets(n);
+    std::vector<std::string> uses;
+    for (size_t b = 0; b < n; ++b)
+    {
+        for (size_t i = blocks[b].start; i < blocks[b].end; ++i)
+        {
+            uses.clear();
+            getUsedNames(code[i], uses);
+            for (const auto &name : uses)
+            {
+                if (tracked(name) && !defSets[b].count(name))
+                    useSets[b].insert(name);
+            }
+            std::string def = getDefinedName(code[i]);
+            if (!def.empty() && tracked(def))
+                defSets[b].insert(def);
+        }
+    }
+
+    // تكرار حتى الاستقرار بترتيب ما بعد الزيارة (عكس RPO)
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto it = rpo.rbegin(); it != rpo.rend(); ++it)
+        {
+            size_t b = *it;
+            std::unordered_set<std::string> out;
+            for (size_t s : blocks[b].successors)
+                out.insert(result.liveIn[s].begin(), result.liveIn[s].end());
+
+            std::unordered_set<std::string> in = useSets[b];
+            for (const auto &name : out)
+            {
+                if (!defSets[b].count(name))
+                    in.insert(name);
+            }
+
+            if (out.size() != result.liveOut[b].size() || in.size() != result.liveIn[b].size())
+                changed = true;
+            result.liveOut[b].swap(out);
+            result.liveIn[b].swap(in);
+        }
+    }
+    return result;
+}
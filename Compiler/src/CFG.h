@@ -0,0 +1,86 @@
+#ifndef CFG_H
+#define CFG_H
+
+#include "Instruction.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+
+// دوال مساعدة لتصنيف معاملات الكود الوسيط
+bool isTempName(const std::string &name);
+bool isNumericOperand(const std::string &operand);
+bool isConstantOperand(const std::string &operand);
+bool isConditionalJump(InstructionType type);
+bool isTerminator(InstructionType type);
+std::string getJumpTarget(const Instruction &instr);
+// ARG بالمرجع: op3 = "ref" لعنوان المتغير op2، أو مؤقت الفهرس لعنوان العنصر op2[op3]
+bool isReferenceArgument(const Instruction &instr);
+bool isElementReference(const Instruction &instr);
+
+// الاسم الذي تكتبه التعليمة (فارغ إذا لم تكتب شيئاً)
+std::string getDefinedName(const Instruction &instr);
+// الأسماء التي تقرؤها التعليمة (بدون الثوابت)
+void getUsedNames(const Instruction &instr, std::vector<std::string> &uses);
+// المتغير أو المصفوفة التي تكتبها التعليمة في الذاكرة (فارغ إذا لم تكتب)
+std::string getWrittenMemory(const Instruction &instr);
+
+struct BasicBlock
+{
+    size_t start; // أول تعليمة في الكتلة
+    size_t end;   // موضع ما بعد آخر تعليمة
+    std::vector<size_t> successors;
+    std::vector<size_t> predecessors;
+};
+
+struct Loop
+{
+    size_t header;
+    std::vector<size_t> blocks;  // مرتبة تصاعدياً
+    std::vector<size_t> latches; // الكتل التي تقفز عائدة إلى الرأس
+    std::vector<size_t> exiting; // كتل داخل الحلقة لها خلف خارجها
+    int depth;
+
+    bool contains(size_t block) const;
+};
+
+// الأسماء الحية عند بداية كل كتلة ونهايتها
+struct Liveness
+{
+    std::vector<std::unordered_set<std::string>> liveIn;
+    std::vector<std::unordered_set<std::string>> liveOut;
+};
+
+// مخطط التدفق للكود الوسيط: كتل أساسية، مسيطرات، وحلقات طبيعية
+class ControlFlowGraph
+{
+private:
+    const std::vector<Instruction> &code;
+    std::vector<BasicBlock> blocks;
+    std::vector<size_t> blockIndex; // instruction -> block
+    std::vector<long> idom;         // المدخل يسيطر على نفسه، و-1 للكتل غير القابلة للوصول
+    std::vector<size_t> rpo;
+    std::vector<size_t> rpoNumber;
+
+    void buildBlocks();
+    void computeDominators();
+
+public:
+    explicit ControlFlowGraph(const std::vector<Instruction> &code);
+
+    const std::vector<BasicBlock> &getBlocks() const { return blocks; }
+    size_t blockOf(size_t instruction) const { return blockIndex[instruction]; }
+    const std::vector<size_t> &reversePostOrder() const { return rpo; }
+    bool isReachable(size_t block) const;
+    long immediateDominator(size_t block) const { return idom[block]; }
+    bool dominates(size_t a, size_t b) const;
+
+    // الحلقات الطبيعية من الحواف الخلفية، الداخلية أولاً
+    std::vector<Loop> findLoops() const;
+
+    // تحليل الحيوية للأسماء التي يقبلها tracked فقط
+    Liveness computeLiveness(const std::function<bool(const std::string &)> &tracked) const;
+};
+
+#endif
@@ -1,12 +1,34 @@
 #include "Compiler.h"
+#include "PassManager.h"
+#include "RegisterAllocator.h"
+#include "CFG.h"
+#include "MipsPeephole.h"
+#include "StructuredCGenerator.h"
+#include "X86Generator.h"
+#include "X86Encoder.h"
+#include "JitRunner.h"
+#include "ElfWriter.h"
+#include "OutputBuffer.h"
+#include "BytecodeVM.h"
+#include "LLVMGenerator.h"
+#include "Console.h"
 #include <sstream>
 #include <iomanip>
 #include <iostream>
 #include <cctype>
 #include <stdexcept>
 #include <cstring>
-
-Compiler::Compiler() : labelCounter(0), tempVarCounter(0) {}
+#include <cstdlib>
+#include <functional>
+#include <algorithm>
+#include <set>
+
+Compiler::Compiler()
+    : currentFrame(nullptr), labelCounter(0), tempVarCounter(0),
+      inlineProcedures(false), inlineThreshold(40),
+      unrollLoops(false), unrollFactor(4), fullUnrollLimit(16), unrollBudget(256),
+      checkArrays(false), eliminateBoundsChecks(false),
+      allocateRegisters(false), runPeephole(false), recycleTempSlots(false) {}
 
 std::string Compiler::generateLabel()
 {
@@ -37,6 +59,36 @@ std::string Compiler::getStringLabel(const std::string &literal)
     return label;
 }
 
+void Compiler::declareSymbol(const std::string &name, const std::string &meta)
+{
+    if (!currentFrame)
+    {
+        symbolTable[name] = meta;
+        return;
+    }
+
+    // داخل إجراء له إطار: الاسم محلي ينشأ من جديد في كل استدعاء
+    if (!currentFrame->owns(name))
+        currentFrame->locals.push_back(name);
+    currentFrame->symbols[name] = meta;
+}
+
+std::vector<const ProcedureFrame *> Compiler::instructionFrames() const
+{
+    std::vector<const ProcedureFrame *> owner(instructions.size(), nullptr);
+    const ProcedureFrame *frame = nullptr;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (instructions[i].type == InstructionType::FUNC)
+        {
+            auto it = frames.find(instructions[i].operand1);
+            frame = it == frames.end() ? nullptr : &it->second;
+        }
+        owner[i] = frame;
+    }
+    return owner;
+}
+
 std::vector<Instruction> Compiler::compile(std::unique_ptr<ProgramNode> program)
 {
     instructions.clear();
@@ -45,33 +97,59 @@ std::vector<Instruction> Compiler::compile(std::unique_ptr<ProgramNode> program)
     tempVarCounter = 0;
     stringLiterals.clear();
     stringToLabel.clear();
+    procedureNodes.clear();
+    calledProcedures.clear();
+    frames.clear();
+    currentFrame = nullptr;
+    inlineScopes.clear();
+    inlineExitLabels.clear();
+    iteratorRanges.clear();
+
+    programTree = std::move(program);
 
-    if (program)
+    if (programTree)
     {
         try
         {
-            compileProgram(program.get());
+            compileProgram(programTree.get());
             emit(InstructionType::HALT);
+            emitCalledProcedures();
         }
         catch (const std::exception &e)
         {
-            std::cerr << "❌ خطأ أثناء الترجمة: " << e.what() << std::endl;
+            consoleErrors() << "❌ خطأ أثناء الترجمة: " << e.what() << std::endl;
             instructions.clear();
         }
     }
     else
     {
-        std::cerr << "⚠️  البرنامج فارغ - لا شيء لترجمته" << std::endl;
+        consoleErrors() << "⚠️  البرنامج فارغ - لا شيء لترجمته" << std::endl;
     }
 
     return instructions;
 }
 
+void Compiler::configure(const PassManager &passes)
+{
+    inlineProcedures = passes.isEnabled("inline");
+    unrollLoops = passes.isEnabled("unroll");
+    unrollFactor = passes.getUnrollFactor();
+    eliminateBoundsChecks = passes.isEnabled("bounds");
+    allocateRegisters = passes.isEnabled("regalloc");
+    runPeephole = passes.isEnabled("peephole");
+    recycleTempSlots = passes.isEnabled("slots");
+}
+
+void Compiler::optimize(const PassManager &passes)
+{
+    passes.run(instructions, tempVarCounter, labelCounter, frames, symbolTable);
+}
+
 void Compiler::compileProgram(ProgramNode *program)
 {
     if (!program)
     {
-        std::cerr << "⚠️  برنامج فارغ في compileProgram" << std::endl;
+        consoleErrors() << "⚠️  برنامج فارغ في compileProgram" << std::endl;
         return;
     }
 
@@ -98,7 +176,7 @@ void Compiler::compileStatement(ASTNode *statement)
 {
     if (!statement)
     {
-        std::cerr << "⚠️  جملة فارغة في compileStatement" << std::endl;
+        consoleErrors() << "⚠️  جملة فارغة في compileStatement" << std::endl;
         return;
     }
 
@@ -158,7 +236,7 @@ void Compiler::compileStatement(ASTNode *statement)
             if (varNode->name == "__empty__")
                 return;
         }
-        std::cerr << "⚠️  نوع جملة غير معروف في compileStatement: " << statement->getTypeName() << std::endl;
+        consoleErrors() << "⚠️  نوع جملة غير معروف في compileStatement: " << statement->getTypeName() << std::endl;
     }
 }
 
@@ -166,10 +244,23 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
 {
     if (!node)
         return;
+
+    // متغيرات الإجراء المضمّن تأخذ اسماً خاصاً بالإجراء
+    const std::string name = resolveName(node->name);
+
     if (node->typeNode)
     {
         // Determine C type representation from explicit type
+        auto named = symbolTable.end();
         if (auto prim = dynamic_cast<PrimitiveTypeNode *>(node->typeNode.get()))
+            named = symbolTable.find(prim->name);
+        if (named != symbolTable.end() &&
+            (named->second.rfind("record:", 0) == 0 || named->second.rfind("array:", 0) == 0))
+        {
+            // متغير من نوع معرف بـ نوع: يأخذ صيغة ذلك النوع نفسها
+            declareSymbol(name, named->second);
+        }
+        else if (auto prim = dynamic_cast<PrimitiveTypeNode *>(node->typeNode.get()))
         {
             std::string cname = "int";
             if (prim->name == "صحيح")
@@ -182,7 +273,7 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
                 cname = "int";
             else
                 cname = "int"; // fallback
-            symbolTable[node->name] = std::string("primitive:") + cname;
+            declareSymbol(name, std::string("primitive:") + cname);
         }
         else if (auto arr = dynamic_cast<ArrayTypeNode *>(node->typeNode.get()))
         {
@@ -199,13 +290,14 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
                         elemC = "char*";
                 }
             }
-            symbolTable[node->name] = std::string("array:") + elemC + ":" + std::to_string(arr->length);
+            declareSymbol(name, std::string("array:") + elemC + ":" + std::to_string(arr->length));
         }
         else if (auto rec = dynamic_cast<RecordTypeNode *>(node->typeNode.get()))
         {
-            std::string structName = "struct_" + node->name;
+            std::string structName = "struct_" + name;
             std::stringstream ss;
             ss << "struct " << structName << " {\n";
+            recordFields[structName].clear();
             for (const auto &f : rec->fields)
             {
                 std::string fctype = "int";
@@ -222,14 +314,21 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
                     }
                 }
                 ss << "    " << fctype << " " << f.name << ";\n";
+                recordFields[structName].emplace_back(f.name, fctype);
             }
             ss << "};\n";
             recordDefs[structName] = ss.str();
-            symbolTable[node->name] = std::string("record:") + structName;
+            declareSymbol(name, std::string("record:") + structName);
         }
         else
         {
-            symbolTable[node->name] = "primitive:int";
+            declareSymbol(name, "primitive:int");
+        }
+
+        if (auto type = dynamic_cast<TypeNode *>(node->typeNode.get()))
+        {
+            const auto &symbols = currentFrame ? currentFrame->symbols : symbolTable;
+            dataLayout.declare(name, symbols.at(name), type);
         }
     }
     else
@@ -241,26 +340,26 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
             {
                 if (literal->literalType == TokenType::STRING_LITERAL)
                 {
-                    symbolTable[node->name] = "primitive:char*";
+                    declareSymbol(name, "primitive:char*");
                 }
                 else if (literal->literalType == TokenType::REAL_LITERAL)
                 {
-                    symbolTable[node->name] = "primitive:double";
+                    declareSymbol(name, "primitive:double");
                 }
                 else
                 {
-                    symbolTable[node->name] = "primitive:int"; // Default for NUMBER or other literals
+                    declareSymbol(name, "primitive:int"); // Default for NUMBER or other literals
                 }
             }
             else
             {
-                symbolTable[node->name] = "primitive:int"; // Default for complex expressions
+                declareSymbol(name, "primitive:int"); // Default for complex expressions
             }
         }
         else
         {
             // No initial value and no type, default to int
-            symbolTable[node->name] = "primitive:int";
+            declareSymbol(name, "primitive:int");
         }
     }
 
@@ -268,7 +367,7 @@ void Compiler::compileVariableDeclaration(VariableDeclarationNode *node)
     if (node->initialValue)
     {
         std::string temp = compileExpression(node->initialValue.get());
-        emit(InstructionType::STORE, node->name, temp);
+        emit(InstructionType::STORE, name, temp);
     }
 }
 
@@ -278,10 +377,11 @@ void Compiler::compileConstantDeclaration(ConstantDeclarationNode *node)
         return;
 
     // تخزين الثابت في جدول الرموز
-    symbolTable[node->name] = "ثابت";
+    const std::string name = resolveName(node->name);
+    declareSymbol(name, "ثابت");
 
     std::string temp = compileExpression(node->value.get());
-    emit(InstructionType::STORE, node->name, temp);
+    emit(InstructionType::STORE, name, temp);
 }
 
 void Compiler::compileAssignment(AssignmentNode *node)
@@ -296,7 +396,7 @@ void Compiler::compileAssignment(AssignmentNode *node)
     if (auto varNode = dynamic_cast<VariableNode *>(node->left.get()))
     {
         // Simple assignment: var = value
-        emit(InstructionType::STORE, varNode->name, valueTemp);
+        emit(InstructionType::STORE, resolveName(varNode->name), valueTemp);
     }
     else if (auto indexAccessNode = dynamic_cast<IndexAccessNode *>(node->left.get()))
     {
@@ -308,10 +408,11 @@ void Compiler::compileAssignment(AssignmentNode *node)
         {
             throw std::runtime_error("الوصول للفهرس في جملة التعيين يجب أن يكون لمتغير مباشر");
         }
-        std::string arrayName = arrayVarNode->name;
+        std::string arrayName = resolveName(arrayVarNode->name);
 
         // Compile the index expression
         std::string indexTemp = compileExpression(indexAccessNode->index.get());
+        emitBoundsCheck(indexAccessNode->index.get(), indexTemp, arrayName);
 
         // Emit the store instruction
         emit(InstructionType::STORE_INDEXED, arrayName, indexTemp, valueTemp);
@@ -326,7 +427,7 @@ void Compiler::compilePrint(PrintNode *node)
 {
     if (!node || !node->expression)
     {
-        std::cerr << "⚠️  جملة طباعة فارغة أو بدون تعبير" << std::endl;
+        consoleErrors() << "⚠️  جملة طباعة فارغة أو بدون تعبير" << std::endl;
         return;
     }
 
@@ -343,7 +444,7 @@ void Compiler::compilePrint(PrintNode *node)
     // Handle variables directly to use type information from symbol table
     else if (auto variable = dynamic_cast<VariableNode *>(node->expression.get()))
     {
-        emit(InstructionType::PRINT, "VARIABLE", variable->name);
+        emit(InstructionType::PRINT, "VARIABLE", resolveName(variable->name));
         return;
     }
 
@@ -356,22 +457,21 @@ void Compiler::compileRead(ReadNode *node)
     if (!node)
         return;
 
-    emit(InstructionType::READ, node->variableName);
+    emit(InstructionType::READ, resolveName(node->variableName));
 }
 
 void Compiler::compileIf(IfNode *node)
 {
     if (!node || !node->condition)
     {
-        std::cerr << "⚠️  جملة شرطية فارغة أو بدون شرط" << std::endl;
+        consoleErrors() << "⚠️  جملة شرطية فارغة أو بدون شرط" << std::endl;
         return;
     }
 
     std::string elseLabel = generateLabel();
     std::string endLabel = generateLabel();
 
-    std::string conditionTemp = compileExpression(node->condition.get());
-    emit(InstructionType::JZ, conditionTemp, elseLabel);
+    compileCondition(node->condition.get(), elseLabel, false);
 
     // فرع then
     for (auto &stmt : node->thenBranch)
@@ -408,17 +508,18 @@ void Compiler::compileWhile(WhileNode *node)
 {
     if (!node || !node->condition)
     {
-        std::cerr << "⚠️  حلقة طالما فارغة أو بدون شرط" << std::endl;
+        consoleErrors() << "⚠️  حلقة طالما فارغة أو بدون شرط" << std::endl;
         return;
     }
 
-    std::string startLabel = generateLabel();
+    std::string bodyLabel = generateLabel();
     std::string endLabel = generateLabel();
 
-    emit(InstructionType::LABEL, startLabel);
+    // تدوير الحلقة: اختبار حارس مرة واحدة ثم جسم يُختبر شرطه في الأسفل
+    // كما في كرر-حتى، فلا يبقى في كل دورة إلا قفزة شرطية واحدة
+    compileCondition(node->condition.get(), endLabel, false);
 
-    std::string conditionTemp = compileExpression(node->condition.get());
-    emit(InstructionType::JZ, conditionTemp, endLabel);
+    emit(InstructionType::LABEL, bodyLabel);
 
     for (auto &stmt : node->body)
     {
@@ -428,7 +529,7 @@ void Compiler::compileWhile(WhileNode *node)
         }
     }
 
-    emit(InstructionType::JMP, startLabel);
+    compileCondition(node->condition.get(), bodyLabel, true);
     emit(InstructionType::LABEL, endLabel);
 }
 
@@ -436,7 +537,7 @@ void Compiler::compileRepeat(RepeatNode *node)
 {
     if (!node || !node->condition)
     {
-        std::cerr << "⚠️  حلقة كرر-حتى فارغة أو بدون شرط" << std::endl;
+        consoleErrors() << "⚠️  حلقة كرر-حتى فارغة أو بدون شرط" << std::endl;
         return;
     }
 
@@ -452,9 +553,8 @@ void Compiler::compileRepeat(RepeatNode *node)
         }
     }
 
-    std::string conditionTemp = compileExpression(node->condition.get());
     // في حلقة repeat-until، نكرر حتى يصبح الشرط صحيحاً
-    emit(InstructionType::JZ, conditionTemp, startLabel);
+    compileCondition(node->condition.get(), startLabel, false);
 }
 
 void Compiler::compileFor(ForNode *node)
@@ -462,26 +562,35 @@ void Compiler::compileFor(ForNode *node)
     if (!node)
         return;
 
+    if (unrollLoops && unrollFor(node))
+        return;
+
+    const std::string iteratorName = resolveName(node->iteratorName);
+
     // 1. Initialize the iterator variable
-    symbolTable[node->iteratorName] = "primitive:int"; // Ensure it's an integer
+    if (!currentFrame || !currentFrame->owns(iteratorName))
+        symbolTable[iteratorName] = "primitive:int"; // Ensure it's an integer
     std::string startValTemp = compileExpression(node->startValue.get());
-    emit(InstructionType::STORE, node->iteratorName, startValTemp);
+    emit(InstructionType::STORE, iteratorName, startValTemp);
 
-    std::string loopStartLabel = generateLabel();
+    std::string loopBodyLabel = generateLabel();
     std::string loopEndLabel = generateLabel();
 
-    // 2. Start of the loop
-    emit(InstructionType::LABEL, loopStartLabel);
-
-    // 3. Condition check
+    // 2. Guard: skip the loop entirely if iterator > endValue
     std::string iteratorTemp = generateTempVar();
-    emit(InstructionType::LOAD, iteratorTemp, node->iteratorName);
+    emit(InstructionType::LOAD, iteratorTemp, iteratorName);
     std::string endValTemp = compileExpression(node->endValue.get());
 
     emit(InstructionType::CMP, iteratorTemp, endValTemp);
-    emit(InstructionType::JG, loopEndLabel); // Jump if iterator > endValue
+    emit(InstructionType::JG, loopEndLabel);
+
+    // مدى العداد داخل الجسم: يحذف فحوص الحدود الزائدة وينقل ما يمكن منها إلى هنا
+    bool tracked = checkArrays && eliminateBoundsChecks &&
+                   trackIteratorRange(node, iteratorName, startValTemp, endValTemp);
+
+    // 3. Loop body (bottom-tested, entered only after the guard passed)
+    emit(InstructionType::LABEL, loopBodyLabel);
 
-    // 4. Compile loop body
     for (auto &stmt : node->body)
     {
         if (stmt)
@@ -489,8 +598,10 @@ void Compiler::compileFor(ForNode *node)
             compileStatement(stmt.get());
         }
     }
+    if (tracked)
+        iteratorRanges.pop_back();
 
-    // 5. Increment step
+    // 4. Increment step
     std::string stepValTemp;
     if (node->stepValue)
     {
@@ -502,15 +613,17 @@ void Compiler::compileFor(ForNode *node)
         emit(InstructionType::LOAD, stepValTemp, "1"); // Default step is 1
     }
 
-    emit(InstructionType::LOAD, iteratorTemp, node->iteratorName); // Reload iterator value
+    emit(InstructionType::LOAD, iteratorTemp, iteratorName); // Reload iterator value
     std::string newIteratorTemp = generateTempVar();
     emit(InstructionType::ADD, newIteratorTemp, iteratorTemp, stepValTemp);
-    emit(InstructionType::STORE, node->iteratorName, newIteratorTemp);
+    emit(InstructionType::STORE, iteratorName, newIteratorTemp);
 
-    // 6. Jump back to the start
-    emit(InstructionType::JMP, loopStartLabel);
+    // 5. Bottom test: jump back while iterator <= endValue
+    std::string bottomEndTemp = compileExpression(node->endValue.get());
+    emit(InstructionType::CMP, newIteratorTemp, bottomEndTemp);
+    emit(InstructionType::JLE, loopBodyLabel);
 
-    // 7. End of the loop
+    // 6. End of the loop
     emit(InstructionType::LABEL, loopEndLabel);
 }
 
@@ -528,6 +641,19 @@ std::string Compiler::compileExpression(ASTNode *expr)
             throw std::runtime_error("عملية ثنائية بدون معاملين");
         }
 
+        // التقييم المختصر: لا يُحسب المعامل الأيمن إذا حسم الأيسر النتيجة
+        if (binaryOp->op == TokenType::AND || binaryOp->op == TokenType::OR)
+        {
+            std::string resultTemp = generateTempVar();
+            std::string endLabel = generateLabel();
+
+            emit(InstructionType::LOAD, resultTemp, "0");
+            compileCondition(binaryOp, endLabel, false);
+            emit(InstructionType::LOAD, resultTemp, "1");
+            emit(InstructionType::LABEL, endLabel);
+            return resultTemp;
+        }
+
         std::string leftTemp = compileExpression(binaryOp->left.get());
         std::string rightTemp = compileExpression(binaryOp->right.get());
         std::string resultTemp = generateTempVar();
@@ -549,12 +675,6 @@ std::string Compiler::compileExpression(ASTNode *expr)
         case TokenType::MOD:
             emit(InstructionType::MOD, resultTemp, leftTemp, rightTemp);
             break;
-        case TokenType::AND:
-            emit(InstructionType::AND, resultTemp, leftTemp, rightTemp);
-            break;
-        case TokenType::OR:
-            emit(InstructionType::OR, resultTemp, leftTemp, rightTemp);
-            break;
         case TokenType::EQUALS:
         case TokenType::NOT_EQUALS:
         case TokenType::LESS:
@@ -647,7 +767,7 @@ std::string Compiler::compileExpression(ASTNode *expr)
     else if (auto variable = dynamic_cast<VariableNode *>(expr))
     {
         std::string temp = generateTempVar();
-        emit(InstructionType::LOAD, temp, variable->name);
+        emit(InstructionType::LOAD, temp, resolveName(variable->name));
         return temp;
     }
     else if (auto indexAccess = dynamic_cast<IndexAccessNode *>(expr))
@@ -662,6 +782,145 @@ std::string Compiler::compileExpression(ASTNode *expr)
     throw std::runtime_error("نوع تعبير غير مدعوم: " + std::string(expr->getTypeName()));
 }
 
+// ترجمة شرط في سياق تفرع: القفز إلى target عندما تساوي قيمة الشرط jumpIfTrue،
+// والاستمرار في التنفيذ خلاف ذلك. عمليات && و || تُقيَّم تقييماً مختصراً.
+void Compiler::compileCondition(ASTNode *expr, const std::string &target, bool jumpIfTrue)
+{
+    if (!expr)
+    {
+        throw std::runtime_error("شرط فارغ في compileCondition");
+    }
+
+    if (auto binaryOp = dynamic_cast<BinaryOpNode *>(expr))
+    {
+        if (!binaryOp->left || !binaryOp->right)
+        {
+            throw std::runtime_error("عملية ثنائية بدون معاملين");
+        }
+
+        switch (binaryOp->op)
+        {
+        case TokenType::AND:
+            if (jumpIfTrue)
+            {
+                // إذا كان الأيسر خاطئاً فالنتيجة خاطئة: تخطَّ الأيمن
+                std::string skipLabel = generateLabel();
+                compileCondition(binaryOp->left.get(), skipLabel, false);
+                compileCondition(binaryOp->right.get(), target, true);
+                emit(InstructionType::LABEL, skipLabel);
+            }
+            else
+            {
+                compileCondition(binaryOp->left.get(), target, false);
+                compileCondition(binaryOp->right.get(), target, false);
+            }
+            return;
+        case TokenType::OR:
+            if (jumpIfTrue)
+            {
+                compileCondition(binaryOp->left.get(), target, true);
+                compileCondition(binaryOp->right.get(), target, true);
+            }
+            else
+            {
+                // إذا كان الأيسر صحيحاً فالنتيجة صحيحة: تخطَّ الأيمن
+                std::string skipLabel = generateLabel();
+                compileCondition(binaryOp->left.get(), skipLabel, true);
+                compileCondition(binaryOp->right.get(), target, false);
+                emit(InstructionType::LABEL, skipLabel);
+            }
+            return;
+        case TokenType::EQUALS:
+        case TokenType::NOT_EQUALS:
+        case TokenType::LESS:
+        case TokenType::GREATER:
+        case TokenType::LESS_EQUAL:
+        case TokenType::GREATER_EQUAL:
+        {
+            std::string leftTemp = compileExpression(binaryOp->left.get());
+            std::string rightTemp = compileExpression(binaryOp->right.get());
+            emit(InstructionType::CMP, leftTemp, rightTemp);
+
+            // عند القفز على الخطأ نستخدم المقارنة المعاكسة مباشرة
+            TokenType op = binaryOp->op;
+            if (!jumpIfTrue)
+            {
+                switch (op)
+                {
+                case TokenType::EQUALS:
+                    op = TokenType::NOT_EQUALS;
+                    break;
+                case TokenType::NOT_EQUALS:
+                    op = TokenType::EQUALS;
+                    break;
+                case TokenType::LESS:
+                    op = TokenType::GREATER_EQUAL;
+                    break;
+                case TokenType::GREATER:
+                    op = TokenType::LESS_EQUAL;
+                    break;
+                case TokenType::LESS_EQUAL:
+                    op = TokenType::GREATER;
+                    break;
+                default:
+                    op = TokenType::LESS;
+                    break;
+                }
+            }
+
+            switch (op)
+            {
+            case TokenType::EQUALS:
+                emit(InstructionType::JE, target);
+                break;
+            case TokenType::NOT_EQUALS:
+                emit(InstructionType::JNE, target);
+                break;
+            case TokenType::LESS:
+                emit(InstructionType::JL, target);
+                break;
+            case TokenType::GREATER:
+                emit(InstructionType::JG, target);
+                break;
+            case TokenType::LESS_EQUAL:
+                emit(InstructionType::JLE, target);
+                break;
+            default:
+                emit(InstructionType::JGE, target);
+                break;
+            }
+            return;
+        }
+        default:
+            break;
+        }
+    }
+    else if (auto unaryOp = dynamic_cast<UnaryOpNode *>(expr))
+    {
+        if (unaryOp->op == TokenType::NOT && unaryOp->operand)
+        {
+            compileCondition(unaryOp->operand.get(), target, !jumpIfTrue);
+            return;
+        }
+    }
+    else if (auto literal = dynamic_cast<LiteralNode *>(expr))
+    {
+        // الثوابت المنطقية تحسم التفرع وقت الترجمة
+        if (literal->literalType == TokenType::TRUE_VAL || literal->literalType == TokenType::FALSE_VAL)
+        {
+            bool value = literal->literalType == TokenType::TRUE_VAL;
+            if (value == jumpIfTrue)
+            {
+                emit(InstructionType::JMP, target);
+            }
+            return;
+        }
+    }
+
+    std::string conditionTemp = compileExpression(expr);
+    emit(jumpIfTrue ? InstructionType::JNZ : InstructionType::JZ, conditionTemp, target);
+}
+
 std::string Compiler::compileIndexAccess(IndexAccessNode *node)
 {
     if (!node || !node->variable || !node->index)
@@ -675,273 +934,829 @@ std::string Compiler::compileIndexAccess(IndexAccessNode *node)
         throw std::runtime_error("الوصول للفهرس لا يدعم إلا المتغيرات المباشرة حاليًا");
     }
 
-    std::string arrayName = varNode->name;
+    std::string arrayName = resolveName(varNode->name);
     std::string indexTemp = compileExpression(node->index.get());
+    emitBoundsCheck(node->index.get(), indexTemp, arrayName);
     std::string resultTemp = generateTempVar();
 
     emit(InstructionType::LOAD_INDEXED, resultTemp, arrayName, indexTemp);
     return resultTemp;
 }
 
-void Compiler::generateAssembly(const std::string &filename)
+void Compiler::generateAssembly(const std::string &filename) const
 {
-    std::ofstream file(filename);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("لا يمكن فتح الملف: " + filename);
+    OutputBuffer file;
+
+    // كل إجراء ذي إطار منطقة من الكود بعد HALT. المتغيرات العامة التي
+    // تلمسها الإجراءات أو يُمرر عنوانها تبقى في الذاكرة حتى يراها الجميع
+    std::vector<const ProcedureFrame *> owner = instructionFrames();
+    std::unordered_map<std::string, std::string> frameSymbols;
+    std::unordered_set<std::string> referenceParams;
+    for (const auto &entry : frames)
+    {
+        frameSymbols.insert(entry.second.symbols.begin(), entry.second.symbols.end());
+        referenceParams.insert(entry.second.byReference.begin(), entry.second.byReference.end());
+    }
+    std::unordered_set<std::string> frameTemps;
+    std::unordered_set<std::string> pinnedToMemory;
+    std::unordered_map<const ProcedureFrame *, std::set<std::string>> frameNames;
+    std::vector<std::string> names;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const Instruction &instr = instructions[i];
+        if (instr.type == InstructionType::ARG && instr.operand3 == "ref")
+            pinnedToMemory.insert(instr.operand2);
+        if (!owner[i])
+            continue;
+        names.clear();
+        getUsedNames(instr, names);
+        names.push_back(getDefinedName(instr));
+        for (const auto &name : names)
+        {
+            if (name.empty())
+                continue;
+            if (isTempName(name))
+                frameTemps.insert(name);
+            else if (!owner[i]->owns(name))
+            {
+                pinnedToMemory.insert(name);
+                continue;
+            }
+            frameNames[owner[i]].insert(name);
+        }
+    }
+
+    // توزيع السجلات: المؤقتات والمتغيرات البسيطة تعيش في السجلات،
+    // و$t8/$t9 محجوزان لتحميل ما بقي في الذاكرة والثوابت
+    RegisterAllocator allocator(instructions, [&](const std::string &name)
+                                {
+                                    if (pinnedToMemory.count(name) || referenceParams.count(name))
+                                        return false;
+                                    if (isTempName(name))
+                                        return true;
+                                    std::unordered_map<std::string, std::string>::const_iterator it = frameSymbols.find(name);
+                                    if (it == frameSymbols.end())
+                                    {
+                                        it = symbolTable.find(name);
+                                        if (it == symbolTable.end())
+                                            return false;
+                                    }
+                                    return it->second.rfind("primitive:", 0) == 0 || it->second == "ثابت"; });
+    if (allocateRegisters)
+        allocator.allocate({"$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7",
+                            "$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7"});
+
+    // تخطيط الإطار (من $fp صعوداً): خانات ما بقي في الذاكرة من المعاملات
+    // والمحليات والمؤقتات، ثم السجلات التي يحفظها الإجراء، ثم $fp و$ra القديمان.
+    // كل إجراء يحفظ ما يستخدمه من سجلات، فتبقى قيم المستدعي سليمة بعد العودة
+    struct FrameLayout
+    {
+        std::unordered_map<std::string, int> slots;
+        std::vector<std::pair<std::string, int>> saved;
+        int size = 0;
+    };
+    std::unordered_map<const ProcedureFrame *, FrameLayout> layouts;
+    for (const auto &entry : frames)
+    {
+        const ProcedureFrame *frame = &entry.second;
+        std::vector<std::string> ordered(frame->parameters.begin(), frame->parameters.end());
+        ordered.insert(ordered.end(), frame->locals.begin(), frame->locals.end());
+        for (const auto &name : frameNames[frame])
+        {
+            if (isTempName(name))
+                ordered.push_back(name);
+        }
+
+        FrameLayout &layout = layouts[frame];
+        std::set<std::string> savedRegisters;
+        int offset = 0;
+        for (const auto &name : ordered)
+        {
+            std::string reg = allocator.registerOf(name);
+            if (!reg.empty())
+                savedRegisters.insert(reg);
+            else if (!layout.slots.count(name))
+            {
+                auto meta = frame->symbols.find(name);
+                TypeLayout type = dataLayout.of(meta == frame->symbols.end() ? "" : meta->second);
+                offset = (offset + type.alignment - 1) / type.alignment * type.alignment;
+                layout.slots[name] = offset;
+                offset += type.size;
+            }
+        }
+        for (const auto &reg : savedRegisters)
+        {
+            layout.saved.push_back({reg, offset});
+            offset += 4;
+        }
+        // $fp و$ra، مع محاذاة الإطار على 8 بايت
+        layout.size = (offset + 8 + 7) / 8 * 8;
     }
 
-    file << "# كود تجميعي مولد للغة العربية" << std::endl;
-    file << "# =============================" << std::endl
-         << std::endl;
+    file << "# كود تجميعي مولد للغة العربية\n";
+    file << "# =============================\n\n";
 
-    file << ".data" << std::endl;
+    file << ".data\n";
 
-    // تعريف المتغيرات
+    // تعريف المتغيرات: القوائم والسجلات (والحقيقي) تحجز حجمها كاملاً على محاذاتها
     for (const auto &symbol : symbolTable)
     {
-        file << symbol.first << ": .word 0" << std::endl;
+        TypeLayout type = dataLayout.of(symbol.second);
+        if (type.size == 4)
+        {
+            file << symbol.first << ": .word 0\n";
+            continue;
+        }
+        if (type.alignment > 4)
+            file << ".align " << (type.alignment == 8 ? 3 : 4) << '\n';
+        file << symbol.first << ": .space " << type.size << '\n';
     }
 
-    // تعريف المتغيرات المؤقتة
-    for (int i = 0; i < tempVarCounter; i++)
+    // المؤقتات التي بقيت في الذاكرة تتشارك خانات .data حسب أعمارها،
+    // فيتناسب حجم القسم مع أقصى عدد حي منها لا مع عدد التعبيرات
+    RegisterAllocator memorySlots(instructions, [&](const std::string &name)
+                                  { return isTempName(name) && !allocator.inRegister(name) && !frameTemps.count(name); });
+    if (recycleTempSlots)
+    {
+        int tempSlotCount = memorySlots.allocateSlots("t");
+        for (int i = 0; i < tempSlotCount; i++)
+        {
+            file << "t" << i << ": .word 0\n";
+        }
+    }
+    else
     {
-        file << "t" << i << ": .word 0" << std::endl;
+        for (int i = 0; i < tempVarCounter; i++)
+        {
+            std::string temp = "t" + std::to_string(i);
+            if (!allocator.inRegister(temp) && !frameTemps.count(temp))
+                file << temp << ": .word 0\n";
+        }
     }
+    // الإجراء الذي تُولد تعليماته الآن وتخطيط إطاره
+    const ProcedureFrame *frame = nullptr;
+    const FrameLayout *layout = nullptr;
+
+    auto metaOf = [&](const std::string &name)
+    {
+        if (frame && frame->owns(name))
+            return frame->symbols.at(name);
+        auto it = symbolTable.find(name);
+        return it == symbolTable.end() ? std::string() : it->second;
+    };
+
+    auto memoryName = [&](const std::string &name)
+    {
+        // حقل سجل (اسم.حقل): إزاحته من بداية السجل في خانة إطاره أو في .data
+        std::string base = name;
+        int field = -1;
+        size_t dot = name.find('.');
+        if (dot != std::string::npos)
+        {
+            base = name.substr(0, dot);
+            field = dataLayout.of(metaOf(base)).fieldOffset(name.substr(dot + 1));
+            if (field < 0)
+                return name;
+        }
+        if (layout)
+        {
+            auto it = layout->slots.find(base);
+            if (it != layout->slots.end())
+                return std::to_string(it->second + std::max(field, 0)) + "($fp)";
+        }
+        if (field >= 0)
+            return field == 0 ? base : base + "+" + std::to_string(field);
+        std::string slot = memorySlots.registerOf(name);
+        return slot.empty() ? name : slot;
+    };
+    auto isReference = [&](const std::string &name)
+    {
+        return frame && frame->byReference.count(name) != 0;
+    };
+
+    file << "newline: .asciiz \"\\n\"\n";
+    file << "int_format: .asciiz \"%d\"\n";
+    file << "str_format: .asciiz \"%s\"\n";
 
-    file << "newline: .asciiz \"\\n\"" << std::endl;
-    file << "int_format: .asciiz \"%d\"" << std::endl;
-    file << "str_format: .asciiz \"%s\"" << std::endl;
+    bool checksBounds = std::any_of(instructions.begin(), instructions.end(), [](const Instruction &instr)
+                                    { return instr.type == InstructionType::BOUNDS; });
+    if (checksBounds)
+        file << "bounds_message: .asciiz \"خطأ وقت التنفيذ: فهرس خارج حدود القائمة\"\n";
 
     // تعريف السلاسل النصية
     for (size_t i = 0; i < stringLiterals.size(); ++i)
     {
-        std::string label = "str_" + std::to_string(i);
-        file << label << ": .asciiz \"";
         // هروب الأحرف الخاصة في السلاسل النصية
-        for (char ch : stringLiterals[i])
-        {
-            if (ch == '"')
-                file << "\\\"";
-            else if (ch == '\\')
-                file << "\\\\";
-            else if (ch == '\n')
-                file << "\\n";
-            else if (ch == '\t')
-                file << "\\t";
-            else
-                file << ch;
-        }
-        file << "\"" << std::endl;
+        file << "str_" << i << ": .asciiz \"" << escapeString(stringLiterals[i]) << "\"\n";
+    }
+
+    file << "\n.text\n";
+    file << ".globl main\n";
+    file << "main:\n";
+
+    // تُبنى تعليمات القسم النصي أولاً ليمر عليها محسّن ثقب المفتاح قبل الكتابة
+    std::vector<MipsInstr> text;
+    auto asmInstr = [&text](const std::string &op, std::vector<std::string> args = {})
+    {
+        text.push_back(MipsInstr::instr(op, std::move(args)));
+    };
+
+    // ما في السجلات ويُقرأ قبل الكتابة يبدأ بصفر كما في .data
+    for (const auto &name : allocator.getLiveAtEntry())
+    {
+        asmInstr("move", {allocator.registerOf(name), "$zero"});
     }
 
-    file << std::endl
-         << ".text" << std::endl;
-    file << ".globl main" << std::endl;
-    file << "main:" << std::endl;
+    // تحميل معامل إلى سجل: سجله المخصص إن وجد، وإلا scratch
+    auto load = [&](const std::string &operand, const std::string &scratch) -> std::string
+    {
+        std::string reg = allocator.registerOf(operand);
+        if (!reg.empty())
+            return reg;
+        if (operand.rfind("str_", 0) == 0)
+            asmInstr("la", {scratch, operand});
+        else if (isNumericOperand(operand))
+            asmInstr("li", {scratch, operand});
+        else if (operand == "صح" || operand == "خطأ")
+            asmInstr("li", {scratch, operand == "صح" ? "1" : "0"});
+        else if (isReference(operand))
+        {
+            // المعامل بالمرجع: الخانة تحمل عنوان متغير المستدعي
+            asmInstr("lw", {scratch, memoryName(operand)});
+            asmInstr("lw", {scratch, "0(" + scratch + ")"});
+        }
+        else
+            asmInstr("lw", {scratch, memoryName(operand)});
+        return scratch;
+    };
+
+    // السجل الذي يُحسب فيه الناتج مباشرة
+    auto resultRegister = [&](const std::string &name) -> std::string
+    {
+        std::string reg = allocator.registerOf(name);
+        return reg.empty() ? "$t8" : reg;
+    };
+
+    // كتابة الناتج إلى الذاكرة إذا لم يكن للاسم سجل
+    auto writeBack = [&](const std::string &name, const std::string &value)
+    {
+        std::string reg = allocator.registerOf(name);
+        if (reg.empty() && isReference(name))
+        {
+            asmInstr("lw", {"$t9", memoryName(name)});
+            asmInstr("sw", {value, "0($t9)"});
+        }
+        else if (reg.empty())
+            asmInstr("sw", {value, memoryName(name)});
+        else if (reg != value)
+            asmInstr("move", {reg, value});
+    };
+
+    // عنوان عنصر القائمة بصيغة offset(base): الفهرس × حجم العنصر (sll)
+    // يُجمع إلى قاعدة القائمة (addu) في $t9، فيبقى $t8 حراً لقيمة التخزين
+    auto element = [&](const std::string &arrayName, const std::string &index) -> std::string
+    {
+        int size = std::max(4, dataLayout.of(metaOf(arrayName)).elementSize);
+        bool inFrame = layout && layout->slots.count(arrayName) && !isReference(arrayName);
+        int offset = inFrame ? layout->slots.at(arrayName) : 0;
+
+        if (isNumericOperand(index))
+        {
+            offset += size * static_cast<int>(std::stoll(index));
+            if (inFrame)
+                return std::to_string(offset) + "($fp)";
+            asmInstr(isReference(arrayName) ? "lw" : "la", {"$t9", memoryName(arrayName)});
+            return std::to_string(offset) + "($t9)";
+        }
+
+        std::string value = load(index, "$t9");
+        if ((size & (size - 1)) == 0)
+        {
+            int shift = 0;
+            while ((1 << shift) < size)
+                ++shift;
+            asmInstr("sll", {"$t9", value, std::to_string(shift)});
+        }
+        else
+        {
+            asmInstr("li", {"$t8", std::to_string(size)});
+            asmInstr("mul", {"$t9", value, "$t8"});
+        }
+        std::string base = "$fp";
+        if (!inFrame)
+        {
+            // المعامل بالمرجع يحمل عنوان القائمة، والعامة عنوانها تسميتها
+            asmInstr(isReference(arrayName) ? "lw" : "la", {"$t8", memoryName(arrayName)});
+            base = "$t8";
+        }
+        asmInstr("addu", {"$t9", "$t9", base});
+        return std::to_string(offset) + "($t9)";
+    };
+
+    auto binary = [&](const char *op, const Instruction &instr)
+    {
+        std::string left = load(instr.operand2, "$t8");
+        std::string right = load(instr.operand3, "$t9");
+        std::string dest = resultRegister(instr.operand1);
+        asmInstr(op, {dest, left, right});
+        writeBack(instr.operand1, dest);
+    };
 
     // لتتبع آخر عملية مقارنة
     std::string lastCmpLeft;
     std::string lastCmpRight;
 
-    for (const auto &instr : instructions)
+    auto branch = [&](const char *op, const std::string &target)
     {
-        file << "    ";
+        std::string left = load(lastCmpLeft, "$t8");
+        std::string right = load(lastCmpRight, "$t9");
+        asmInstr(op, {left, right, target});
+    };
+
+    // معاملات الاستدعاء التالي بالترتيب
+    std::vector<const Instruction *> pendingArgs;
+
+    // تحرير الإطار الحالي: استعادة السجلات المحفوظة و$ra و$fp ثم $sp
+    auto leaveFrame = [&]()
+    {
+        for (const auto &saved : layout->saved)
+        {
+            asmInstr("lw", {saved.first, std::to_string(saved.second) + "($fp)"});
+        }
+        asmInstr("move", {"$sp", "$fp"});
+        asmInstr("lw", {"$ra", std::to_string(layout->size - 4) + "($sp)"});
+        asmInstr("lw", {"$fp", std::to_string(layout->size - 8) + "($sp)"});
+        asmInstr("addiu", {"$sp", "$sp", std::to_string(layout->size)});
+    };
+
+    for (size_t index = 0; index < instructions.size(); ++index)
+    {
+        const Instruction &instr = instructions[index];
+        frame = owner[index];
+        layout = frame ? &layouts[frame] : nullptr;
 
         switch (instr.type)
         {
         case InstructionType::LOAD:
-            // إذا كان المعامل تسمية نصية، نحمّل عنوانها
-            if (!instr.operand2.empty() && instr.operand2.rfind("str_", 0) == 0)
+        case InstructionType::STORE:
+        {
+            // LOAD يقبل ثابتاً أو تسمية نصية أو اسماً؛ STORE ينسخ قيمة اسم
+            std::string dest = allocator.registerOf(instr.operand1);
+            if (!dest.empty() && !allocator.inRegister(instr.operand2))
             {
-                file << "la $t0, " << instr.operand2 << std::endl;
-                file << "    sw $t0, " << instr.operand1 << std::endl;
+                load(instr.operand2, dest);
             }
             else
             {
-                bool isNumber = !instr.operand2.empty() &&
-                                (std::isdigit(static_cast<unsigned char>(instr.operand2[0])) ||
-                                 ((instr.operand2[0] == '-' || instr.operand2[0] == '+') && instr.operand2.size() > 1 &&
-                                  std::isdigit(static_cast<unsigned char>(instr.operand2[1]))));
-                if (isNumber)
-                {
-                    file << "li $t0, " << instr.operand2 << std::endl;
-                    file << "    sw $t0, " << instr.operand1 << std::endl;
-                }
-                else
-                {
-                    // اعتبرها متغيرًا/مؤقتًا: حمّل قيمته
-                    file << "lw $t0, " << instr.operand2 << std::endl;
-                    file << "    sw $t0, " << instr.operand1 << std::endl;
-                }
+                writeBack(instr.operand1, load(instr.operand2, "$t8"));
             }
             break;
-
-        case InstructionType::STORE:
-            file << "lw $t0, " << instr.operand2 << std::endl;
-            file << "    sw $t0, " << instr.operand1 << std::endl;
-            break;
+        }
 
         case InstructionType::ADD:
-            file << "lw $t1, " << instr.operand2 << std::endl;
-            file << "    lw $t2, " << instr.operand3 << std::endl;
-            file << "    add $t0, $t1, $t2" << std::endl;
-            file << "    sw $t0, " << instr.operand1 << std::endl;
+            binary("add", instr);
             break;
 
         case InstructionType::SUB:
-            file << "lw $t1, " << instr.operand2 << std::endl;
-            file << "    lw $t2, " << instr.operand3 << std::endl;
-            file << "    sub $t0, $t1, $t2" << std::endl;
-            file << "    sw $t0, " << instr.operand1 << std::endl;
+            binary("sub", instr);
             break;
 
         case InstructionType::MUL:
-            file << "lw $t1, " << instr.operand2 << std::endl;
-            file << "    lw $t2, " << instr.operand3 << std::endl;
-            file << "    mul $t0, $t1, $t2" << std::endl;
-            file << "    sw $t0, " << instr.operand1 << std::endl;
+            binary("mul", instr);
             break;
 
         case InstructionType::DIV:
-            file << "lw $t1, " << instr.operand2 << std::endl;
-            file << "    lw $t2, " << instr.operand3 << std::endl;
-            file << "    div $t0, $t1, $t2" << std::endl;
-            file << "    sw $t0, " << instr.operand1 << std::endl;
+            binary("div", instr);
+            break;
+
+        case InstructionType::MOD:
+        {
+            // div بمعاملين يضع الباقي في hi مباشرة، دون فحص القسمة على صفر في rem
+            std::string left = load(instr.operand2, "$t8");
+            std::string right = load(instr.operand3, "$t9");
+            std::string dest = resultRegister(instr.operand1);
+            asmInstr("div", {left, right});
+            asmInstr("mfhi", {dest});
+            writeBack(instr.operand1, dest);
+            break;
+        }
+
+        case InstructionType::SHL:
+        case InstructionType::SHR:
+        case InstructionType::SAR:
+        {
+            const char *op = instr.type == InstructionType::SHL   ? "sll"
+                             : instr.type == InstructionType::SHR ? "srl"
+                                                                  : "sra";
+            std::string source = load(instr.operand2, "$t8");
+            std::string dest = resultRegister(instr.operand1);
+            asmInstr(op, {dest, source, instr.operand3});
+            writeBack(instr.operand1, dest);
+            break;
+        }
+
+        case InstructionType::BITAND:
+        {
+            std::string source = load(instr.operand2, "$t8");
+            std::string dest = resultRegister(instr.operand1);
+            long long mask = std::stoll(instr.operand3);
+            if (mask >= 0 && mask <= 65535)
+                asmInstr("andi", {dest, source, instr.operand3});
+            else
+            {
+                asmInstr("li", {"$t9", instr.operand3});
+                asmInstr("and", {dest, source, "$t9"});
+            }
+            writeBack(instr.operand1, dest);
             break;
+        }
+
+        case InstructionType::MULHI:
+        {
+            std::string source = load(instr.operand2, "$t8");
+            std::string dest = resultRegister(instr.operand1);
+            asmInstr("li", {"$t9", instr.operand3});
+            asmInstr("mult", {source, "$t9"});
+            asmInstr("mfhi", {dest});
+            writeBack(instr.operand1, dest);
+            break;
+        }
 
         case InstructionType::PRINT:
             if (instr.operand1 == "STRING")
             {
-                file << "li $v0, 4" << std::endl;
-                file << "    la $a0, " << instr.operand2 << std::endl;
-                file << "    syscall" << std::endl;
+                asmInstr("li", {"$v0", "4"});
+                asmInstr("la", {"$a0", instr.operand2});
+                asmInstr("syscall");
             }
             else
             {
-                file << "li $v0, 1" << std::endl;
-                file << "    lw $a0, " << instr.operand2 << std::endl;
-                file << "    syscall" << std::endl;
+                asmInstr("li", {"$v0", "1"});
+                std::string value = load(instr.operand2, "$a0");
+                if (value != "$a0")
+                    asmInstr("move", {"$a0", value});
+                asmInstr("syscall");
             }
-            file << "    li $v0, 4" << std::endl;
-            file << "    la $a0, newline" << std::endl;
-            file << "    syscall" << std::endl;
+            asmInstr("li", {"$v0", "4"});
+            asmInstr("la", {"$a0", "newline"});
+            asmInstr("syscall");
             break;
 
         case InstructionType::READ:
-            file << "li $v0, 5" << std::endl;
-            file << "    syscall" << std::endl;
-            file << "    sw $v0, " << instr.operand1 << std::endl;
+            asmInstr("li", {"$v0", "5"});
+            asmInstr("syscall");
+            writeBack(instr.operand1, "$v0");
             break;
 
         case InstructionType::JMP:
-            file << "j " << instr.operand1 << std::endl;
+            asmInstr("j", {instr.operand1});
             break;
 
         case InstructionType::JZ:
-            file << "lw $t0, " << instr.operand1 << std::endl;
-            file << "    beqz $t0, " << instr.operand2 << std::endl;
+            asmInstr("beqz", {load(instr.operand1, "$t8"), instr.operand2});
+            break;
+
+        case InstructionType::JNZ:
+            asmInstr("bnez", {load(instr.operand1, "$t8"), instr.operand2});
             break;
 
         case InstructionType::LABEL:
-            file << instr.operand1 << ":" << std::endl;
+            text.push_back(MipsInstr::label(instr.operand1));
+            break;
+
+        case InstructionType::LOAD_INDEXED:
+        {
+            std::string address = element(instr.operand2, instr.operand3);
+            std::string dest = resultRegister(instr.operand1);
+            asmInstr("lw", {dest, address});
+            writeBack(instr.operand1, dest);
+            break;
+        }
+
+        case InstructionType::STORE_INDEXED:
+        {
+            std::string address = element(instr.operand1, instr.operand2);
+            asmInstr("sw", {load(instr.operand3, "$t8"), address});
             break;
+        }
+
+        case InstructionType::BOUNDS:
+        {
+            // مقارنة بلا إشارة: الفهرس السالب يصبح عدداً كبيراً فيفشل الشرط نفسه
+            std::string index = load(instr.operand1, "$t8");
+            if (std::stoi(instr.operand2) < 32768)
+                asmInstr("sltiu", {"$t9", index, instr.operand2});
+            else
+            {
+                asmInstr("li", {"$t9", instr.operand2});
+                asmInstr("sltu", {"$t9", index, "$t9"});
+            }
+            asmInstr("beqz", {"$t9", "bounds_error"});
+            break;
+        }
 
         case InstructionType::CMP:
+            // المقارنة تُنفذ مع القفزة الشرطية التالية
             lastCmpLeft = instr.operand1;
             lastCmpRight = instr.operand2;
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    # CMP " << instr.operand1 << ", " << instr.operand2 << std::endl;
+            text.push_back(MipsInstr::comment(instr.toString()));
             break;
 
         case InstructionType::JE:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    beq $t1, $t2, " << instr.operand1 << std::endl;
+            branch("beq", instr.operand1);
             break;
 
         case InstructionType::JNE:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    bne $t1, $t2, " << instr.operand1 << std::endl;
+            branch("bne", instr.operand1);
             break;
 
         case InstructionType::JG:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    bgt $t1, $t2, " << instr.operand1 << std::endl;
+            branch("bgt", instr.operand1);
             break;
 
         case InstructionType::JL:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    blt $t1, $t2, " << instr.operand1 << std::endl;
+            branch("blt", instr.operand1);
             break;
 
         case InstructionType::JGE:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    bge $t1, $t2, " << instr.operand1 << std::endl;
+            branch("bge", instr.operand1);
             break;
 
         case InstructionType::JLE:
-            file << "lw $t1, " << lastCmpLeft << std::endl;
-            file << "    lw $t2, " << lastCmpRight << std::endl;
-            file << "    ble $t1, $t2, " << instr.operand1 << std::endl;
+            branch("ble", instr.operand1);
             break;
 
         case InstructionType::HALT:
-            file << "li $v0, 10" << std::endl;
-            file << "    syscall" << std::endl;
+            asmInstr("li", {"$v0", "10"});
+            asmInstr("syscall");
+            break;
+
+        case InstructionType::FUNC:
+        {
+            // مقدمة الإجراء: حجز الإطار وحفظ $ra و$fp والسجلات المستخدمة
+            const std::string size = std::to_string(layout->size);
+            text.push_back(MipsInstr::label(instr.operand1));
+            asmInstr("addiu", {"$sp", "$sp", "-" + size});
+            asmInstr("sw", {"$ra", std::to_string(layout->size - 4) + "($sp)"});
+            asmInstr("sw", {"$fp", std::to_string(layout->size - 8) + "($sp)"});
+            asmInstr("move", {"$fp", "$sp"});
+            for (const auto &saved : layout->saved)
+            {
+                asmInstr("sw", {saved.first, std::to_string(saved.second) + "($fp)"});
+            }
+
+            // أول أربعة معاملات في $a0-$a3، والباقي فوق الإطار في مكدس المستدعي
+            for (size_t k = 0; k < frame->parameters.size(); ++k)
+            {
+                const std::string &param = frame->parameters[k];
+                std::string source = "$a" + std::to_string(k);
+                if (k >= 4)
+                {
+                    source = "$t8";
+                    asmInstr("lw", {source, std::to_string(layout->size + 4 * static_cast<int>(k - 4)) + "($fp)"});
+                }
+                std::string reg = allocator.registerOf(param);
+                if (reg.empty())
+                    asmInstr("sw", {source, memoryName(param)});
+                else
+                    asmInstr("move", {reg, source});
+            }
+
+            // المتغيرات المحلية تبدأ بصفر في كل استدعاء، والقوائم والسجلات بكل كلماتها
+            for (const auto &local : frame->locals)
+            {
+                std::string reg = allocator.registerOf(local);
+                int words = dataLayout.of(frame->symbols.at(local)).size / 4;
+                if (!reg.empty())
+                    asmInstr("move", {reg, "$zero"});
+                else if (words > 8)
+                {
+                    std::string loop = "clear_" + frame->label + "_" + std::to_string(layout->slots.at(local));
+                    asmInstr("addiu", {"$t8", "$fp", std::to_string(layout->slots.at(local))});
+                    asmInstr("addiu", {"$t9", "$t8", std::to_string(4 * words)});
+                    text.push_back(MipsInstr::label(loop));
+                    asmInstr("sw", {"$zero", "0($t8)"});
+                    asmInstr("addiu", {"$t8", "$t8", "4"});
+                    asmInstr("bne", {"$t8", "$t9", loop});
+                }
+                else
+                {
+                    for (int word = 0; word < words; ++word)
+                    {
+                        asmInstr("sw", {"$zero", std::to_string(layout->slots.at(local) + 4 * word) + "($fp)"});
+                    }
+                }
+            }
+            break;
+        }
+
+        case InstructionType::ARG:
+            pendingArgs.push_back(&instr);
+            break;
+
+        case InstructionType::CALL:
+        {
+            if (!frames.count(instr.operand1))
+            {
+                // إجراء غير معرّف: لا يوجد ما يُقفز إليه
+                text.push_back(MipsInstr::comment(instr.toString()));
+                pendingArgs.clear();
+                break;
+            }
+
+            int stackBytes = pendingArgs.size() > 4 ? 4 * static_cast<int>(pendingArgs.size() - 4) : 0;
+            if (stackBytes > 0)
+                asmInstr("addiu", {"$sp", "$sp", "-" + std::to_string(stackBytes)});
+            for (size_t k = 0; k < pendingArgs.size(); ++k)
+            {
+                const Instruction &arg = *pendingArgs[k];
+                std::string target = k < 4 ? "$a" + std::to_string(k) : "$t8";
+                if (isElementReference(arg))
+                {
+                    // عنوان العنصر: الموضع الذي يحسبه element() بصيغة إزاحة(سجل)
+                    std::string place = element(arg.operand2, arg.operand3);
+                    size_t open = place.find('(');
+                    asmInstr("addiu", {target, place.substr(open + 1, place.size() - open - 2), place.substr(0, open)});
+                }
+                else if (arg.operand3 == "ref")
+                {
+                    // عنوان المتغير: المعامل بالمرجع يمرر العنوان الذي يحمله
+                    if (isReference(arg.operand2))
+                        asmInstr("lw", {target, memoryName(arg.operand2)});
+                    else if (layout && layout->slots.count(arg.operand2))
+                        asmInstr("addiu", {target, "$fp", std::to_string(layout->slots.at(arg.operand2))});
+                    else
+                        asmInstr("la", {target, memoryName(arg.operand2)});
+                }
+                else
+                {
+                    std::string value = load(arg.operand2, target);
+                    if (value != target)
+                        asmInstr("move", {target, value});
+                }
+                if (k >= 4)
+                    asmInstr("sw", {target, std::to_string(4 * static_cast<int>(k - 4)) + "($sp)"});
+            }
+            if (instr.operand3 == "tail" && frame)
+            {
+                // استدعاء أخير: المعاملات في $a0-$a3، فيُحرر الإطار ويعود المستدعى
+                // مباشرة إلى من استدعانا
+                leaveFrame();
+                asmInstr("j", {instr.operand1});
+                pendingArgs.clear();
+                break;
+            }
+            asmInstr("jal", {instr.operand1});
+            if (stackBytes > 0)
+                asmInstr("addiu", {"$sp", "$sp", std::to_string(stackBytes)});
+            pendingArgs.clear();
+            break;
+        }
+
+        case InstructionType::RET:
+            if (!frame)
+            {
+                // إرجاع في البرنامج الرئيسي ينهي التنفيذ
+                asmInstr("li", {"$v0", "10"});
+                asmInstr("syscall");
+                break;
+            }
+            if (!instr.operand1.empty())
+            {
+                std::string value = load(instr.operand1, "$v0");
+                if (value != "$v0")
+                    asmInstr("move", {"$v0", value});
+            }
+            asmInstr("j", {"end_" + frame->label});
             break;
 
         default:
-            file << "# " << instr.toString() << std::endl;
+            text.push_back(MipsInstr::comment(instr.toString()));
             break;
         }
+
+        // خاتمة الإجراء بعد آخر تعليماته: استعادة السجلات والعودة إلى المستدعي
+        if (frame && (index + 1 == instructions.size() || owner[index + 1] != frame))
+        {
+            text.push_back(MipsInstr::label("end_" + frame->label));
+            leaveFrame();
+            asmInstr("jr", {"$ra"});
+        }
     }
 
-    file.close();
-    std::cout << "✅ تم توليد كود التجميع في: " << filename << std::endl;
-}
+    // فشل فحص الحدود: رسالة ثم إنهاء البرنامج برمز 1
+    if (checksBounds)
+    {
+        text.push_back(MipsInstr::label("bounds_error"));
+        asmInstr("li", {"$v0", "4"});
+        asmInstr("la", {"$a0", "bounds_message"});
+        asmInstr("syscall");
+        asmInstr("li", {"$v0", "4"});
+        asmInstr("la", {"$a0", "newline"});
+        asmInstr("syscall");
+        asmInstr("li", {"$v0", "17"});
+        asmInstr("li", {"$a0", "1"});
+        asmInstr("syscall");
+    }
 
-void Compiler::generateCCode(const std::string &filename)
-{
-    std::ofstream file(filename);
-    if (!file.is_open())
+    if (runPeephole)
+    {
+        MipsPeephole peephole(text);
+        peephole.run();
+    }
+
+    for (const auto &line : text)
     {
-        throw std::runtime_error("لا يمكن فتح الملف: " + filename);
+        file << "    " << line.toString() << '\n';
     }
 
-    file << "// كود C مولد للغة العربية" << std::endl;
-    file << "// =======================" << std::endl
-         << std::endl;
+    file.commit(filename);
+}
 
-    file << "#include <stdio.h>" << std::endl;
-    file << "#include <stdlib.h>" << std::endl
-         << std::endl;
+void Compiler::generateX86Assembly(const std::string &filename) const
+{
+    OutputBuffer file;
+
+    X86Generator generator(instructions, instructionFrames(), frames, symbolTable, stringLiterals,
+                           allocateRegisters, recycleTempSlots);
+    generator.generate(file);
+
+    file.commit(filename);
+}
+
+void Compiler::generateX86Object(const std::string &filename) const
+{
+    // الترميز الداخلي نفسه في --run، ثم ELF بدل as
+    std::ostringstream assembly;
+    X86Generator generator(instructions, instructionFrames(), frames, symbolTable, stringLiterals,
+                           allocateRegisters, recycleTempSlots);
+    generator.generate(assembly);
+
+    X86Encoder encoder;
+    encoder.assemble(assembly.str(), true);
+
+    OutputBuffer file;
+    ElfWriter().write(encoder, file);
+    file.commit(filename, true);
+}
+
+void Compiler::generateLLVMCode(const std::string &filename) const
+{
+    OutputBuffer file;
+
+    LLVMGenerator generator(instructions, instructionFrames(), frames, symbolTable, stringLiterals, recordFields);
+    generator.generate(file);
+
+    file.commit(filename);
+}
+
+int Compiler::runProgram()
+{
+    // اختيار التعليمات نفسه في مولد x86-64، ثم ترميز داخلي بدل as وgcc
+    std::ostringstream assembly;
+    X86Generator generator(instructions, instructionFrames(), frames, symbolTable, stringLiterals,
+                           allocateRegisters, recycleTempSlots);
+    generator.generate(assembly);
+
+    X86Encoder encoder;
+    encoder.assemble(assembly.str());
+    return JitRunner().run(encoder);
+}
+
+int Compiler::interpretProgram()
+{
+    auto owner = instructionFrames();
+    BytecodeProgram program = BytecodeCompiler(instructions, owner, frames, symbolTable, stringLiterals).compile();
+    return BytecodeVM(program).run();
+}
+
+void Compiler::generateCCode(const std::string &filename) const
+{
+    OutputBuffer file;
+
+    file << "// كود C مولد للغة العربية\n";
+    file << "// =======================\n\n";
+
+    file << "#include <stdio.h>\n";
+    file << "#include <stdlib.h>\n\n";
 
     // Emit struct definitions for records
     for (const auto &kv : recordDefs)
     {
-        file << kv.second << std::endl;
+        file << kv.second << '\n';
     }
 
-    file << "int main() {" << std::endl;
-
-    // تعريف المتغيرات
-    for (const auto &symbol : symbolTable)
+    // تعريف متغير بنوعه المسجل في جدول الرموز، مصفّراً كما في بقية المولدات
+    // (متغيرات الإطار المحلية لا تُصفَّر في C من تلقاء نفسها)
+    auto declare = [&file](const std::string &indent, const std::string &name, const std::string &meta)
     {
-        const std::string &name = symbol.first;
-        const std::string &meta = symbol.second;
         if (meta.rfind("primitive:", 0) == 0)
         {
             std::string ctype = meta.substr(strlen("primitive:"));
             if (ctype == "char*")
-                file << "    " << ctype << " " << name << " = NULL;" << std::endl;
+                file << indent << ctype << " " << name << " = NULL;\n";
             else
-                file << "    " << ctype << " " << name << " = 0;" << std::endl;
+                file << indent << ctype << " " << name << " = 0;\n";
         }
         else if (meta.rfind("array:", 0) == 0)
         {
@@ -952,42 +1767,136 @@ void Compiler::generateCCode(const std::string &filename)
             {
                 std::string elemC = rest.substr(0, colonPos);
                 std::string len = rest.substr(colonPos + 1);
-                file << "    " << elemC << " " << name << "[" << len << "];" << std::endl;
+                file << indent << elemC << " " << name << "[" << len << "] = {0};\n";
             }
             else
             {
-                file << "    int " << name << " = 0; // malformed array meta" << std::endl;
+                file << indent << "int " << name << " = 0; // malformed array meta\n";
             }
         }
         else if (meta.rfind("record:", 0) == 0)
         {
             std::string structName = meta.substr(strlen("record:"));
-            file << "    struct " << structName << " " << name << ";" << std::endl;
+            file << indent << "struct " << structName << " " << name << " = {0};\n";
         }
         else
         {
-            file << "    int " << name << " = 0;" << std::endl;
+            file << indent << "int " << name << " = 0;\n";
         }
-    }
+    };
 
-    // تعريف المتغيرات المؤقتة
-    for (int i = 0; i < tempVarCounter; i++)
+    // المتغيرات العامة في مستوى الملف حتى تراها الإجراءات
+    for (const auto &symbol : symbolTable)
     {
-        file << "    int t" << i << " = 0;" << std::endl;
+        declare("", symbol.first, symbol.second);
     }
 
     // تعريف السلاسل النصية كمتغيرات ثابتة
     for (size_t i = 0; i < stringLiterals.size(); ++i)
     {
-        file << "    char* str_" << i << " = \"" << stringLiterals[i] << "\";" << std::endl;
+        file << "char* str_" << i << " = \"" << stringLiterals[i] << "\";\n";
+    }
+
+    // كل إجراء ذي إطار يصبح دالة C: المعامل بالمرجع مؤشر يُقرأ عبر (*اسم)
+    std::vector<const ProcedureFrame *> owner = instructionFrames();
+    std::vector<const ProcedureFrame *> functions;
+    for (const auto &instr : instructions)
+    {
+        if (instr.type == InstructionType::FUNC)
+            functions.push_back(&frames.at(instr.operand1));
+    }
+    auto signature = [](const ProcedureFrame &frame)
+    {
+        std::string text = "int " + frame.label + "(";
+        for (size_t k = 0; k < frame.parameters.size(); ++k)
+        {
+            const std::string &param = frame.parameters[k];
+            std::string ctype = frame.symbols.at(param).substr(strlen("primitive:"));
+            text += (k == 0 ? "" : ", ") + ctype + (frame.byReference.count(param) ? " *" : " ") + param;
+        }
+        return text + ")";
+    };
+    if (!functions.empty())
+    {
+        file << '\n';
+        for (const auto *frame : functions)
+        {
+            file << signature(*frame) << ";\n";
+        }
     }
 
-    file << std::endl;
+    // المؤقتات التي لا تتداخل أعمارها تتشارك متغيراً واحداً
+    RegisterAllocator tempSlots(instructions, isTempName);
+    int tempSlotCount = recycleTempSlots ? tempSlots.allocateSlots("t") : tempVarCounter;
+    std::vector<Instruction> code;
+    code.reserve(instructions.size());
+    std::unordered_map<const ProcedureFrame *, std::set<int>> functionTemps;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const Instruction &instr = instructions[i];
+        const ProcedureFrame *frame = owner[i];
+        auto slot = [&](const std::string &name)
+        {
+            if (frame && frame->byReference.count(name))
+                return "(*" + name + ")";
+            std::string renamed = tempSlots.registerOf(name);
+            if (renamed.empty())
+                renamed = name;
+            if (frame && isTempName(renamed))
+                functionTemps[frame].insert(std::stoi(renamed.substr(1)));
+            return renamed;
+        };
+        code.emplace_back(instr.type, slot(instr.operand1), slot(instr.operand2), slot(instr.operand3));
+    }
+
+    file << "\nint main() {\n";
+
+    // تعريف المتغيرات المؤقتة
+    for (int i = 0; i < tempSlotCount; i++)
+    {
+        file << "    int t" << i << " = 0;\n";
+    }
+
+    file << '\n';
 
     std::string lastCmpLeft, lastCmpRight;
+    std::vector<std::string> pendingArgs;
 
-    for (const auto &instr : instructions)
+    for (size_t index = 0; index < code.size(); ++index)
     {
+        const Instruction &instr = code[index];
+        const ProcedureFrame *frame = owner[index];
+
+        if (instr.type == InstructionType::FUNC)
+        {
+            // نهاية الدالة السابقة وبداية دالة الإجراء بمتغيراتها المحلية
+            file << "}\n\n";
+            file << signature(*frame) << " {\n";
+            for (const auto &local : frame->locals)
+            {
+                declare("    ", local, frame->symbols.at(local));
+            }
+            for (int temp : functionTemps[frame])
+            {
+                file << "    int t" << temp << " = 0;\n";
+            }
+            file << '\n';
+            continue;
+        }
+        if (instr.type == InstructionType::ARG)
+        {
+            const std::string &name = instructions[index].operand2;
+            if (!isReferenceArgument(instr))
+                pendingArgs.push_back(instr.operand2);
+            else if (isElementReference(instr))
+                pendingArgs.push_back("&" + name + "[" + instr.operand3 + "]");
+            else if (frame && frame->byReference.count(name))
+                pendingArgs.push_back(name);
+            else
+                pendingArgs.push_back("&" + name);
+            continue;
+        }
+
         file << "    ";
 
         switch (instr.type)
@@ -1013,6 +1922,22 @@ void Compiler::generateCCode(const std::string &filename)
         case InstructionType::MOD:
             file << instr.operand1 << " = " << instr.operand2 << " % " << instr.operand3 << ";";
             break;
+        case InstructionType::SHL:
+            file << instr.operand1 << " = " << instr.operand2 << " << " << instr.operand3 << ";";
+            break;
+        case InstructionType::SHR:
+            file << instr.operand1 << " = (int)((unsigned)" << instr.operand2 << " >> " << instr.operand3 << ");";
+            break;
+        case InstructionType::SAR:
+            file << instr.operand1 << " = " << instr.operand2 << " >> " << instr.operand3 << ";";
+            break;
+        case InstructionType::BITAND:
+            file << instr.operand1 << " = " << instr.operand2 << " & " << instr.operand3 << ";";
+            break;
+        case InstructionType::MULHI:
+            file << instr.operand1 << " = (int)(((long long)" << instr.operand2 << " * " << instr.operand3
+                 << "LL) >> 32);";
+            break;
         case InstructionType::PRINT:
             if (instr.operand1 == "STRING")
             {
@@ -1020,15 +1945,19 @@ void Compiler::generateCCode(const std::string &filename)
             }
             else if (instr.operand1 == "VARIABLE")
             {
-                const auto &varName = instr.operand2;
-                auto it = symbolTable.find(varName);
-                if (it != symbolTable.end() && it->second == "primitive:char*")
+                const auto &varName = instructions[index].operand2;
+                std::string meta;
+                if (frame && frame->owns(varName))
+                    meta = frame->symbols.at(varName);
+                else if (symbolTable.count(varName))
+                    meta = symbolTable.at(varName);
+                if (meta == "primitive:char*")
                 {
-                    file << "printf(\"%s\\n\", " << varName << ");";
+                    file << "printf(\"%s\\n\", " << instr.operand2 << ");";
                 }
                 else
                 {
-                    file << "printf(\"%d\\n\", " << varName << ");";
+                    file << "printf(\"%d\\n\", " << instr.operand2 << ");";
                 }
             }
             else // VALUE for complex expressions, assume numeric
@@ -1045,6 +1974,9 @@ void Compiler::generateCCode(const std::string &filename)
         case InstructionType::JZ:
             file << "if (!" << instr.operand1 << ") goto " << instr.operand2 << ";";
             break;
+        case InstructionType::JNZ:
+            file << "if (" << instr.operand1 << ") goto " << instr.operand2 << ";";
+            break;
         case InstructionType::CMP:
             lastCmpLeft = instr.operand1;
             lastCmpRight = instr.operand2;
@@ -1076,84 +2008,127 @@ void Compiler::generateCCode(const std::string &filename)
             // op1[op2] = op3 -> base[index] = source
             file << instr.operand1 << "[" << instr.operand2 << "] = " << instr.operand3 << ";";
             break;
+        case InstructionType::BOUNDS:
+            file << "if (" << instr.operand1 << " < 0 || " << instr.operand1 << " >= " << instr.operand2
+                 << ") { fprintf(stderr, \"خطأ وقت التنفيذ: فهرس خارج حدود القائمة\\n\"); exit(1); }";
+            break;
         case InstructionType::LABEL:
             file << instr.operand1 << ":";
             break;
         case InstructionType::HALT:
             file << "return 0;";
             break;
+        case InstructionType::CALL:
+            if (frames.count(instr.operand1))
+            {
+                // الاستدعاء الأخير يُكتب return f(...) فيحوله مترجم C إلى قفزة
+                if (instr.operand3 == "tail")
+                    file << "return ";
+                file << instr.operand1 << "(";
+                for (size_t k = 0; k < pendingArgs.size(); ++k)
+                {
+                    file << (k == 0 ? "" : ", ") << pendingArgs[k];
+                }
+                file << ");";
+            }
+            else
+            {
+                file << "// " << instr.toString() << ";";
+            }
+            pendingArgs.clear();
+            break;
+        case InstructionType::RET:
+            file << "return " << (instr.operand1.empty() ? "0" : instr.operand1) << ";";
+            break;
         default:
             file << "// " << instr.toString() << ";";
             break;
         }
 
-        file << std::endl;
+        file << '\n';
     }
 
-    file << "}" << std::endl;
-    file.close();
-    std::cout << "✅ تم توليد كود C في: " << filename << std::endl;
+    file << "}\n";
+    file.commit(filename);
 }
 
-void Compiler::generateIntermediateCode(const std::string &filename)
+void Compiler::generateStructuredCCode(const std::string &filename) const
 {
-    std::ofstream file(filename);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("لا يمكن فتح الملف: " + filename);
-    }
+    OutputBuffer file;
+
+    StructuredCGenerator generator(programTree.get(), checkArrays);
+    generator.generate(file);
+    file.commit(filename);
+}
 
-    file << "الكود الوسيط المولد:" << std::endl;
-    file << "====================" << std::endl
-         << std::endl;
+void Compiler::generateIntermediateCode(const std::string &filename) const
+{
+    OutputBuffer file;
+
+    file << "الكود الوسيط المولد:\n";
+    file << "====================\n\n";
 
     for (size_t i = 0; i < instructions.size(); i++)
     {
-        file << std::setw(3) << i << ": " << instructions[i].toString() << std::endl;
+        file << std::setw(3) << i << ": " << instructions[i].toString() << '\n';
     }
 
-    file << std::endl
-         << "جدول الرموز:" << std::endl;
-    file << "============" << std::endl;
+    file << "\nجدول الرموز:\n";
+    file << "============\n";
     for (const auto &symbol : symbolTable)
     {
-        file << symbol.first << " : " << symbol.second << std::endl;
+        file << symbol.first << " : " << symbol.second << '\n';
     }
 
-    file << std::endl
-         << "السلاسل النصية:" << std::endl;
-    file << "==============" << std::endl;
+    for (const auto &instr : instructions)
+    {
+        if (instr.type != InstructionType::FUNC)
+            continue;
+        const ProcedureFrame &frame = frames.at(instr.operand1);
+        file << "\nإطار " << frame.label << ":\n";
+        for (const auto &param : frame.parameters)
+        {
+            file << "  معامل " << param << " : " << frame.symbols.at(param)
+                 << (frame.byReference.count(param) ? " (بالمرجع)" : "") << '\n';
+        }
+        for (const auto &local : frame.locals)
+        {
+            file << "  محلي " << local << " : " << frame.symbols.at(local) << '\n';
+        }
+    }
+
+    file << "\nالسلاسل النصية:\n";
+    file << "==============\n";
     for (size_t i = 0; i < stringLiterals.size(); ++i)
     {
-        file << "str_" << i << ": \"" << stringLiterals[i] << "\"" << std::endl;
+        file << "str_" << i << ": \"" << stringLiterals[i] << "\"\n";
     }
 
-    file.close();
-    std::cout << "✅ تم توليد الكود الوسيط في: " << filename << std::endl;
+    file.commit(filename);
 }
 
 void Compiler::displayInstructions() const
 {
     if (instructions.empty())
     {
-        std::cout << "⚠️  لا توجد تعليمات وسيطة لعرضها" << std::endl;
+        consoleOutput() << "⚠️  لا توجد تعليمات وسيطة لعرضها" << std::endl;
         return;
     }
 
-    std::cout << "\n🔧 الكود الوسيط المولد:" << std::endl;
-    std::cout << "====================" << std::endl;
+    consoleOutput() << "\n🔧 الكود الوسيط المولد:" << std::endl;
+    consoleOutput() << "====================" << std::endl;
 
     for (size_t i = 0; i < instructions.size(); i++)
     {
-        std::cout << std::setw(3) << i << ": " << instructions[i].toString() << std::endl;
+        consoleOutput() << std::setw(3) << i << ": " << instructions[i].toString() << '\n';
     }
 
-    std::cout << "\n📊 إحصائيات:" << std::endl;
-    std::cout << "عدد التعليمات: " << instructions.size() << std::endl;
-    std::cout << "عدد المتغيرات المؤقتة: " << tempVarCounter << std::endl;
-    std::cout << "عدد العلامات: " << labelCounter << std::endl;
-    std::cout << "عدد السلاسل النصية: " << stringLiterals.size() << std::endl;
-    std::cout << "عدد الرموز في جدول الرموز: " << symbolTable.size() << std::endl;
+    consoleOutput() << "\n📊 إحصائيات:" << std::endl;
+    consoleOutput() << "عدد التعليمات: " << instructions.size() << std::endl;
+    consoleOutput() << "عدد المتغيرات المؤقتة: " << tempVarCounter << std::endl;
+    consoleOutput() << "عدد العلامات: " << labelCounter << std::endl;
+    consoleOutput() << "عدد السلاسل النصية: " << stringLiterals.size() << std::endl;
+    consoleOutput() << "عدد الرموز في جدول الرموز: " << symbolTable.size() << std::endl;
 }
 
 // معالجة تعريف الإجراء
@@ -1162,26 +2137,676 @@ void Compiler::compileProcedureDeclaration(ProcedureDeclarationNode *node)
     if (!node)
         return;
 
-    std::cout << "[DBG] Compiling procedure: " << node->name << std::endl;
+    consoleOutput() << "[DBG] Compiling procedure: " << node->name << std::endl;
 
     // إنشء تسمية فريدة للإجراء
     std::string procLabel = "proc_" + node->name;
     procedureDefs[node->name] = procLabel;
+    procedureNodes[node->name] = node;
 
-    // إصدار تسمية الإجراء
-    emit(InstructionType::LABEL, procLabel);
+    // جسم الإجراء لا يُنفذ عند تعريفه: يُضمّن في مواضع الاستدعاء،
+    // أو يُصدر بعد HALT إذا بقي له استدعاء فعلي (emitCalledProcedures)
+}
 
-    // معالجة جسم الإجراء
-    for (auto &stmt : node->body)
+// نوع C لنوع بسيط في اللغة، أو نص فارغ للمصفوفات والسجلات
+static std::string primitiveCType(TypeNode *type)
+{
+    auto prim = dynamic_cast<PrimitiveTypeNode *>(type);
+    if (!prim)
+        return "";
+    if (prim->name == "حقيقي")
+        return "double";
+    if (prim->name == "خيط")
+        return "char*";
+    return "int";
+}
+
+void Compiler::emitCalledProcedures()
+{
+    // قد تضيف أجسام الإجراءات استدعاءات جديدة إلى القائمة أثناء المرور
+    for (size_t i = 0; i < calledProcedures.size(); ++i)
+    {
+        auto it = procedureNodes.find(calledProcedures[i]);
+        if (it == procedureNodes.end())
+            continue;
+        ProcedureDeclarationNode *node = it->second;
+
+        // إطار الإجراء: المعاملات ثم المتغيرات المحلية، بأسماء خاصة بالإجراء
+        ProcedureFrame &frame = frames[procedureDefs[node->name]];
+        frame.label = procedureDefs[node->name];
+        std::unordered_map<std::string, std::string> scope;
+        for (const auto &param : node->parameters)
+        {
+            std::string ctype = primitiveCType(param.type.get());
+            if (ctype.empty())
+            {
+                throw std::runtime_error("معاملات المصفوفات والسجلات غير مدعومة في الإجراء: " + node->name);
+            }
+            std::string local = node->name + "_" + param.name;
+            frame.parameters.push_back(local);
+            frame.symbols[local] = "primitive:" + ctype;
+            if (param.isByReference)
+                frame.byReference.insert(local);
+            scope[param.name] = local;
+        }
+        for (auto &stmt : node->body)
+        {
+            if (auto decl = dynamic_cast<VariableDeclarationNode *>(stmt.get()))
+                scope[decl->name] = node->name + "_" + decl->name;
+            else if (auto decl = dynamic_cast<ConstantDeclarationNode *>(stmt.get()))
+                scope[decl->name] = node->name + "_" + decl->name;
+        }
+
+        emit(InstructionType::FUNC, frame.label);
+        currentFrame = &frame;
+        inlineScopes.push_back(scope);
+
+        // معالجة جسم الإجراء
+        for (auto &stmt : node->body)
+        {
+            if (stmt)
+            {
+                compileStatement(stmt.get());
+            }
+        }
+
+        inlineScopes.pop_back();
+        currentFrame = nullptr;
+
+        // إذا لم يكن هناك جملة إرجاع، أضف إرجاع افتراضي
+        emit(InstructionType::RET);
+    }
+}
+
+std::string Compiler::resolveName(const std::string &name) const
+{
+    if (inlineScopes.empty())
+        return name;
+
+    // حقول السجلات: يُترجم اسم السجل فقط
+    size_t dot = name.find('.');
+    std::string base = dot == std::string::npos ? name : name.substr(0, dot);
+    const auto &scope = inlineScopes.back();
+    auto it = scope.find(base);
+    if (it == scope.end())
+        return name;
+    return dot == std::string::npos ? it->second : it->second + name.substr(dot);
+}
+
+// هل يصل الإجراء from إلى الإجراء target عبر سلسلة استدعاءات؟
+bool Compiler::callsProcedure(ProcedureDeclarationNode *from, const std::string &target,
+                              std::unordered_set<std::string> &visited)
+{
+    bool found = false;
+    for (auto &stmt : from->body)
+    {
+        walkAST(stmt.get(), [&](ASTNode *node)
+                {
+                    auto call = dynamic_cast<ProcedureCallNode *>(node);
+                    if (!call || found)
+                        return;
+                    if (call->name == target)
+                    {
+                        found = true;
+                        return;
+                    }
+                    auto it = procedureNodes.find(call->name);
+                    if (it != procedureNodes.end() && visited.insert(call->name).second)
+                        found = callsProcedure(it->second, target, visited); });
+        if (found)
+            break;
+    }
+    return found;
+}
+
+bool Compiler::canInline(ProcedureCallNode *node)
+{
+    if (!inlineProcedures)
+        return false;
+    auto it = procedureNodes.find(node->name);
+    if (it == procedureNodes.end())
+        return false;
+    ProcedureDeclarationNode *proc = it->second;
+    if (proc->parameters.size() != node->arguments.size())
+        return false;
+
+    // معيار الحجم: عدد عقد الجسم
+    int size = 0;
+    for (auto &stmt : proc->body)
+        walkAST(stmt.get(), [&size](ASTNode *)
+                { size++; });
+    if (size > inlineThreshold)
+        return false;
+
+    // المعامل بالمرجع يحتاج متغيراً يرتبط به مباشرة
+    for (size_t i = 0; i < proc->parameters.size(); ++i)
+    {
+        if (proc->parameters[i].isByReference &&
+            !dynamic_cast<VariableNode *>(node->arguments[i].get()))
+            return false;
+    }
+
+    std::unordered_set<std::string> visited;
+    return !callsProcedure(proc, proc->name, visited);
+}
+
+void Compiler::inlineProcedureCall(ProcedureCallNode *node)
+{
+    ProcedureDeclarationNode *proc = procedureNodes[node->name];
+    std::unordered_map<std::string, std::string> scope;
+
+    // تُحسب المعاملات في نطاق المستدعي قبل الدخول في نطاق الإجراء
+    for (size_t i = 0; i < proc->parameters.size(); ++i)
+    {
+        const auto &param = proc->parameters[i];
+        if (param.isByReference)
+        {
+            // بالمرجع: اسم المعامل يصبح اسماً آخر لمتغير المستدعي
+            auto var = static_cast<VariableNode *>(node->arguments[i].get());
+            scope[param.name] = resolveName(var->name);
+            continue;
+        }
+
+        // بالقيمة: نسخة خاصة بالإجراء تُهيأ بقيمة المعامل
+        std::string local = node->name + "_" + param.name;
+        std::string ctype = primitiveCType(param.type.get());
+        if (ctype.empty())
+            ctype = "int";
+        declareSymbol(local, "primitive:" + ctype);
+        std::string argTemp = compileExpression(node->arguments[i].get());
+        emit(InstructionType::STORE, local, argTemp);
+        scope[param.name] = local;
+    }
+
+    // متغيرات الإجراء المحلية تأخذ اسماً خاصاً به حتى لا تطغى على متغيرات المستدعي
+    for (auto &stmt : proc->body)
+    {
+        if (auto decl = dynamic_cast<VariableDeclarationNode *>(stmt.get()))
+            scope[decl->name] = node->name + "_" + decl->name;
+        else if (auto decl = dynamic_cast<ConstantDeclarationNode *>(stmt.get()))
+            scope[decl->name] = node->name + "_" + decl->name;
+    }
+
+    std::string exitLabel = generateLabel();
+    inlineScopes.push_back(scope);
+    inlineExitLabels.push_back(exitLabel);
+
+    for (auto &stmt : proc->body)
     {
         if (stmt)
         {
             compileStatement(stmt.get());
         }
+
+        // كل استدعاء يبدأ بمتغيرات محلية صفرية كما في إطار جديد، لا بما تركه
+        // الاستدعاء السابق في المتغير الخاص بالإجراء
+        auto decl = dynamic_cast<VariableDeclarationNode *>(stmt.get());
+        if (decl && !decl->initialValue)
+            emitZeroLocal(resolveName(decl->name));
+    }
+
+    inlineScopes.pop_back();
+    inlineExitLabels.pop_back();
+    emit(InstructionType::LABEL, exitLabel);
+}
+
+// تصفير متغير محلي لإجراء مضمّن: المتغير البسيط بتخزين واحد، والسجل حقلاً
+// حقلاً، والقائمة عنصراً عنصراً حتى 8 عناصر وبحلقة فيما زاد
+void Compiler::emitZeroLocal(const std::string &name)
+{
+    const auto &symbols = currentFrame && currentFrame->owns(name) ? currentFrame->symbols : symbolTable;
+    auto symbol = symbols.find(name);
+    if (symbol == symbols.end() || symbol->second == "ثابت")
+        return;
+    const std::string &meta = symbol->second;
+
+    std::string zero = generateTempVar();
+    emit(InstructionType::LOAD, zero, "0");
+
+    if (meta.rfind("record:", 0) == 0)
+    {
+        auto fields = recordFields.find(meta.substr(7));
+        if (fields == recordFields.end())
+            return;
+        for (const auto &field : fields->second)
+            emit(InstructionType::STORE, name + "." + field.first, zero);
+        return;
+    }
+
+    int length = arrayLength(name);
+    if (length < 0)
+    {
+        emit(InstructionType::STORE, name, zero);
+        return;
+    }
+
+    if (length <= 8)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            std::string index = generateTempVar();
+            emit(InstructionType::LOAD, index, std::to_string(i));
+            emit(InstructionType::STORE_INDEXED, name, index, zero);
+        }
+        return;
+    }
+
+    // عداد الحلقة متغير باسم خاص بالقائمة، مثل عداد كرر
+    std::string counter = name + "_مسح";
+    declareSymbol(counter, "primitive:int");
+    emit(InstructionType::STORE, counter, zero);
+    std::string loopLabel = generateLabel();
+    emit(InstructionType::LABEL, loopLabel);
+    std::string index = generateTempVar();
+    emit(InstructionType::LOAD, index, counter);
+    emit(InstructionType::STORE_INDEXED, name, index, zero);
+    std::string one = generateTempVar();
+    emit(InstructionType::LOAD, one, "1");
+    std::string next = generateTempVar();
+    emit(InstructionType::ADD, next, index, one);
+    emit(InstructionType::STORE, counter, next);
+    std::string limit = generateTempVar();
+    emit(InstructionType::LOAD, limit, std::to_string(length));
+    emit(InstructionType::CMP, next, limit);
+    emit(InstructionType::JL, loopLabel);
+}
+
+// قيمة عددية صحيحة ثابتة مكتوبة مباشرة (مع السالب الأحادي)
+static bool integerConstant(ASTNode *node, long long &value)
+{
+    if (auto unary = dynamic_cast<UnaryOpNode *>(node))
+    {
+        if (unary->op != TokenType::MINUS || !integerConstant(unary->operand.get(), value))
+            return false;
+        value = -value;
+        return true;
+    }
+    auto literal = dynamic_cast<LiteralNode *>(node);
+    if (!literal || literal->literalType != TokenType::NUMBER || literal->value.empty() ||
+        literal->value.size() > 9)
+        return false;
+    for (char c : literal->value)
+    {
+        if (c < '0' || c > '9')
+            return false;
+    }
+    value = std::stoll(literal->value);
+    return true;
+}
+
+// هل يبقى العداد كما تضبطه الحلقة؟ لا يُسند إليه في الجسم ولا يُقرأ من المدخلات،
+// ولا يستدعي الجسم إجراءات قد تغيّره
+static bool iteratorUntouched(ForNode *node)
+{
+    bool untouched = true;
+    for (auto &stmt : node->body)
+    {
+        walkAST(stmt.get(), [&](ASTNode *n)
+                {
+                    if (dynamic_cast<ProcedureCallNode *>(n))
+                        untouched = false;
+                    else if (auto assign = dynamic_cast<AssignmentNode *>(n))
+                    {
+                        auto var = dynamic_cast<VariableNode *>(assign->left.get());
+                        if (var && var->name == node->iteratorName)
+                            untouched = false;
+                    }
+                    else if (auto read = dynamic_cast<ReadNode *>(n))
+                    {
+                        if (read->variableName == node->iteratorName)
+                            untouched = false;
+                    }
+                    else if (auto loop = dynamic_cast<ForNode *>(n))
+                    {
+                        if (loop->iteratorName == node->iteratorName)
+                            untouched = false;
+                    } });
+    }
+    return untouched;
+}
+
+// فك حلقة كرر الداخلية ذات الحدود والخطوة الثابتة. تُفك كاملاً إذا كان عدد
+// الدورات صغيراً، وإلا تُنسخ الجسم unrollFactor مرة في كل دورة وتُكمل الدورات
+// الباقية بعد الحلقة. تُرجع false لتترك الحلقة للترجمة العادية.
+bool Compiler::unrollFor(ForNode *node)
+{
+    long long start, end, step = 1;
+    if (!integerConstant(node->startValue.get(), start) ||
+        !integerConstant(node->endValue.get(), end) ||
+        (node->stepValue && !integerConstant(node->stepValue.get(), step)) || step <= 0)
+        return false;
+
+    // الجسم لا يغيّر العداد ولا يحوي حلقات أو تصريحات
+    if (!iteratorUntouched(node))
+        return false;
+    bool safe = true;
+    int size = 0;
+    for (auto &stmt : node->body)
+    {
+        walkAST(stmt.get(), [&](ASTNode *n)
+                {
+                    size++;
+                    if (dynamic_cast<ForNode *>(n) || dynamic_cast<WhileNode *>(n) ||
+                        dynamic_cast<RepeatNode *>(n) || dynamic_cast<VariableDeclarationNode *>(n) ||
+                        dynamic_cast<ConstantDeclarationNode *>(n))
+                        safe = false; });
+    }
+    if (!safe)
+        return false;
+    size = std::max(size, 1);
+
+    long long trips = start > end ? 0 : (end - start) / step + 1;
+    bool full = trips <= fullUnrollLimit && trips * size <= unrollBudget;
+    if (!full && (unrollFactor < 2 || trips < unrollFactor || size * unrollFactor > unrollBudget))
+        return false;
+
+    const std::string iteratorName = resolveName(node->iteratorName);
+    if (!currentFrame || !currentFrame->owns(iteratorName))
+        symbolTable[iteratorName] = "primitive:int";
+
+    auto compileBody = [&]()
+    {
+        for (auto &stmt : node->body)
+        {
+            if (stmt)
+                compileStatement(stmt.get());
+        }
+    };
+
+    if (full)
+    {
+        // فك كامل: قيمة العداد ثابتة في كل نسخة
+        for (long long k = 0; k < trips; ++k)
+        {
+            long long value = start + k * step;
+            emit(InstructionType::STORE, iteratorName, std::to_string(value));
+            iteratorRanges.push_back(IteratorRange{iteratorName, true, value, value, {}});
+            compileBody();
+            iteratorRanges.pop_back();
+        }
+        emit(InstructionType::STORE, iteratorName, std::to_string(start + trips * step));
+        return true;
+    }
+
+    // فك جزئي: كل دورة تنفذ unrollFactor نسخة، والباقي يُنفذ بعد الحلقة
+    auto advance = [&]()
+    {
+        std::string current = generateTempVar();
+        std::string next = generateTempVar();
+        emit(InstructionType::LOAD, current, iteratorName);
+        emit(InstructionType::ADD, next, current, std::to_string(step));
+        emit(InstructionType::STORE, iteratorName, next);
+        return next;
+    };
+
+    long long blocks = trips / unrollFactor;
+    long long remainder = trips % unrollFactor;
+    std::string loopBodyLabel = generateLabel();
+
+    emit(InstructionType::STORE, iteratorName, std::to_string(start));
+    emit(InstructionType::LABEL, loopBodyLabel);
+    iteratorRanges.push_back(IteratorRange{iteratorName, true, start, start + (trips - 1) * step, {}});
+    std::string next;
+    for (int copy = 0; copy < unrollFactor; ++copy)
+    {
+        compileBody();
+        next = advance();
+    }
+    emit(InstructionType::CMP, next, std::to_string(start + blocks * unrollFactor * step));
+    emit(InstructionType::JL, loopBodyLabel);
+
+    for (long long k = 0; k < remainder; ++k)
+    {
+        compileBody();
+        advance();
+    }
+    iteratorRanges.pop_back();
+    return true;
+}
+
+int Compiler::arrayLength(const std::string &name) const
+{
+    std::string meta;
+    if (currentFrame && currentFrame->owns(name))
+        meta = currentFrame->symbols.at(name);
+    else if (symbolTable.count(name))
+        meta = symbolTable.at(name);
+    if (meta.rfind("array:", 0) != 0)
+        return -1;
+    return std::stoi(meta.substr(meta.rfind(':') + 1));
+}
+
+// مدى قيمة الفهرس وقت الترجمة: ثوابت وعدادات حلقات ذات حدود ثابتة وعمليات + - * عليها
+bool Compiler::indexRange(ASTNode *index, long long &low, long long &high) const
+{
+    const long long limit = 1000000000;
+    long long value;
+    if (integerConstant(index, value))
+    {
+        low = high = value;
+        return true;
+    }
+    if (auto var = dynamic_cast<VariableNode *>(index))
+    {
+        std::string name = resolveName(var->name);
+        for (auto range = iteratorRanges.rbegin(); range != iteratorRanges.rend(); ++range)
+        {
+            if (range->name != name)
+                continue;
+            low = range->low;
+            high = range->high;
+            return range->constant;
+        }
+        return false;
+    }
+    auto binary = dynamic_cast<BinaryOpNode *>(index);
+    long long leftLow, leftHigh, rightLow, rightHigh;
+    if (!binary || !indexRange(binary->left.get(), leftLow, leftHigh) ||
+        !indexRange(binary->right.get(), rightLow, rightHigh))
+        return false;
+    if (std::max({std::llabs(leftLow), std::llabs(leftHigh), std::llabs(rightLow), std::llabs(rightHigh)}) > limit)
+        return false;
+    switch (binary->op)
+    {
+    case TokenType::PLUS:
+        low = leftLow + rightLow;
+        high = leftHigh + rightHigh;
+        return true;
+    case TokenType::MINUS:
+        low = leftLow - rightHigh;
+        high = leftHigh - rightLow;
+        return true;
+    case TokenType::MULTIPLY:
+    {
+        long long products[] = {leftLow * rightLow, leftLow * rightHigh, leftHigh * rightLow, leftHigh * rightHigh};
+        low = *std::min_element(products, products + 4);
+        high = *std::max_element(products, products + 4);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// فهرس على صورة عداد ± ثابت
+bool Compiler::iteratorOffset(ASTNode *index, std::string &iterator, long long &offset) const
+{
+    if (auto var = dynamic_cast<VariableNode *>(index))
+    {
+        iterator = resolveName(var->name);
+        offset = 0;
+        return true;
+    }
+    auto binary = dynamic_cast<BinaryOpNode *>(index);
+    if (!binary || (binary->op != TokenType::PLUS && binary->op != TokenType::MINUS))
+        return false;
+    long long value;
+    if (integerConstant(binary->right.get(), value) && iteratorOffset(binary->left.get(), iterator, offset) &&
+        offset == 0)
+    {
+        offset = binary->op == TokenType::PLUS ? value : -value;
+        return true;
+    }
+    if (binary->op == TokenType::PLUS && integerConstant(binary->left.get(), value) &&
+        iteratorOffset(binary->right.get(), iterator, offset) && offset == 0)
+    {
+        offset = value;
+        return true;
+    }
+    return false;
+}
+
+void Compiler::emitBoundsCheck(ASTNode *index, const std::string &indexTemp, const std::string &arrayName)
+{
+    if (!checkArrays)
+        return;
+    int length = arrayLength(arrayName);
+    if (length < 0)
+        return;
+
+    if (eliminateBoundsChecks)
+    {
+        // فحص زائد: مدى الفهرس كله داخل القائمة
+        long long low, high;
+        if (indexRange(index, low, high) && low >= 0 && high < length)
+            return;
+
+        // أو فُحص مدى العداد كله قبل الحلقة
+        std::string iterator;
+        long long offset;
+        if (iteratorOffset(index, iterator, offset))
+        {
+            for (auto range = iteratorRanges.rbegin(); range != iteratorRanges.rend(); ++range)
+            {
+                if (range->name != iterator)
+                    continue;
+                auto key = std::make_pair(offset, length);
+                if (std::find(range->hoisted.begin(), range->hoisted.end(), key) != range->hoisted.end())
+                    return;
+                break;
+            }
+        }
+    }
+
+    emit(InstructionType::BOUNDS, indexTemp, std::to_string(length));
+}
+
+// يسجل مدى عداد الحلقة لجسمها. إذا لم يُعرف الحدان وقت الترجمة وكانت الخطوة 1
+// والجسم بلا أثر ظاهر تُفحص الفهارس عداد ± ثابت التي تُنفذ في كل دورة مرة
+// واحدة قبل الحلقة على قيمتي البداية والنهاية، فيمر العداد على ما بينهما دون فحص
+bool Compiler::trackIteratorRange(ForNode *node, const std::string &iteratorName, const std::string &startTemp,
+                                  const std::string &endTemp)
+{
+    long long start, end, step = 1;
+    if ((node->stepValue && !integerConstant(node->stepValue.get(), step)) || step <= 0 ||
+        !iteratorUntouched(node))
+        return false;
+
+    if (integerConstant(node->startValue.get(), start) && integerConstant(node->endValue.get(), end))
+    {
+        iteratorRanges.push_back(IteratorRange{iteratorName, true, start, end, {}});
+        return true;
+    }
+
+    // الحد الأعلى يُحسب من جديد في كل دورة: يجب ألا يغيّر الجسم شيئاً منه
+    std::unordered_set<std::string> assigned;
+    bool returns = false, visible = false;
+    for (auto &stmt : node->body)
+    {
+        walkAST(stmt.get(), [&](ASTNode *n)
+                {
+                    if (auto assign = dynamic_cast<AssignmentNode *>(n))
+                    {
+                        if (auto var = dynamic_cast<VariableNode *>(assign->left.get()))
+                            assigned.insert(var->name);
+                    }
+                    else if (auto read = dynamic_cast<ReadNode *>(n))
+                    {
+                        assigned.insert(read->variableName);
+                        visible = true;
+                    }
+                    else if (auto loop = dynamic_cast<ForNode *>(n))
+                        assigned.insert(loop->iteratorName);
+                    else if (dynamic_cast<ReturnNode *>(n))
+                        returns = true;
+                    else if (dynamic_cast<PrintNode *>(n) || dynamic_cast<ProcedureCallNode *>(n))
+                        visible = true; });
+    }
+    bool stableEnd = true;
+    walkAST(node->endValue.get(), [&](ASTNode *n)
+            {
+                if (dynamic_cast<IndexAccessNode *>(n) || dynamic_cast<FieldAccessNode *>(n))
+                    stableEnd = false;
+                else if (auto var = dynamic_cast<VariableNode *>(n))
+                {
+                    if (assigned.count(var->name))
+                        stableEnd = false;
+                } });
+    if (!stableEnd)
+        return false;
+
+    // الفحص المنقول يوقف البرنامج قبل الدورة الأولى، فلا يُنقل من جسم يطبع أو
+    // يقرأ أو يستدعي إجراء: ما تخرجه الدورات السابقة للفهرس الخاطئ يجب أن يظهر
+    IteratorRange range{iteratorName, false, 0, 0, {}};
+    if (step == 1 && !returns && !visible)
+    {
+        // الوصول غير المشروط: جمل الجسم المباشرة، دون الطرف الأيمن من && و||
+        std::function<void(ASTNode *)> scan = [&](ASTNode *expr)
+        {
+            if (auto binary = dynamic_cast<BinaryOpNode *>(expr))
+            {
+                scan(binary->left.get());
+                if (binary->op != TokenType::AND && binary->op != TokenType::OR)
+                    scan(binary->right.get());
+            }
+            else if (auto unary = dynamic_cast<UnaryOpNode *>(expr))
+                scan(unary->operand.get());
+            else if (auto access = dynamic_cast<IndexAccessNode *>(expr))
+            {
+                scan(access->index.get());
+                auto array = dynamic_cast<VariableNode *>(access->variable.get());
+                std::string iterator;
+                long long offset;
+                int length = array ? arrayLength(resolveName(array->name)) : -1;
+                auto key = std::make_pair(0LL, length);
+                if (length >= 0 && iteratorOffset(access->index.get(), iterator, offset) &&
+                    iterator == iteratorName)
+                {
+                    key.first = offset;
+                    if (std::find(range.hoisted.begin(), range.hoisted.end(), key) == range.hoisted.end())
+                        range.hoisted.push_back(key);
+                }
+            }
+        };
+        for (auto &stmt : node->body)
+        {
+            if (auto assign = dynamic_cast<AssignmentNode *>(stmt.get()))
+            {
+                scan(assign->left.get());
+                scan(assign->value.get());
+            }
+            else if (auto print = dynamic_cast<PrintNode *>(stmt.get()))
+                scan(print->expression.get());
+        }
     }
 
-    // إذا لم يكن هناك جملة إرجاع، أضف إرجاع افتراضي
-    emit(InstructionType::RET);
+    for (const auto &key : range.hoisted)
+    {
+        auto shifted = [&](const std::string &temp)
+        {
+            if (key.first == 0)
+                return temp;
+            std::string result = generateTempVar();
+            emit(key.first > 0 ? InstructionType::ADD : InstructionType::SUB, result, temp,
+                 std::to_string(std::llabs(key.first)));
+            return result;
+        };
+        const std::string length = std::to_string(key.second);
+        emit(InstructionType::BOUNDS, shifted(startTemp), length);
+        emit(InstructionType::BOUNDS, shifted(endTemp), length);
+    }
+    iteratorRanges.push_back(range);
+    return true;
 }
 
 // معالجة استدعاء الإجراء
@@ -1190,30 +2815,71 @@ void Compiler::compileProcedureCall(ProcedureCallNode *node)
     if (!node)
         return;
 
-    std::cout << "[DBG] Compiling procedure call: " << node->name << std::endl;
+    consoleOutput() << "[DBG] Compiling procedure call: " << node->name << std::endl;
 
-    // معالجة المعاملات (إذا كانت موجودة)
+    // الإجراءات الصغيرة غير التعاودية تُنسخ في موضع الاستدعاء
+    if (canInline(node))
+    {
+        inlineProcedureCall(node);
+        return;
+    }
+
+    auto proc = procedureNodes.find(node->name);
+    if (proc != procedureNodes.end() && proc->second->parameters.size() != node->arguments.size())
+    {
+        throw std::runtime_error("عدد المعاملات لا يطابق تعريف الإجراء: " + node->name);
+    }
+
+    // تُحسب قيم المعاملات كلها أولاً، ثم تُمرر متتالية قبل الاستدعاء مباشرة
+    std::vector<Instruction> arguments;
     for (size_t i = 0; i < node->arguments.size(); ++i)
     {
-        if (node->arguments[i])
+        bool byReference = proc != procedureNodes.end() && proc->second->parameters[i].isByReference;
+        if (byReference)
+        {
+            // بالمرجع: يُمرر عنوان متغير المستدعي، أو عنوان عنصر القائمة بفهرس يُحسب هنا
+            ASTNode *argument = node->arguments[i].get();
+            if (auto access = dynamic_cast<IndexAccessNode *>(argument))
+            {
+                auto array = dynamic_cast<VariableNode *>(access->variable.get());
+                if (!array || !access->index)
+                {
+                    throw std::runtime_error("المعامل بالمرجع يجب أن يكون متغيراً في استدعاء: " + node->name);
+                }
+                std::string arrayName = resolveName(array->name);
+                std::string indexTemp = compileExpression(access->index.get());
+                emitBoundsCheck(access->index.get(), indexTemp, arrayName);
+                arguments.emplace_back(InstructionType::ARG, std::to_string(i), arrayName, indexTemp);
+                continue;
+            }
+            auto var = dynamic_cast<VariableNode *>(argument);
+            if (!var)
+            {
+                throw std::runtime_error("المعامل بالمرجع يجب أن يكون متغيراً في استدعاء: " + node->name);
+            }
+            arguments.emplace_back(InstructionType::ARG, std::to_string(i), resolveName(var->name), "ref");
+        }
+        else
         {
             std::string argTemp = compileExpression(node->arguments[i].get());
-            // تخزين المعامل في موقع معروف (مثل stack)
-            std::string paramName = "param_" + std::to_string(i);
-            emit(InstructionType::STORE, paramName, argTemp);
+            arguments.emplace_back(InstructionType::ARG, std::to_string(i), argTemp);
         }
     }
+    instructions.insert(instructions.end(), arguments.begin(), arguments.end());
 
     // البحث عن تسمية الإجراء
+    std::string argCount = std::to_string(node->arguments.size());
     auto it = procedureDefs.find(node->name);
     if (it != procedureDefs.end())
     {
-        emit(InstructionType::CALL, it->second);
+        emit(InstructionType::CALL, it->second, argCount);
+        if (std::find(calledProcedures.begin(), calledProcedures.end(), node->name) == calledProcedures.end())
+            calledProcedures.push_back(node->name);
     }
     else
     {
-        std::cerr << "⚠️  تحذير: الإجراء '" << node->name << "' لم يتم تعريفه" << std::endl;
-        emit(InstructionType::CALL, "proc_" + node->name);
+        consoleErrors() << "⚠️  تحذير: الإجراء '" << node->name << "' لم يتم تعريفه" << std::endl;
+        emit(InstructionType::CALL, "proc_" + node->name, argCount);
     }
 }
 
@@ -1227,14 +2893,27 @@ void Compiler::compileReturnStatement(ReturnNode *node)
     }
 
     // إذا كانت هناك قيمة إرجاع، قم بتجميعها
+    std::string returnValueTemp;
     if (node->value)
     {
-        std::string returnValueTemp = compileExpression(node->value.get());
-        // تخزين قيمة الإرجاع في موقع معروف
-        emit(InstructionType::STORE, "return_value", returnValueTemp);
+        returnValueTemp = compileExpression(node->value.get());
+    }
+
+    // داخل إجراء مضمّن تُحفظ القيمة في موقع معروف ويصبح الإرجاع
+    // قفزة إلى نهاية النسخة المضمّنة
+    if (!inlineExitLabels.empty())
+    {
+        if (!returnValueTemp.empty())
+        {
+            symbolTable["return_value"] = "primitive:int";
+            emit(InstructionType::STORE, "return_value", returnValueTemp);
+        }
+        emit(InstructionType::JMP, inlineExitLabels.back());
+        return;
     }
 
-    emit(InstructionType::RET);
+    // في الإجراء ذي الإطار تعود القيمة في سجل الإرجاع
+    emit(InstructionType::RET, returnValueTemp);
 }
 
 // معالجة وصول الحقل
@@ -1252,7 +2931,7 @@ std::string Compiler::compileFieldAccess(FieldAccessNode *node)
         throw std::runtime_error("وصول الحقل يدعم فقط المتغيرات المباشرة حالياً");
     }
 
-    std::string recordName = recordVar->name;
+    std::string recordName = resolveName(recordVar->name);
     std::string fieldName = node->fieldName;
 
     // إنشاء اسم مركب للحقل
@@ -2,6 +2,10 @@
 #define COMPILER_H
 
 #include "Parser.h"
+#include "DataLayout.h"
+#include "Instruction.h"
+#include "PassManager.h"
+#include "ProcedureFrame.h"
 #include <vector>
 #include <string>
 #include <fstream>
@@ -9,147 +13,64 @@
 #include <unordered_set>
 #include <memory>
 
-enum class InstructionType
-{
-    LOAD,
-    STORE,
-    ADD,
-    SUB,
-    MUL,
-    DIV,
-    MOD,
-    JMP,
-    JZ,
-    JNZ,
-    CALL,
-    RET,
-    PRINT,
-    READ,
-    HALT,
-    LABEL,
-    CMP,
-    JE,
-    JNE,
-    JG,
-    JL,
-    JGE,
-    JLE,
-    OR,
-    AND,
-    LOAD_INDEXED, // op1 = op2[op3] -> target = base[index]
-    STORE_INDEXED // op1[op2] = op3 -> base[index] = source
-};
-
-struct Instruction
-{
-    InstructionType type;
-    std::string operand1;
-    std::string operand2;
-    std::string operand3;
-
-    Instruction(InstructionType t, const std::string &op1 = "",
-                const std::string &op2 = "", const std::string &op3 = "")
-        : type(t), operand1(op1), operand2(op2), operand3(op3) {}
-
-    std::string toString() const
-    {
-        switch (type)
-        {
-        case InstructionType::LOAD:
-            return "LOAD " + operand1 + ", " + operand2;
-        case InstructionType::STORE:
-            return "STORE " + operand1 + ", " + operand2;
-        case InstructionType::ADD:
-            if (operand3.empty())
-                return "ADD " + operand1 + ", " + operand2;
-            else
-                return "ADD " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::SUB:
-            if (operand3.empty())
-                return "SUB " + operand1 + ", " + operand2;
-            else
-                return "SUB " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::MUL:
-            if (operand3.empty())
-                return "MUL " + operand1 + ", " + operand2;
-            else
-                return "MUL " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::DIV:
-            if (operand3.empty())
-                return "DIV " + operand1 + ", " + operand2;
-            else
-                return "DIV " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::MOD:
-            if (operand3.empty())
-                return "MOD " + operand1 + ", " + operand2;
-            else
-                return "MOD " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::JMP:
-            return "JMP " + operand1;
-        case InstructionType::JZ:
-            return "JZ " + operand1 + ", " + operand2;
-        case InstructionType::JNZ:
-            return "JNZ " + operand1 + ", " + operand2;
-        case InstructionType::PRINT:
-            return "PRINT " + operand1 + ", " + operand2;
-        case InstructionType::READ:
-            return "READ " + operand1;
-        case InstructionType::HALT:
-            return "HALT";
-        case InstructionType::LABEL:
-            return operand1 + ":";
-        case InstructionType::CMP:
-            return "CMP " + operand1 + ", " + operand2;
-        case InstructionType::JE:
-            return "JE " + operand1;
-        case InstructionType::JNE:
-            return "JNE " + operand1;
-        case InstructionType::JG:
-            return "JG " + operand1;
-        case InstructionType::JL:
-            return "JL " + operand1;
-        case InstructionType::JGE:
-            return "JGE " + operand1;
-        case InstructionType::JLE:
-            return "JLE " + operand1;
-        case InstructionType::OR:
-            if (operand3.empty())
-                return "OR " + operand1 + ", " + operand2;
-            else
-                return "OR " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::AND:
-            if (operand3.empty())
-                return "AND " + operand1 + ", " + operand2;
-            else
-                return "AND " + operand1 + ", " + operand2 + ", " + operand3;
-        case InstructionType::LOAD_INDEXED:
-            return "LOAD_INDEXED " + operand1 + ", " + operand2 + "[" + operand3 + "]";
-        case InstructionType::STORE_INDEXED:
-            return "STORE_INDEXED " + operand1 + "[" + operand2 + "]" + ", " + operand3;
-        default:
-            return "UNKNOWN";
-        }
-    }
-};
-
 class Compiler
 {
 private:
+    std::unique_ptr<ProgramNode> programTree; // تبقى الشجرة للمولدات التي تعمل عليها مباشرة
     std::vector<Instruction> instructions;
     std::unordered_map<std::string, std::string> symbolTable;
     std::unordered_map<std::string, std::string> recordDefs;    // structName -> C struct definition body
+    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> recordFields; // structName -> (field, ctype) بترتيب التعريف
+    DataLayout dataLayout;                                      // أحجام القوائم وإزاحات حقول السجلات لمولد MIPS
     std::unordered_map<std::string, std::string> procedureDefs; // procedureName -> procedure label
+    std::unordered_map<std::string, ProcedureFrame> frames;     // procedure label -> stack frame
+    ProcedureFrame *currentFrame;                               // الإطار الذي تُترجم جمله الآن
     int labelCounter;
     int tempVarCounter;
     std::vector<std::string> stringLiterals;
     std::unordered_map<std::string, std::string> stringToLabel;
 
+    // التضمين: نطاقات أسماء الإجراءات المضمّنة وتسميات الخروج منها
+    std::unordered_map<std::string, ProcedureDeclarationNode *> procedureNodes;
+    std::vector<std::string> calledProcedures; // إجراءات لها CALL فعلي، بترتيب أول استدعاء
+    std::vector<std::unordered_map<std::string, std::string>> inlineScopes;
+    std::vector<std::string> inlineExitLabels;
+    bool inlineProcedures;
+    int inlineThreshold; // أقصى عدد عقد في جسم الإجراء المضمّن
+
+    // فك حلقات كرر ذات الحدود الثابتة
+    bool unrollLoops;
+    int unrollFactor;    // عدد نسخ الجسم في كل دورة عند الفك الجزئي
+    int fullUnrollLimit; // أقصى عدد دورات يُفك كاملاً
+    int unrollBudget;    // أقصى عدد عقد ينتجها الفك (الجسم × النسخ)
+
+    // فحص حدود القوائم: مدى كل عداد حلقة داخل جسمها، وما نُقل من فحوص قبلها
+    struct IteratorRange
+    {
+        std::string name; // اسم العداد بعد resolveName
+        bool constant;    // الحدان low/high معروفان وقت الترجمة
+        long long low, high;
+        std::vector<std::pair<long long, int>> hoisted; // (الإزاحة عن العداد، طول القائمة) المفحوصة قبل الحلقة
+    };
+    bool checkArrays;
+    bool eliminateBoundsChecks;
+    std::vector<IteratorRange> iteratorRanges;
+
+    // خيارات توليد الكود التي يفعّلها مدير التمريرات
+    bool allocateRegisters;
+    bool runPeephole;
+    bool recycleTempSlots;
+
     std::string generateLabel();
     std::string generateTempVar();
     void emit(InstructionType type, const std::string &op1 = "",
               const std::string &op2 = "", const std::string &op3 = "");
 
     std::string getStringLabel(const std::string &literal);
+    void declareSymbol(const std::string &name, const std::string &meta);
+
+    // الإطار الذي تنتمي إليه كل تعليمة (nullptr للبرنامج الرئيسي)
+    std::vector<const ProcedureFrame *> instructionFrames() const;
 
     void compileProgram(ProgramNode *program);
     void compileStatement(ASTNode *statement);
@@ -164,17 +85,53 @@ private:
     void compileFor(ForNode *node);
     void compileProcedureDeclaration(ProcedureDeclarationNode *node);
     void compileProcedureCall(ProcedureCallNode *node);
+    void emitCalledProcedures();
     void compileReturnStatement(ReturnNode *node);
     std::string compileFieldAccess(FieldAccessNode *node);
     std::string compileExpression(ASTNode *expr);
+    void compileCondition(ASTNode *expr, const std::string &target, bool jumpIfTrue);
     std::string compileIndexAccess(IndexAccessNode *node);
 
+    std::string resolveName(const std::string &name) const;
+    bool callsProcedure(ProcedureDeclarationNode *from, const std::string &target,
+                        std::unordered_set<std::string> &visited);
+    bool canInline(ProcedureCallNode *node);
+    void inlineProcedureCall(ProcedureCallNode *node);
+    void emitZeroLocal(const std::string &name);
+    bool unrollFor(ForNode *node);
+    int arrayLength(const std::string &name) const;
+    bool indexRange(ASTNode *index, long long &low, long long &high) const;
+    bool iteratorOffset(ASTNode *index, std::string &iterator, long long &offset) const;
+    void emitBoundsCheck(ASTNode *index, const std::string &indexTemp, const std::string &arrayName);
+    bool trackIteratorRange(ForNode *node, const std::string &iteratorName, const std::string &startTemp,
+                            const std::string &endTemp);
+
 public:
     Compiler();
     std::vector<Instruction> compile(std::unique_ptr<ProgramNode> program);
-    void generateAssembly(const std::string &filename);
-    void generateCCode(const std::string &filename);
-    void generateIntermediateCode(const std::string &filename);
+    // قراءة خيارات الترجمة وتوليد الكود المفعّلة (قبل compile)
+    void configure(const PassManager &passes);
+    // فحص كل وصول لعنصر قائمة وقت التنفيذ (--checked-arrays)
+    void setCheckedArrays(bool enabled) { checkArrays = enabled; }
+    // تشغيل تمريرات الكود الوسيط المفعّلة (بعد compile)
+    void optimize(const PassManager &passes);
+    // المولدات (generate*) لا تغير حالة المترجم، فيمكن تشغيلها معاً على خيوط
+    // منفصلة بعد optimize، وكل منها يكتب ملفه فقط
+    void generateAssembly(const std::string &filename) const;
+    // تجميع x86-64 بصيغة GNU as لواجهة System V يُربط بـ gcc
+    void generateX86Assembly(const std::string &filename) const;
+    // ملف كائن ELF64 (.o) من الكود نفسه دون استدعاء as
+    void generateX86Object(const std::string &filename) const;
+    // LLVM IR نصي يُترجم بـ clang -O2 (--llvm)
+    void generateLLVMCode(const std::string &filename) const;
+    // ترجمة الكود الوسيط إلى كود آلة x86-64 في الذاكرة وتشغيله (--run)، يعيد رمز الخروج
+    int runProgram();
+    // تفسير البرنامج بآلة bytecode المحمولة (--interpret)، ويعيد رمز خروجه
+    int interpretProgram();
+    void generateCCode(const std::string &filename) const;
+    // كود C بحلقات وشروط حقيقية من شجرة الاشتقاق بدل goto
+    void generateStructuredCCode(const std::string &filename) const;
+    void generateIntermediateCode(const std::string &filename) const;
     void displayInstructions() const;
 
     // دالة مساعدة جديدة للتحقق من وجود أخطاء
@@ -0,0 +1,31 @@
+#include "Console.h"
+#include <iostream>
+
+namespace
+{
+    thread_local std::ostream *currentOutput = nullptr;
+    thread_local std::ostream *currentErrors = nullptr;
+}
+
+std::ostream &consoleOutput()
+{
+    return currentOutput ? *currentOutput : std::cout;
+}
+
+std::ostream &consoleErrors()
+{
+    return currentErrors ? *currentErrors : std::cerr;
+}
+
+ConsoleCapture::ConsoleCapture(std::ostream &output, std::ostream &errors)
+    : previousOutput(currentOutput), previousErrors(currentErrors)
+{
+    currentOutput = &output;
+    currentErrors = &errors;
+}
+
+ConsoleCapture::~ConsoleCapture()
+{
+    currentOutput = previousOutput;
+    currentErrors = previousErrors;
+}
@@ -0,0 +1,28 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <ostream>
+
+// ما تطبعه مراحل الترجمة (رسائل التقدم والتحذيرات والأخطاء) يمر بهذين
+// المجريين لا بـ std::cout وstd::cerr مباشرة. هما std::cout وstd::cerr
+// عادةً، أما في الترجمة الدفعية فلكل خيط مجرياه الخاصان، فلا تختلط مخرجات
+// الملفات ولا حالة تنسيقها (setw وhex ...)
+std::ostream &consoleOutput();
+std::ostream &consoleErrors();
+
+// ما دام الكائن موجوداً يكتب الخيط الحالي في output وerrors بدل المخرج العادي
+class ConsoleCapture
+{
+private:
+    std::ostream *previousOutput;
+    std::ostream *previousErrors;
+
+public:
+    ConsoleCapture(std::ostream &output, std::ostream &errors);
+    ~ConsoleCapture();
+
+    ConsoleCapture(const ConsoleCapture &) = delete;
+    ConsoleCapture &operator=(const ConsoleCapture &) = delete;
+};
+
+#endif
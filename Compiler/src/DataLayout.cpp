@@ -0,0 +1,90 @@
+#include "DataLayout.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    TypeLayout primitive(int size)
+    {
+        TypeLayout layout;
+        layout.size = layout.alignment = size;
+        return layout;
+    }
+
+    TypeLayout arrayOf(const TypeLayout &element, int length)
+    {
+        TypeLayout layout;
+        layout.alignment = element.alignment;
+        layout.elementSize = element.size;
+        layout.size = element.size * std::max(1, length);
+        return layout;
+    }
+}
+
+int TypeLayout::fieldOffset(const std::string &field) const
+{
+    for (const auto &entry : fields)
+    {
+        if (entry.first == field)
+            return entry.second;
+    }
+    return -1;
+}
+
+TypeLayout DataLayout::layoutOf(const TypeNode *type) const
+{
+    if (auto prim = dynamic_cast<const PrimitiveTypeNode *>(type))
+    {
+        if (prim->name == "حقيقي")
+            return primitive(8);
+        auto named = namedTypes.find(prim->name);
+        return named == namedTypes.end() ? primitive(4) : named->second;
+    }
+
+    if (auto arr = dynamic_cast<const ArrayTypeNode *>(type))
+        return arrayOf(arr->elementType ? layoutOf(arr->elementType.get()) : primitive(4), arr->length);
+
+    if (auto rec = dynamic_cast<const RecordTypeNode *>(type))
+    {
+        // الحقول بترتيب تعريفها، كل منها على محاذاته، والحجم مضاعف لأكبرها كما في C
+        TypeLayout layout;
+        int offset = 0;
+        for (const auto &field : rec->fields)
+        {
+            TypeLayout fieldLayout = field.type ? layoutOf(field.type.get()) : primitive(4);
+            offset = alignTo(offset, fieldLayout.alignment);
+            layout.fields.emplace_back(field.name, offset);
+            offset += fieldLayout.size;
+            layout.alignment = std::max(layout.alignment, fieldLayout.alignment);
+        }
+        layout.size = std::max(layout.alignment, alignTo(offset, layout.alignment));
+        return layout;
+    }
+
+    return primitive(4);
+}
+
+void DataLayout::declare(const std::string &name, const std::string &meta, const TypeNode *type)
+{
+    TypeLayout layout = layoutOf(type);
+    if (layout.isAggregate())
+        namedTypes[name] = layout;
+    layouts[meta] = std::move(layout);
+}
+
+TypeLayout DataLayout::of(const std::string &meta) const
+{
+    auto it = layouts.find(meta);
+    if (it != layouts.end())
+        return it->second;
+
+    // array:<elem>:<len> من إجراء أو معامل لم يمر بـ declare
+    if (meta.rfind("array:", 0) == 0)
+    {
+        size_t colon = meta.rfind(':');
+        std::string element = meta.substr(strlen("array:"), colon - strlen("array:"));
+        return arrayOf(primitive(element == "double" ? 8 : 4), std::atoi(meta.c_str() + colon + 1));
+    }
+    return primitive(meta == "primitive:double" ? 8 : 4);
+}
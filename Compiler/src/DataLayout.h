@@ -0,0 +1,45 @@
+#ifndef DATA_LAYOUT_H
+#define DATA_LAYOUT_H
+
+#include "AST.h"
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// حجم النوع ومحاذاته في الذاكرة كما يراه مولد MIPS (o32): الصحيح والمنطقي
+// والخيط (مؤشر) 4 بايت، والحقيقي 8 بمحاذاة 8
+struct TypeLayout
+{
+    int size = 4;
+    int alignment = 4;
+    int elementSize = 0;                              // للقوائم: المسافة بين عنصرين متتاليين
+    std::vector<std::pair<std::string, int>> fields; // للسجلات: الحقل وإزاحته بترتيب التعريف
+
+    bool isAggregate() const { return elementSize != 0 || !fields.empty(); }
+    // إزاحة الحقل من بداية السجل، أو -1 إن لم يكن فيه
+    int fieldOffset(const std::string &field) const;
+};
+
+// يحسب تخطيط الأنواع من عقد ArrayTypeNode وRecordTypeNode عند تعريف
+// المتغيرات، ويحفظه بصيغة جدول الرموز (array:... وrecord:...) لتجده
+// المولدات من نوع الاسم في symbolTable أو في إطار الإجراء
+class DataLayout
+{
+private:
+    std::unordered_map<std::string, TypeLayout> namedTypes; // اسم معرف بـ نوع -> تخطيطه
+    std::unordered_map<std::string, TypeLayout> layouts;    // نوع جدول الرموز -> تخطيطه
+
+    static int alignTo(int offset, int alignment) { return (offset + alignment - 1) / alignment * alignment; }
+
+public:
+    TypeLayout layoutOf(const TypeNode *type) const;
+
+    // name معرف بنوع type صيغته في جدول الرموز meta
+    void declare(const std::string &name, const std::string &meta, const TypeNode *type);
+
+    // تخطيط نوع من جدول الرموز؛ ما لم يُعرَّف بعقدة نوع يُحسب من الصيغة نفسها
+    TypeLayout of(const std::string &meta) const;
+};
+
+#endif
@@ -0,0 +1,274 @@
+#include "ElfWriter.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+namespace
+{
+    // ثوابت ELF64 المستخدمة فقط (elf.h غير متاح في كل الأنظمة)
+    enum SectionIndex : uint16_t
+    {
+        SectionNull,
+        SectionText,
+        SectionData,
+        SectionBss,
+        SectionRodata,
+        SectionNote,
+        SectionRela,
+        SectionSymtab,
+        SectionStrtab,
+        SectionShstrtab,
+        SectionCount
+    };
+
+    const uint32_t SHT_PROGBITS = 1, SHT_SYMTAB = 2, SHT_STRTAB = 3, SHT_RELA = 4, SHT_NOBITS = 8;
+    const uint64_t SHF_WRITE = 1, SHF_ALLOC = 2, SHF_EXECINSTR = 4, SHF_INFO_LINK = 0x40;
+    const uint8_t STB_LOCAL = 0, STB_GLOBAL = 1;
+    const uint8_t STT_NOTYPE = 0, STT_FUNC = 2, STT_SECTION = 3;
+    const uint32_t R_X86_64_PC32 = 2, R_X86_64_PLT32 = 4;
+
+    struct Symbol
+    {
+        uint32_t name;
+        uint8_t info;
+        uint16_t section;
+        uint64_t value;
+    };
+
+    struct Relocation
+    {
+        uint64_t offset;
+        uint64_t info;
+        int64_t addend;
+    };
+
+    // كتابة حقول little-endian في مخزن بايتات
+    class Buffer
+    {
+    public:
+        std::vector<uint8_t> bytes;
+
+        void put(uint64_t value, int size)
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+            }
+        }
+        void align(size_t alignment)
+        {
+            bytes.resize((bytes.size() + alignment - 1) / alignment * alignment, 0);
+        }
+        void append(const std::vector<uint8_t> &data)
+        {
+            bytes.insert(bytes.end(), data.begin(), data.end());
+        }
+    };
+
+    class StringTable
+    {
+    public:
+        std::vector<uint8_t> bytes{0};
+
+        uint32_t add(const std::string &name)
+        {
+            uint32_t offset = static_cast<uint32_t>(bytes.size());
+            bytes.insert(bytes.end(), name.begin(), name.end());
+            bytes.push_back(0);
+            return offset;
+        }
+    };
+}
+
+void ElfWriter::write(const X86Encoder &object, std::ostream &out)
+{
+    if (!object.relocatable)
+        throw std::runtime_error("ملف الكائن يتطلب تجميعاً قابلاً لإعادة التموضع");
+
+    using Section = X86Encoder::Section;
+    auto sectionIndex = [](Section section)
+    {
+        return section == Section::Text ? SectionText : section == Section::Data ? SectionRodata : SectionBss;
+    };
+
+    // الرموز: الفارغ، ثم رموز الأقسام، ثم التسميات المحلية (عدا .L)، ثم العامة والخارجية
+    StringTable names;
+    std::vector<Symbol> symbols = {{0, 0, 0, 0}};
+    std::map<uint16_t, uint32_t> sectionSymbols;
+    for (uint16_t section : {SectionText, SectionData, SectionBss, SectionRodata})
+    {
+        sectionSymbols[section] = static_cast<uint32_t>(symbols.size());
+        symbols.push_back({0, static_cast<uint8_t>((STB_LOCAL << 4) | STT_SECTION), section, 0});
+    }
+    std::map<std::string, X86Encoder::Label> ordered(object.labels.begin(), object.labels.end());
+    for (const auto &label : ordered)
+    {
+        const std::string &name = label.first;
+        if (name[0] == '.' || std::count(object.globalSymbols.begin(), object.globalSymbols.end(), name))
+            continue;
+        symbols.push_back({names.add(name), static_cast<uint8_t>((STB_LOCAL << 4) | STT_NOTYPE),
+                           sectionIndex(label.second.section), label.second.offset});
+    }
+    uint32_t firstGlobal = static_cast<uint32_t>(symbols.size());
+
+    std::map<std::string, uint32_t> globalIndex;
+    for (const auto &name : object.globalSymbols)
+    {
+        auto label = object.labels.find(name);
+        if (label == object.labels.end())
+            continue;
+        uint8_t type = label->second.section == Section::Text ? STT_FUNC : STT_NOTYPE;
+        globalIndex[name] = static_cast<uint32_t>(symbols.size());
+        symbols.push_back({names.add(name), static_cast<uint8_t>((STB_GLOBAL << 4) | type),
+                           sectionIndex(label->second.section), label->second.offset});
+    }
+
+    // الإزاحات: القفزات داخل .text تُحل هنا، وما سواها يبقى للرابط
+    std::vector<uint8_t> text = object.text;
+    std::vector<Relocation> relocations;
+    auto write32 = [&text](size_t position, int64_t value)
+    {
+        int32_t field = static_cast<int32_t>(value);
+        std::memcpy(text.data() + position, &field, 4);
+    };
+    for (const auto &fixup : object.fixups)
+    {
+        if (fixup.kind == X86Encoder::Fixup::Kind::Constant)
+        {
+            auto it = object.constants.find(fixup.symbol);
+            if (it == object.constants.end())
+                throw std::runtime_error("ثابت غير معرف في التجميع: " + fixup.symbol);
+            write32(fixup.position, it->second);
+            continue;
+        }
+
+        // الحقل = S + A - P، والمطلوب الهدف - نهاية التعليمة
+        int64_t tail = static_cast<int64_t>(fixup.end - fixup.position);
+        auto label = object.labels.find(fixup.symbol);
+        if (label == object.labels.end())
+        {
+            auto it = globalIndex.find(fixup.symbol);
+            if (it == globalIndex.end())
+            {
+                it = globalIndex.emplace(fixup.symbol, static_cast<uint32_t>(symbols.size())).first;
+                symbols.push_back({names.add(fixup.symbol), static_cast<uint8_t>((STB_GLOBAL << 4) | STT_NOTYPE), 0, 0});
+            }
+            relocations.push_back({fixup.position, (static_cast<uint64_t>(it->second) << 32) | R_X86_64_PLT32, -tail});
+        }
+        else if (label->second.section == Section::Text)
+            write32(fixup.position, static_cast<int64_t>(label->second.offset) - static_cast<int64_t>(fixup.end));
+        else
+        {
+            uint32_t symbol = sectionSymbols.at(sectionIndex(label->second.section));
+            relocations.push_back({fixup.position, (static_cast<uint64_t>(symbol) << 32) | R_X86_64_PC32,
+                                   static_cast<int64_t>(label->second.offset) - tail});
+        }
+    }
+    std::sort(relocations.begin(), relocations.end(), [](const Relocation &a, const Relocation &b)
+              { return a.offset < b.offset; });
+
+    StringTable sectionNames;
+    uint32_t nameOf[SectionCount] = {0};
+    const char *sectionTitles[SectionCount] = {"", ".text", ".data", ".bss", ".rodata", ".note.GNU-stack",
+                                               ".rela.text", ".symtab", ".strtab", ".shstrtab"};
+    for (int i = 1; i < SectionCount; ++i)
+    {
+        nameOf[i] = sectionNames.add(sectionTitles[i]);
+    }
+
+    // محتوى الملف بعد الترويسة، وموضع كل قسم فيه
+    Buffer file;
+    file.bytes.resize(64);
+    uint64_t offsets[SectionCount] = {0}, sizes[SectionCount] = {0};
+    auto place = [&](int section, const std::vector<uint8_t> &data, size_t alignment)
+    {
+        file.align(alignment);
+        offsets[section] = file.bytes.size();
+        sizes[section] = data.size();
+        file.append(data);
+    };
+    place(SectionText, text, 16);
+    place(SectionData, {}, 1);
+    place(SectionRodata, object.data, 16);
+    offsets[SectionBss] = offsets[SectionRodata] + sizes[SectionRodata];
+    sizes[SectionBss] = object.bssSize;
+    place(SectionNote, {}, 1);
+
+    Buffer rela;
+    for (const auto &relocation : relocations)
+    {
+        rela.put(relocation.offset, 8);
+        rela.put(relocation.info, 8);
+        rela.put(static_cast<uint64_t>(relocation.addend), 8);
+    }
+    place(SectionRela, rela.bytes, 8);
+
+    Buffer symtab;
+    for (const auto &symbol : symbols)
+    {
+        symtab.put(symbol.name, 4);
+        symtab.put(symbol.info, 1);
+        symtab.put(0, 1); // STV_DEFAULT
+        symtab.put(symbol.section, 2);
+        symtab.put(symbol.value, 8);
+        symtab.put(0, 8); // الحجم
+    }
+    place(SectionSymtab, symtab.bytes, 8);
+    place(SectionStrtab, names.bytes, 1);
+    place(SectionShstrtab, sectionNames.bytes, 1);
+
+    file.align(8);
+    uint64_t sectionHeaders = file.bytes.size();
+    struct
+    {
+        uint32_t type;
+        uint64_t flags;
+        uint32_t link, info;
+        uint64_t alignment, entrySize;
+    } headers[SectionCount] = {
+        {0, 0, 0, 0, 0, 0},
+        {SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0, 0, 16, 0},
+        {SHT_PROGBITS, SHF_WRITE | SHF_ALLOC, 0, 0, 1, 0},
+        {SHT_NOBITS, SHF_WRITE | SHF_ALLOC, 0, 0, 16, 0},
+        {SHT_PROGBITS, SHF_ALLOC, 0, 0, 16, 0},
+        {SHT_PROGBITS, 0, 0, 0, 1, 0},
+        {SHT_RELA, SHF_INFO_LINK, SectionSymtab, SectionText, 8, 24},
+        {SHT_SYMTAB, 0, SectionStrtab, firstGlobal, 8, 24},
+        {SHT_STRTAB, 0, 0, 0, 1, 0},
+        {SHT_STRTAB, 0, 0, 0, 1, 0}};
+    for (int i = 0; i < SectionCount; ++i)
+    {
+        file.put(nameOf[i], 4);
+        file.put(headers[i].type, 4);
+        file.put(headers[i].flags, 8);
+        file.put(0, 8); // العنوان: يحدده الرابط
+        file.put(offsets[i], 8);
+        file.put(sizes[i], 8);
+        file.put(headers[i].link, 4);
+        file.put(headers[i].info, 4);
+        file.put(headers[i].alignment, 8);
+        file.put(headers[i].entrySize, 8);
+    }
+
+    // ترويسة ELF64: كائن قابل لإعادة التموضع لـ x86-64
+    Buffer header;
+    header.append({0x7F, 'E', 'L', 'F', 2 /* 64 بت */, 1 /* little-endian */, 1 /* EV_CURRENT */, 0 /* System V */});
+    header.put(0, 8);
+    header.put(1, 2);  // ET_REL
+    header.put(62, 2); // EM_X86_64
+    header.put(1, 4);
+    header.put(0, 8); // لا نقطة دخول
+    header.put(0, 8); // لا ترويسات برنامج
+    header.put(sectionHeaders, 8);
+    header.put(0, 4);
+    header.put(64, 2);
+    header.put(0, 2);
+    header.put(0, 2);
+    header.put(64, 2);
+    header.put(SectionCount, 2);
+    header.put(SectionShstrtab, 2);
+    std::copy(header.bytes.begin(), header.bytes.end(), file.bytes.begin());
+
+    out.write(reinterpret_cast<const char *>(file.bytes.data()), static_cast<std::streamsize>(file.bytes.size()));
+}
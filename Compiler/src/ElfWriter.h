@@ -0,0 +1,17 @@
+#ifndef ELF_WRITER_H
+#define ELF_WRITER_H
+
+#include "X86Encoder.h"
+#include <ostream>
+
+// كتابة ناتج X86Encoder ملف كائن ELF64 قابلاً لإعادة التموضع (.o) بلا as:
+// أقسام .text و.data و.rodata و.bss، وجدول رموز، وإزاحات .rela.text
+// لما يقع في قسم آخر أو في مكتبة C. يُربط بـ gcc program.o -o program
+class ElfWriter
+{
+public:
+    // object يجب أن يكون مُجمّعاً بـ assemble(source, true)
+    void write(const X86Encoder &object, std::ostream &out);
+};
+
+#endif
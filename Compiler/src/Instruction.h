@@ -0,0 +1,163 @@
+#ifndef INSTRUCTION_H
+#define INSTRUCTION_H
+
+#include <string>
+
+enum class InstructionType
+{
+    LOAD,
+    STORE,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    MOD,
+    JMP,
+    JZ,
+    JNZ,
+    CALL, // op1 = procedure label, op2 = argument count, op3 = "tail" to reuse the caller's frame
+    RET,  // op1 = optional return value
+    ARG,  // op1 = argument index, op2 = value (or variable name when op3 = "ref", or array when op3 = index temp)
+    FUNC, // op1 = procedure label: start of a procedure with its own stack frame
+    PRINT,
+    READ,
+    HALT,
+    LABEL,
+    CMP,
+    JE,
+    JNE,
+    JG,
+    JL,
+    JGE,
+    JLE,
+    OR,
+    AND,
+    LOAD_INDEXED, // op1 = op2[op3] -> target = base[index]
+    STORE_INDEXED, // op1[op2] = op3 -> base[index] = source
+    BOUNDS,        // op1 = index, op2 = array length: runtime error unless 0 <= index < length
+    SHL,           // op1 = op2 << op3 (op3 = constant shift)
+    SHR,           // op1 = op2 >> op3, logical (zero fill)
+    SAR,           // op1 = op2 >> op3, arithmetic (sign fill)
+    BITAND,        // op1 = op2 & op3 (op3 = constant mask)
+    MULHI          // op1 = high 32 bits of the 64-bit product op2 * op3 (op3 = constant)
+};
+
+struct Instruction
+{
+    InstructionType type;
+    std::string operand1;
+    std::string operand2;
+    std::string operand3;
+
+    Instruction(InstructionType t, const std::string &op1 = "",
+                const std::string &op2 = "", const std::string &op3 = "")
+        : type(t), operand1(op1), operand2(op2), operand3(op3) {}
+
+    std::string toString() const
+    {
+        switch (type)
+        {
+        case InstructionType::LOAD:
+            return "LOAD " + operand1 + ", " + operand2;
+        case InstructionType::STORE:
+            return "STORE " + operand1 + ", " + operand2;
+        case InstructionType::ADD:
+            if (operand3.empty())
+                return "ADD " + operand1 + ", " + operand2;
+            else
+                return "ADD " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::SUB:
+            if (operand3.empty())
+                return "SUB " + operand1 + ", " + operand2;
+            else
+                return "SUB " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::MUL:
+            if (operand3.empty())
+                return "MUL " + operand1 + ", " + operand2;
+            else
+                return "MUL " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::DIV:
+            if (operand3.empty())
+                return "DIV " + operand1 + ", " + operand2;
+            else
+                return "DIV " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::MOD:
+            if (operand3.empty())
+                return "MOD " + operand1 + ", " + operand2;
+            else
+                return "MOD " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::JMP:
+            return "JMP " + operand1;
+        case InstructionType::JZ:
+            return "JZ " + operand1 + ", " + operand2;
+        case InstructionType::JNZ:
+            return "JNZ " + operand1 + ", " + operand2;
+        case InstructionType::CALL:
+            if (operand3.empty())
+                return "CALL " + operand1 + ", " + operand2;
+            else
+                return "CALL " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::RET:
+            return operand1.empty() ? "RET" : "RET " + operand1;
+        case InstructionType::ARG:
+            if (operand3.empty())
+                return "ARG " + operand1 + ", " + operand2;
+            else
+                return "ARG " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::FUNC:
+            return "FUNC " + operand1;
+        case InstructionType::PRINT:
+            return "PRINT " + operand1 + ", " + operand2;
+        case InstructionType::READ:
+            return "READ " + operand1;
+        case InstructionType::HALT:
+            return "HALT";
+        case InstructionType::LABEL:
+            return operand1 + ":";
+        case InstructionType::CMP:
+            return "CMP " + operand1 + ", " + operand2;
+        case InstructionType::JE:
+            return "JE " + operand1;
+        case InstructionType::JNE:
+            return "JNE " + operand1;
+        case InstructionType::JG:
+            return "JG " + operand1;
+        case InstructionType::JL:
+            return "JL " + operand1;
+        case InstructionType::JGE:
+            return "JGE " + operand1;
+        case InstructionType::JLE:
+            return "JLE " + operand1;
+        case InstructionType::OR:
+            if (operand3.empty())
+                return "OR " + operand1 + ", " + operand2;
+            else
+                return "OR " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::AND:
+            if (operand3.empty())
+                return "AND " + operand1 + ", " + operand2;
+            else
+                return "AND " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::LOAD_INDEXED:
+            return "LOAD_INDEXED " + operand1 + ", " + operand2 + "[" + operand3 + "]";
+        case InstructionType::STORE_INDEXED:
+            return "STORE_INDEXED " + operand1 + "[" + operand2 + "]" + ", " + operand3;
+        case InstructionType::BOUNDS:
+            return "BOUNDS " + operand1 + ", " + operand2;
+        case InstructionType::SHL:
+            return "SHL " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::SHR:
+            return "SHR " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::SAR:
+            return "SAR " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::BITAND:
+            return "BITAND " + operand1 + ", " + operand2 + ", " + operand3;
+        case InstructionType::MULHI:
+            return "MULHI " + operand1 + ", " + operand2 + ", " + operand3;
+        default:
+            return "UNKNOWN";
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include "JitRunner.h"
+#include <csignal>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+namespace
+{
+    // مكدس البرنامج: يُحجز عند اللمس فقط، وتحته منطقة حارسة أوسع من أي إطار
+    // حتى يقع الفيض فيها لا في ذاكرة أخرى
+    const size_t programStackSize = size_t(256) << 20;
+    const size_t guardSize = size_t(1) << 20;
+
+    // التشغيل الجاري في هذا الخيط: exit وأخطاء الذاكرة والقسمة تعود إلى
+    // سياق المترجم المحفوظ هنا
+    struct ActiveRun
+    {
+        ucontext_t compiler;
+        void (*entry)();
+        int status;
+        const char *fault;
+        const uint8_t *guard;
+    };
+    thread_local ActiveRun *activeRun = nullptr;
+
+    void programExit(int status)
+    {
+        std::fflush(stdout);
+        activeRun->status = status & 0xFF;
+        setcontext(&activeRun->compiler);
+    }
+
+    void programMain()
+    {
+        activeRun->entry(); // main لا تعود عادة: HALT يستدعي exit
+    }
+
+    void programFault(int signal, siginfo_t *info, void *)
+    {
+        ActiveRun *run = activeRun;
+        if (!run)
+        {
+            // ليس من البرنامج المترجم: يُعاد السلوك الافتراضي فيتكرر الخطأ وينهي العملية
+            std::signal(signal, SIG_DFL);
+            return;
+        }
+        const uint8_t *address = static_cast<const uint8_t *>(info->si_addr);
+        if (signal == SIGFPE)
+            run->fault = info->si_code == FPE_INTDIV ? "خطأ وقت التنفيذ: قسمة على صفر"
+                                                      : "خطأ وقت التنفيذ: فيض في القسمة";
+        else if (address >= run->guard && address < run->guard + guardSize)
+            run->fault = "خطأ وقت التنفيذ: تجاوز عمق الاستدعاءات المسموح";
+        else
+            run->fault = "خطأ وقت التنفيذ: وصول غير صالح إلى الذاكرة";
+        setcontext(&run->compiler);
+    }
+
+    void installFaultHandlers()
+    {
+        static std::once_flag installed;
+        std::call_once(installed, []
+                       {
+                           struct sigaction action = {};
+                           action.sa_sigaction = programFault;
+                           action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+                           sigemptyset(&action.sa_mask);
+                           sigaction(SIGSEGV, &action, nullptr);
+                           sigaction(SIGBUS, &action, nullptr);
+                           sigaction(SIGFPE, &action, nullptr); });
+    }
+}
+
+int JitRunner::run(const X86Encoder &image)
+{
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = (image.imageSize() + page - 1) / page * page;
+    void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+        throw std::runtime_error("تعذر حجز ذاكرة للتشغيل المباشر");
+    uint8_t *base = static_cast<uint8_t *>(memory);
+
+    try
+    {
+        image.link(base, {{"printf", reinterpret_cast<void *>(&std::printf)},
+                          {"scanf", reinterpret_cast<void *>(&std::scanf)},
+                          {"write", reinterpret_cast<void *>(&::write)},
+                          {"exit", reinterpret_cast<void *>(&programExit)}});
+    }
+    catch (...)
+    {
+        munmap(memory, size);
+        throw;
+    }
+
+    // الكود قابل للتنفيذ لا للكتابة، والبيانات بعده للقراءة والكتابة
+    if (mprotect(memory, image.codeSize(), PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(memory, size);
+        throw std::runtime_error("تعذر جعل الكود المولد قابلاً للتنفيذ");
+    }
+
+    void *stack = mmap(nullptr, guardSize + programStackSize, PROT_NONE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (stack == MAP_FAILED ||
+        mprotect(static_cast<uint8_t *>(stack) + guardSize, programStackSize, PROT_READ | PROT_WRITE) != 0)
+    {
+        if (stack != MAP_FAILED)
+            munmap(stack, guardSize + programStackSize);
+        munmap(memory, size);
+        throw std::runtime_error("تعذر حجز مكدس للتشغيل المباشر");
+    }
+
+    // معالج الإشارة يعمل على مكدس بديل، فمكدس البرنامج قد يكون ممتلئاً
+    installFaultHandlers();
+    std::vector<uint8_t> signalStack(1 << 16);
+    stack_t alternate = {}, previousAlternate;
+    alternate.ss_sp = signalStack.data();
+    alternate.ss_size = signalStack.size();
+    sigaltstack(&alternate, &previousAlternate);
+
+    ActiveRun run = {};
+    run.entry = reinterpret_cast<void (*)()>(base + image.entryPoint("main"));
+    run.guard = static_cast<const uint8_t *>(stack);
+    ucontext_t program;
+    getcontext(&program);
+    program.uc_stack.ss_sp = static_cast<uint8_t *>(stack) + guardSize;
+    program.uc_stack.ss_size = programStackSize;
+    program.uc_link = &run.compiler;
+    makecontext(&program, programMain, 0);
+
+    ActiveRun *previous = activeRun;
+    activeRun = &run;
+    swapcontext(&run.compiler, &program);
+    activeRun = previous;
+
+    sigaltstack(&previousAlternate, nullptr);
+    std::fflush(stdout);
+    munmap(stack, guardSize + programStackSize);
+    munmap(memory, size);
+    if (run.fault)
+        throw std::runtime_error(run.fault);
+    return run.status;
+}
+
+#else
+
+int JitRunner::run(const X86Encoder &)
+{
+    throw std::runtime_error("التشغيل المباشر (--run) يتطلب x86-64 على نظام يدعم mmap");
+}
+
+#endif
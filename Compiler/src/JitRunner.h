@@ -0,0 +1,17 @@
+#ifndef JIT_RUNNER_H
+#define JIT_RUNNER_H
+
+#include "X86Encoder.h"
+
+// تشغيل كود x86-64 المرمّز داخل عملية المترجم (--run): تُنسخ الصورة إلى
+// ذاكرة من mmap، ويصبح الكود قابلاً للتنفيذ، ثم تُستدعى main على مكدس خاص
+// بها. exit في البرنامج تعود إلى هنا بدل إنهاء المترجم، وفيض المكدس أو
+// القسمة على صفر أو الوصول الخاطئ للذاكرة يصبح استثناء بدل انهيار المترجم
+class JitRunner
+{
+public:
+    // يعيد رمز خروج البرنامج
+    int run(const X86Encoder &image);
+};
+
+#endif
@@ -0,0 +1,887 @@
+#include "LLVMGenerator.h"
+#include "CFG.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+
+namespace
+{
+    const char *boundsMessage = "خطأ وقت التنفيذ: فهرس خارج حدود القائمة\n";
+
+    // محتوى c"..." في LLVM: ما عدا ASCII المطبوع يُكتب \XX
+    std::string escapeBytes(const std::string &text)
+    {
+        std::string result;
+        char hex[4];
+        for (unsigned char ch : text)
+        {
+            if (ch >= 0x20 && ch < 0x7F && ch != '"' && ch != '\\')
+                result += static_cast<char>(ch);
+            else
+            {
+                std::snprintf(hex, sizeof(hex), "\\%02X", ch);
+                result += hex;
+            }
+        }
+        return result;
+    }
+
+    // الثوابت الحقيقية بنمط بتاتها السداسي عشر، فتبقى دقيقة دائماً
+    std::string doubleConstant(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        char text[24];
+        std::snprintf(text, sizeof(text), "0x%016llX", static_cast<unsigned long long>(bits));
+        return text;
+    }
+
+    // قيمة البدء الصفرية لكل نوع، كما في تعريفات كود C
+    std::string zeroOf(const std::string &type)
+    {
+        if (type[0] == '[' || type[0] == '%')
+            return "zeroinitializer";
+        if (type == "double")
+            return "0.0";
+        if (type == "i8*")
+            return "null";
+        return "0";
+    }
+
+    std::string formatPointer(const char *name, size_t length)
+    {
+        std::string array = "[" + std::to_string(length) + " x i8]";
+        return "i8* getelementptr inbounds (" + array + ", " + array + "* @" + name + ", i64 0, i64 0)";
+    }
+}
+
+LLVMGenerator::LLVMGenerator(const std::vector<Instruction> &code, std::vector<const ProcedureFrame *> owner,
+                             const std::unordered_map<std::string, ProcedureFrame> &frames,
+                             const std::unordered_map<std::string, std::string> &symbolTable,
+                             const std::vector<std::string> &stringLiterals,
+                             const std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> &recordFields)
+    : code(code), owner(std::move(owner)), frames(frames), symbolTable(symbolTable), stringLiterals(stringLiterals),
+      recordFields(recordFields), out(nullptr), frame(nullptr), valueCounter(0), blockCounter(0), terminated(false)
+{
+}
+
+std::string LLVMGenerator::quoted(const std::string &name)
+{
+    // الأسماء العربية تبقى كما هي بين علامتي تنصيص
+    return "\"" + name + "\"";
+}
+
+std::string LLVMGenerator::typeOfC(const std::string &ctype)
+{
+    if (ctype == "double")
+        return "double";
+    if (ctype == "char*")
+        return "i8*";
+    return "i32";
+}
+
+std::string LLVMGenerator::typeOfMeta(const std::string &meta) const
+{
+    if (meta.rfind("primitive:", 0) == 0)
+        return typeOfC(meta.substr(strlen("primitive:")));
+    if (meta.rfind("array:", 0) == 0)
+    {
+        // format: array:<elemC>:<len>
+        std::string rest = meta.substr(strlen("array:"));
+        size_t colon = rest.find(':');
+        if (colon != std::string::npos)
+            return "[" + rest.substr(colon + 1) + " x " + typeOfC(rest.substr(0, colon)) + "]";
+    }
+    if (meta.rfind("record:", 0) == 0)
+        return "%" + quoted(meta.substr(strlen("record:")));
+    return "i32";
+}
+
+std::string LLVMGenerator::metaOf(const std::string &name) const
+{
+    if (frame && frame->owns(name))
+        return frame->symbols.at(name);
+    auto it = symbolTable.find(name);
+    return it == symbolTable.end() ? "" : it->second;
+}
+
+bool LLVMGenerator::fieldOf(const std::string &name, std::string &record, int &index, std::string &type) const
+{
+    // "سجل.حقل" عنصر في بنية السجل إذا عُرف السجل وحقله
+    size_t dot = name.find('.');
+    if (dot == std::string::npos || isNumericOperand(name))
+        return false;
+    record = name.substr(0, dot);
+    std::string meta = metaOf(record);
+    if (meta.rfind("record:", 0) != 0)
+        return false;
+    auto fields = recordFields.find(meta.substr(strlen("record:")));
+    if (fields == recordFields.end())
+        return false;
+    for (size_t i = 0; i < fields->second.size(); ++i)
+    {
+        if (fields->second[i].first == name.substr(dot + 1))
+        {
+            index = static_cast<int>(i);
+            type = typeOfC(fields->second[i].second);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string LLVMGenerator::typeOf(const std::string &name) const
+{
+    if (isTempName(name) && !(frame && frame->owns(name)))
+    {
+        auto it = tempTypes.find(name);
+        return it == tempTypes.end() ? "i32" : it->second;
+    }
+    std::string record, type;
+    int index;
+    if (fieldOf(name, record, index, type))
+        return type;
+    return typeOfMeta(metaOf(name));
+}
+
+std::string LLVMGenerator::operandType(const std::string &operand) const
+{
+    if (operand == "صح" || operand == "خطأ")
+        return "i32";
+    if (operand.rfind("str_", 0) == 0)
+        return "i8*";
+    if (isNumericOperand(operand))
+        return operand.find('.') != std::string::npos ? "double" : "i32";
+    return typeOf(operand);
+}
+
+void LLVMGenerator::inferTempTypes()
+{
+    // المؤقت قد يُعرّف أكثر من مرة (نتيجة && و|| وعداد الحلقة)، فيأخذ أوسع
+    // أنواع تعريفاته: double ثم i8* ثم i32. تُعاد الجولة حتى يستقر كل نوع
+    // لأن مؤقتاً قد يُعرّف من مؤقت يأتي تعريفه بعده في حلقة
+    auto rank = [](const std::string &type)
+    {
+        return type == "double" ? 2 : type == "i8*" ? 1 : 0;
+    };
+    tempTypes.clear();
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 0; i < code.size(); ++i)
+        {
+            const Instruction &instr = code[i];
+            frame = owner[i];
+            std::string def = getDefinedName(instr);
+            if (!isTempName(def) || (frame && frame->owns(def)))
+                continue;
+
+            std::string type = "i32";
+            switch (instr.type)
+            {
+            case InstructionType::LOAD:
+            case InstructionType::STORE:
+                type = operandType(instr.operand2);
+                break;
+            case InstructionType::ADD:
+            case InstructionType::SUB:
+            case InstructionType::MUL:
+            case InstructionType::DIV:
+            {
+                const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+                const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+                if (operandType(left) == "double" || operandType(right) == "double")
+                    type = "double";
+                break;
+            }
+            case InstructionType::LOAD_INDEXED:
+            {
+                std::string arrayType = typeOf(instr.operand2);
+                size_t x = arrayType.find(" x ");
+                if (arrayType[0] == '[' && x != std::string::npos)
+                    type = arrayType.substr(x + 3, arrayType.size() - x - 4);
+                break;
+            }
+            default:
+                break;
+            }
+
+            auto it = tempTypes.find(def);
+            if (it == tempTypes.end() || rank(type) > rank(it->second))
+            {
+                tempTypes[def] = type;
+                changed = true;
+            }
+        }
+    }
+    frame = nullptr;
+}
+
+std::string LLVMGenerator::fresh()
+{
+    return "%.v" + std::to_string(valueCounter++);
+}
+
+std::string LLVMGenerator::freshBlock()
+{
+    return ".b" + std::to_string(blockCounter++);
+}
+
+void LLVMGenerator::line(const std::string &text)
+{
+    // تعليمات بعد قفزة غير مشروطة تبدأ كتلة لا يصلها شيء
+    if (terminated)
+        startBlock(freshBlock());
+    *out << "  " << text << "\n";
+}
+
+void LLVMGenerator::terminate(const std::string &text)
+{
+    line(text);
+    terminated = true;
+}
+
+void LLVMGenerator::startBlock(const std::string &label)
+{
+    if (!terminated)
+        *out << "  br label %" << label << "\n";
+    *out << label << ":\n";
+    terminated = false;
+}
+
+std::string LLVMGenerator::address(const std::string &name)
+{
+    std::string record, type;
+    int index;
+    if (fieldOf(name, record, index, type))
+    {
+        std::string structType = typeOf(record);
+        std::string pointer = fresh();
+        line(pointer + " = getelementptr inbounds " + structType + ", " + structType + "* " + address(record) +
+             ", i32 0, i32 " + std::to_string(index));
+        return pointer;
+    }
+    auto it = locals.find(name);
+    if (it != locals.end())
+        return it->second;
+    return "@" + quoted(name);
+}
+
+std::string LLVMGenerator::stringConstant(size_t index) const
+{
+    std::string array = "[" + std::to_string(stringLiterals.at(index).size() + 1) + " x i8]";
+    return "getelementptr inbounds (" + array + ", " + array + "* @.str." + std::to_string(index) + ", i64 0, i64 0)";
+}
+
+LLVMGenerator::Value LLVMGenerator::load(const std::string &operand)
+{
+    if (operand == "صح")
+        return {"1", "i32"};
+    if (operand == "خطأ")
+        return {"0", "i32"};
+    if (operand.rfind("str_", 0) == 0)
+        return {stringConstant(std::stoul(operand.substr(4))), "i8*"};
+    if (isNumericOperand(operand))
+    {
+        if (operand.find('.') != std::string::npos)
+            return {doubleConstant(std::stod(operand)), "double"};
+        return {std::to_string(static_cast<int32_t>(std::stoll(operand))), "i32"};
+    }
+
+    std::string type = typeOf(operand);
+    std::string pointer = address(operand);
+    std::string value = fresh();
+    line(value + " = load " + type + ", " + type + "* " + pointer);
+    return {value, type};
+}
+
+LLVMGenerator::Value LLVMGenerator::convert(const Value &value, const std::string &type)
+{
+    if (value.type == type)
+        return value;
+
+    // التحويلات الضمنية في C عند الإسناد أو الحساب المختلط
+    std::string op;
+    if (value.type == "i32" && type == "double")
+        op = "sitofp";
+    else if (value.type == "double" && type == "i32")
+        op = "fptosi";
+    else if (value.type == "i8*" && type == "i32")
+        op = "ptrtoint";
+    else if (value.type == "i32" && type == "i8*")
+        op = "inttoptr";
+    else
+        return convert(convert(value, "i32"), type);
+
+    std::string result = fresh();
+    line(result + " = " + op + " " + value.type + " " + value.text + " to " + type);
+    return {result, type};
+}
+
+void LLVMGenerator::store(const std::string &name, const Value &value)
+{
+    std::string type = typeOf(name);
+    Value converted = convert(value, type);
+    std::string pointer = address(name);
+    line("store " + type + " " + converted.text + ", " + type + "* " + pointer);
+}
+
+std::string LLVMGenerator::element(const std::string &arrayName, const std::string &index, std::string &type)
+{
+    std::string arrayType = typeOf(arrayName);
+    Value position = convert(load(index), "i32");
+    std::string wide = fresh();
+    line(wide + " = sext i32 " + position.text + " to i64");
+
+    std::string pointer = fresh();
+    size_t x = arrayType.find(" x ");
+    if (arrayType[0] == '[' && x != std::string::npos)
+    {
+        type = arrayType.substr(x + 3, arrayType.size() - x - 4);
+        line(pointer + " = getelementptr inbounds " + arrayType + ", " + arrayType + "* " + address(arrayName) +
+             ", i64 0, i64 " + wide);
+    }
+    else
+    {
+        type = arrayType;
+        line(pointer + " = getelementptr inbounds " + type + ", " + type + "* " + address(arrayName) + ", i64 " + wide);
+    }
+    return pointer;
+}
+
+void LLVMGenerator::printf(const std::string &format, const Value &value)
+{
+    line("call i32 (i8*, ...) @printf(" + format + ", " + value.type + " " + value.text + ")");
+}
+
+void LLVMGenerator::binary(const Instruction &instr)
+{
+    const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+    const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+    Value a = load(left);
+    Value b = load(right);
+
+    if (instr.type == InstructionType::AND || instr.type == InstructionType::OR)
+    {
+        std::string x = fresh(), y = fresh(), both = fresh(), result = fresh();
+        a = convert(a, "i32");
+        b = convert(b, "i32");
+        line(x + " = icmp ne i32 " + a.text + ", 0");
+        line(y + " = icmp ne i32 " + b.text + ", 0");
+        line(both + " = " + (instr.type == InstructionType::AND ? "and" : "or") + " i1 " + x + ", " + y);
+        line(result + " = zext i1 " + both + " to i32");
+        store(instr.operand1, {result, "i32"});
+        return;
+    }
+
+    // حقيقي في أي طرف يجعل العملية حقيقية، وإلا فهي على int
+    bool real = (a.type == "double" || b.type == "double") && instr.type != InstructionType::MOD;
+    std::string type = real ? "double" : "i32";
+    a = convert(a, type);
+    b = convert(b, type);
+
+    std::string op;
+    switch (instr.type)
+    {
+    case InstructionType::ADD:
+        op = real ? "fadd" : "add";
+        break;
+    case InstructionType::SUB:
+        op = real ? "fsub" : "sub";
+        break;
+    case InstructionType::MUL:
+        op = real ? "fmul" : "mul";
+        break;
+    case InstructionType::DIV:
+        op = real ? "fdiv" : "sdiv";
+        break;
+    default:
+        op = "srem";
+        break;
+    }
+    std::string result = fresh();
+    line(result + " = " + op + " " + type + " " + a.text + ", " + b.text);
+    store(instr.operand1, {result, type});
+}
+
+void LLVMGenerator::branch(const std::string &predicate, const std::string &left, const std::string &right,
+                           const std::string &label)
+{
+    Value a = load(left);
+    Value b = load(right);
+    std::string type = "i32";
+    if (a.type == "double" || b.type == "double")
+        type = "double";
+    else if (a.type == "i8*" && b.type == "i8*")
+        type = "i8*";
+    a = convert(a, type);
+    b = convert(b, type);
+
+    // fcmp بالمقارنات المرتبة، و!= غير مرتبة كما في C
+    static const std::unordered_map<std::string, std::pair<std::string, std::string>> predicates = {
+        {"eq", {"eq", "oeq"}}, {"ne", {"ne", "une"}}, {"gt", {"sgt", "ogt"}},
+        {"lt", {"slt", "olt"}}, {"ge", {"sge", "oge"}}, {"le", {"sle", "ole"}}};
+    const auto &names = predicates.at(predicate);
+    std::string condition = fresh();
+    if (type == "double")
+        line(condition + " = fcmp " + names.second + " double " + a.text + ", " + b.text);
+    else
+        line(condition + " = icmp " + names.first + " " + type + " " + a.text + ", " + b.text);
+
+    std::string next = freshBlock();
+    terminate("br i1 " + condition + ", label %" + label + ", label %" + next);
+    startBlock(next);
+}
+
+void LLVMGenerator::call(const Instruction &instr)
+{
+    auto procedure = frames.find(instr.operand1);
+    if (procedure == frames.end())
+    {
+        line("; " + instr.toString());
+        pendingArgs.clear();
+        return;
+    }
+
+    // المعامل بالمرجع يأخذ عنوان متغير المستدعي، والمعامل بالقيمة يُحوّل إلى نوعه
+    const ProcedureFrame &callee = procedure->second;
+    std::string args;
+    for (const Instruction *arg : pendingArgs)
+    {
+        size_t k = std::stoul(arg->operand1);
+        if (k >= callee.parameters.size())
+            continue;
+        const std::string &param = callee.parameters[k];
+        std::string type = typeOfMeta(callee.symbols.at(param));
+        if (!args.empty())
+            args += ", ";
+        if (callee.byReference.count(param))
+        {
+            std::string actual;
+            std::string pointer;
+            if (isElementReference(*arg))
+                pointer = element(arg->operand2, arg->operand3, actual);
+            else
+            {
+                pointer = address(arg->operand2);
+                actual = typeOf(arg->operand2);
+            }
+            if (actual != type)
+            {
+                std::string cast = fresh();
+                line(cast + " = bitcast " + actual + "* " + pointer + " to " + type + "*");
+                pointer = cast;
+            }
+            args += type + "* " + pointer;
+        }
+        else
+        {
+            Value value = convert(load(arg->operand2), type);
+            args += type + " " + value.text;
+        }
+    }
+    pendingArgs.clear();
+
+    // الاستدعاء الأخير: return f(...) كما في كود C فيحوله LLVM إلى قفزة
+    std::string result = fresh();
+    bool tail = instr.operand3 == "tail";
+    line(result + " = " + (tail ? "tail call" : "call") + " i32 @" + quoted(instr.operand1) + "(" + args + ")");
+    if (tail)
+        terminate("ret i32 " + result);
+}
+
+void LLVMGenerator::lower(const Instruction &instr)
+{
+    switch (instr.type)
+    {
+    case InstructionType::LOAD:
+    case InstructionType::STORE:
+        store(instr.operand1, load(instr.operand2));
+        break;
+
+    case InstructionType::ADD:
+    case InstructionType::SUB:
+    case InstructionType::MUL:
+    case InstructionType::DIV:
+    case InstructionType::MOD:
+    case InstructionType::AND:
+    case InstructionType::OR:
+        binary(instr);
+        break;
+
+    case InstructionType::SHL:
+    case InstructionType::SHR:
+    case InstructionType::SAR:
+    case InstructionType::BITAND:
+    {
+        static const std::unordered_map<int, std::string> ops = {
+            {static_cast<int>(InstructionType::SHL), "shl"},
+            {static_cast<int>(InstructionType::SHR), "lshr"},
+            {static_cast<int>(InstructionType::SAR), "ashr"},
+            {static_cast<int>(InstructionType::BITAND), "and"}};
+        Value a = convert(load(instr.operand2), "i32");
+        std::string result = fresh();
+        line(result + " = " + ops.at(static_cast<int>(instr.type)) + " i32 " + a.text + ", " + instr.operand3);
+        store(instr.operand1, {result, "i32"});
+        break;
+    }
+
+    case InstructionType::MULHI:
+    {
+        // (int)(((long long)a * M) >> 32)
+        Value a = convert(load(instr.operand2), "i32");
+        std::string wide = fresh(), product = fresh(), high = fresh(), result = fresh();
+        line(wide + " = sext i32 " + a.text + " to i64");
+        line(product + " = mul i64 " + wide + ", " + instr.operand3);
+        line(high + " = ashr i64 " + product + ", 32");
+        line(result + " = trunc i64 " + high + " to i32");
+        store(instr.operand1, {result, "i32"});
+        break;
+    }
+
+    case InstructionType::LOAD_INDEXED:
+    {
+        std::string type;
+        std::string pointer = element(instr.operand2, instr.operand3, type);
+        std::string value = fresh();
+        line(value + " = load " + type + ", " + type + "* " + pointer);
+        store(instr.operand1, {value, type});
+        break;
+    }
+
+    case InstructionType::STORE_INDEXED:
+    {
+        std::string type;
+        std::string pointer = element(instr.operand1, instr.operand2, type);
+        Value value = convert(load(instr.operand3), type);
+        line("store " + type + " " + value.text + ", " + type + "* " + pointer);
+        break;
+    }
+
+    case InstructionType::BOUNDS:
+    {
+        // الفهرس السالب يصبح كبيراً بلا إشارة، فمقارنة واحدة تكفي
+        Value index = convert(load(instr.operand1), "i32");
+        std::string outside = fresh();
+        line(outside + " = icmp uge i32 " + index.text + ", " + instr.operand2);
+        std::string failed = freshBlock(), next = freshBlock();
+        terminate("br i1 " + outside + ", label %" + failed + ", label %" + next);
+        startBlock(failed);
+        line("call void @rt.bounds_error()");
+        terminate("unreachable");
+        startBlock(next);
+        break;
+    }
+
+    case InstructionType::CMP:
+        // المقارنة تُولد مع القفزة الشرطية التالية
+        lastCmpLeft = instr.operand1;
+        lastCmpRight = instr.operand2;
+        break;
+
+    case InstructionType::JE:
+        branch("eq", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+    case InstructionType::JNE:
+        branch("ne", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+    case InstructionType::JG:
+        branch("gt", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+    case InstructionType::JL:
+        branch("lt", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+    case InstructionType::JGE:
+        branch("ge", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+    case InstructionType::JLE:
+        branch("le", lastCmpLeft, lastCmpRight, instr.operand1);
+        break;
+
+    case InstructionType::JZ:
+    case InstructionType::JNZ:
+    {
+        branch(instr.type == InstructionType::JZ ? "eq" : "ne", instr.operand1, "0", instr.operand2);
+        break;
+    }
+
+    case InstructionType::JMP:
+        terminate("br label %" + instr.operand1);
+        break;
+
+    case InstructionType::LABEL:
+        startBlock(instr.operand1);
+        break;
+
+    case InstructionType::PRINT:
+    {
+        if (instr.operand1 == "STRING")
+        {
+            printf(formatPointer(".fmt.str", 4), load(instr.operand2));
+            break;
+        }
+        Value value = load(instr.operand2);
+        if (instr.operand1 == "VARIABLE" && value.type == "i8*")
+            printf(formatPointer(".fmt.str", 4), value);
+        else if (value.type == "double")
+            printf(formatPointer(".fmt.real", 4), value);
+        else
+            printf(formatPointer(".fmt.int", 4), convert(value, "i32"));
+        break;
+    }
+
+    case InstructionType::READ:
+    {
+        // scanf الفاشلة تترك القيمة السابقة كما في كود C
+        std::string format = formatPointer(".fmt.read", 3);
+        std::string type = typeOf(instr.operand1);
+        if (type == "i32")
+        {
+            line("call i32 (i8*, ...) @scanf(" + format + ", i32* " + address(instr.operand1) + ")");
+            break;
+        }
+        if (type == "double")
+        {
+            line("call i32 (i8*, ...) @scanf(" + formatPointer(".fmt.readreal", 4) + ", double* " +
+                 address(instr.operand1) + ")");
+            break;
+        }
+        Value current = convert(load(instr.operand1), "i32");
+        line("store i32 " + current.text + ", i32* %.scan");
+        line("call i32 (i8*, ...) @scanf(" + format + ", i32* %.scan)");
+        std::string value = fresh();
+        line(value + " = load i32, i32* %.scan");
+        store(instr.operand1, {value, "i32"});
+        break;
+    }
+
+    case InstructionType::ARG:
+        pendingArgs.push_back(&instr);
+        break;
+
+    case InstructionType::CALL:
+        call(instr);
+        break;
+
+    case InstructionType::RET:
+    {
+        Value value = instr.operand1.empty() ? Value{"0", "i32"} : convert(load(instr.operand1), "i32");
+        terminate("ret i32 " + value.text);
+        break;
+    }
+
+    case InstructionType::HALT:
+        if (frame)
+        {
+            line("call void @exit(i32 0)");
+            terminate("unreachable");
+        }
+        else
+            terminate("ret i32 0");
+        break;
+
+    case InstructionType::FUNC:
+        break;
+    }
+}
+
+void LLVMGenerator::emitFunction(const std::vector<size_t> &body)
+{
+    locals.clear();
+    pendingArgs.clear();
+    valueCounter = 0;
+    blockCounter = 0;
+
+    // المؤقتات والمتغيرات المحلية تُحجز في كتلة المدخل ليرفعها mem2reg
+    std::set<int> temps;
+    bool reads = false;
+    std::vector<std::string> names;
+    for (size_t i : body)
+    {
+        names.clear();
+        getUsedNames(code[i], names);
+        names.push_back(getDefinedName(code[i]));
+        for (const auto &name : names)
+        {
+            if (isTempName(name) && !(frame && frame->owns(name)))
+                temps.insert(std::stoi(name.substr(1)));
+        }
+        reads = reads || code[i].type == InstructionType::READ;
+    }
+
+    if (frame)
+    {
+        std::string signature;
+        for (size_t k = 0; k < frame->parameters.size(); ++k)
+        {
+            const std::string &param = frame->parameters[k];
+            std::string type = typeOfMeta(frame->symbols.at(param));
+            signature += (k == 0 ? "" : ", ") + type + (frame->byReference.count(param) ? "* " : " ") + "%.arg" +
+                         std::to_string(k);
+        }
+        *out << "define i32 @" << quoted(frame->label) << "(" << signature << ") {\n";
+    }
+    else
+        *out << "define i32 @main() {\n";
+    *out << "entry:\n";
+
+    if (frame)
+    {
+        for (size_t k = 0; k < frame->parameters.size(); ++k)
+        {
+            const std::string &param = frame->parameters[k];
+            std::string argument = "%.arg" + std::to_string(k);
+            if (frame->byReference.count(param))
+            {
+                locals[param] = argument;
+                continue;
+            }
+            std::string type = typeOf(param);
+            locals[param] = "%" + quoted(param);
+            *out << "  " << locals[param] << " = alloca " << type << "\n";
+            *out << "  store " << type << " " << argument << ", " << type << "* " << locals[param] << "\n";
+        }
+        for (const auto &local : frame->locals)
+        {
+            if (locals.count(local))
+                continue;
+            locals[local] = "%" + quoted(local);
+            std::string type = typeOf(local);
+            *out << "  " << locals[local] << " = alloca " << type << "\n";
+            *out << "  store " << type << " " << zeroOf(type) << ", " << type << "* " << locals[local] << "\n";
+        }
+    }
+    for (int temp : temps)
+    {
+        std::string name = "t" + std::to_string(temp);
+        std::string type = typeOf(name);
+        locals[name] = "%" + name;
+        *out << "  %" << name << " = alloca " << type << "\n";
+        *out << "  store " << type << " " << zeroOf(type) << ", " << type << "* %" << name << "\n";
+    }
+    if (reads)
+        *out << "  %.scan = alloca i32\n";
+
+    // كتلة المدخل لا تكون هدف قفزة، فيبدأ الجسم بكتلة خاصة
+    terminated = false;
+    startBlock(freshBlock());
+    for (size_t i : body)
+    {
+        lower(code[i]);
+    }
+    if (!terminated)
+        line("ret i32 0");
+    *out << "}\n\n";
+}
+
+void LLVMGenerator::generate(std::ostream &output)
+{
+    out = &output;
+    inferTempTypes();
+
+    *out << "; كود LLVM IR مولد للغة العربية\n";
+    *out << "; ===========================\n";
+    *out << "; clang -O2 program_output.ll -o program\n\n";
+
+    // بنى السجلات بترتيب حقولها
+    std::set<std::string> structs;
+    for (const auto &fields : recordFields)
+    {
+        structs.insert(fields.first);
+    }
+    for (const auto &name : structs)
+    {
+        std::string members;
+        for (const auto &field : recordFields.at(name))
+        {
+            members += (members.empty() ? "" : ", ") + typeOfC(field.second);
+        }
+        *out << "%" << quoted(name) << " = type { " << members << " }\n";
+    }
+    if (!structs.empty())
+        *out << "\n";
+
+    *out << "@.fmt.int = private unnamed_addr constant [4 x i8] c\"%d\\0A\\00\"\n";
+    *out << "@.fmt.str = private unnamed_addr constant [4 x i8] c\"%s\\0A\\00\"\n";
+    *out << "@.fmt.real = private unnamed_addr constant [4 x i8] c\"%g\\0A\\00\"\n";
+    *out << "@.fmt.read = private unnamed_addr constant [3 x i8] c\"%d\\00\"\n";
+    *out << "@.fmt.readreal = private unnamed_addr constant [4 x i8] c\"%lf\\00\"\n";
+    *out << "@.msg.bounds = private unnamed_addr constant [" << strlen(boundsMessage) << " x i8] c\""
+         << escapeBytes(boundsMessage) << "\"\n";
+    for (size_t i = 0; i < stringLiterals.size(); ++i)
+    {
+        *out << "@.str." << i << " = private unnamed_addr constant [" << stringLiterals[i].size() + 1 << " x i8] c\""
+             << escapeBytes(stringLiterals[i]) << "\\00\"\n";
+    }
+    *out << "\n";
+
+    // المتغيرات العامة: جدول الرموز وما يلمسه البرنامج الرئيسي أو تلمسه الإجراءات دون أن تملكه
+    std::set<std::string> globalNames;
+    for (const auto &symbol : symbolTable)
+    {
+        globalNames.insert(symbol.first);
+    }
+    std::vector<size_t> mainBody;
+    std::vector<std::vector<size_t>> procedureBodies;
+    std::vector<const ProcedureFrame *> procedureFrames;
+    std::vector<std::string> names;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        frame = owner[i];
+        if (!frame)
+            mainBody.push_back(i);
+        else
+        {
+            if (procedureFrames.empty() || procedureFrames.back() != frame)
+            {
+                procedureFrames.push_back(frame);
+                procedureBodies.emplace_back();
+            }
+            procedureBodies.back().push_back(i);
+        }
+
+        names.clear();
+        getUsedNames(code[i], names);
+        names.push_back(getDefinedName(code[i]));
+        std::string record, type;
+        int index;
+        for (const auto &name : names)
+        {
+            if (name.empty() || isTempName(name) || (frame && frame->owns(name)) || fieldOf(name, record, index, type))
+                continue;
+            globalNames.insert(name);
+        }
+    }
+    frame = nullptr;
+    for (const auto &name : globalNames)
+    {
+        std::string type = typeOf(name);
+        *out << "@" << quoted(name) << " = global " << type << " " << zeroOf(type) << "\n";
+    }
+    if (!globalNames.empty())
+        *out << "\n";
+
+    emitFunction(mainBody);
+    for (size_t i = 0; i < procedureFrames.size(); ++i)
+    {
+        frame = procedureFrames[i];
+        emitFunction(procedureBodies[i]);
+    }
+    frame = nullptr;
+
+    // وقت التشغيل: مكتبة C فقط
+    *out << "define internal void @rt.bounds_error() noreturn cold {\n";
+    *out << "entry:\n";
+    *out << "  call i64 @write(i32 2, " << formatPointer(".msg.bounds", strlen(boundsMessage)) << ", i64 "
+         << strlen(boundsMessage) << ")\n";
+    *out << "  call void @exit(i32 1)\n";
+    *out << "  unreachable\n";
+    *out << "}\n\n";
+    *out << "declare i32 @printf(i8*, ...)\n";
+    *out << "declare i32 @scanf(i8*, ...)\n";
+    *out << "declare i64 @write(i32, i8*, i64)\n";
+    *out << "declare void @exit(i32) noreturn\n";
+}
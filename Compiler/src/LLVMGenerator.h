@@ -0,0 +1,82 @@
+#ifndef LLVM_GENERATOR_H
+#define LLVM_GENERATOR_H
+
+#include "Instruction.h"
+#include "ProcedureFrame.h"
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// مولد LLVM IR نصي (.ll) يُترجم بـ clang أو llc دون ربط المترجم بمكتبات LLVM.
+// كل متغير ومؤقت alloca في مدخل الدالة فيرفعه mem2reg إلى سجلات، والحساب
+// بنوع المتغير كما في كود C: i32 لصحيح ومنطقي، وdouble لحقيقي، وi8* للخيط.
+// نوع المؤقت من التعليمات التي تعرّفه، فالحساب على قيمة حقيقية يبقى حقيقياً
+class LLVMGenerator
+{
+private:
+    struct Value
+    {
+        std::string text; // قيمة SSA أو ثابت
+        std::string type;
+    };
+
+    const std::vector<Instruction> &code;
+    std::vector<const ProcedureFrame *> owner; // الإطار المالك لكل تعليمة (nullptr للبرنامج الرئيسي)
+    const std::unordered_map<std::string, ProcedureFrame> &frames;
+    const std::unordered_map<std::string, std::string> &symbolTable;
+    const std::vector<std::string> &stringLiterals;
+    const std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> &recordFields;
+
+    std::unordered_map<std::string, std::string> locals; // الاسم -> عنوانه في الدالة الجارية
+    std::unordered_map<std::string, std::string> tempTypes; // نوع كل مؤقت من التعليمات التي تعرّفه
+    std::vector<const Instruction *> pendingArgs;
+    std::string lastCmpLeft, lastCmpRight;
+
+    std::ostream *out;
+    const ProcedureFrame *frame; // الإجراء الذي تُولد دالته الآن
+    int valueCounter;
+    int blockCounter;
+    bool terminated; // الكتلة الجارية انتهت بقفزة أو إرجاع
+
+    static std::string quoted(const std::string &name);
+    static std::string typeOfC(const std::string &ctype);
+    std::string typeOfMeta(const std::string &meta) const;
+    std::string metaOf(const std::string &name) const;
+    bool fieldOf(const std::string &name, std::string &record, int &index, std::string &type) const;
+    std::string typeOf(const std::string &name) const;
+    std::string operandType(const std::string &operand) const;
+    void inferTempTypes();
+
+    std::string fresh();
+    std::string freshBlock();
+    void line(const std::string &text);
+    void terminate(const std::string &text);
+    void startBlock(const std::string &label);
+
+    std::string address(const std::string &name);
+    std::string stringConstant(size_t index) const;
+    Value load(const std::string &operand);
+    Value convert(const Value &value, const std::string &type);
+    void store(const std::string &name, const Value &value);
+    std::string element(const std::string &arrayName, const std::string &index, std::string &type);
+    void printf(const std::string &format, const Value &value);
+
+    void binary(const Instruction &instr);
+    void branch(const std::string &predicate, const std::string &left, const std::string &right,
+                const std::string &label);
+    void call(const Instruction &instr);
+    void lower(const Instruction &instr);
+    void emitFunction(const std::vector<size_t> &body);
+
+public:
+    LLVMGenerator(const std::vector<Instruction> &code, std::vector<const ProcedureFrame *> owner,
+                  const std::unordered_map<std::string, ProcedureFrame> &frames,
+                  const std::unordered_map<std::string, std::string> &symbolTable,
+                  const std::vector<std::string> &stringLiterals,
+                  const std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> &recordFields);
+
+    void generate(std::ostream &out);
+};
+
+#endif
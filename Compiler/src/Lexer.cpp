@@ -1,4 +1,5 @@
 #include "Lexer.h"
+#include "Console.h"
 #include <cctype>
 #include <algorithm>
 #include <iostream>
@@ -63,8 +64,8 @@ void Lexer::analyzeEncoding()
 {
     if (!debug)
         return;
-    std::cout << "=== تحليل الترميز ===" << std::endl;
-    std::cout << "طول النص: " << source.length() << " بايت" << std::endl;
+    consoleOutput() << "=== تحليل الترميز ===" << std::endl;
+    consoleOutput() << "طول النص: " << source.length() << " بايت" << std::endl;
 
     int arabicCount = 0;
     for (size_t i = 0; i < std::min(source.length(), size_t(50)); ++i)
@@ -76,21 +77,21 @@ void Lexer::analyzeEncoding()
         }
         if (uc >= 0x80 || (uc < 32 && uc != '\n' && uc != '\t' && uc != '\r'))
         {
-            std::cout << "Position " << i << ": Hex=0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(uc)
+            consoleOutput() << "Position " << i << ": Hex=0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(uc)
                       << std::dec << " Char='";
             if (uc >= 32 && uc < 127)
             {
-                std::cout << source[i];
+                consoleOutput() << source[i];
             }
             else
             {
-                std::cout << "?";
+                consoleOutput() << "?";
             }
-            std::cout << "'" << std::endl;
+            consoleOutput() << "'" << std::endl;
         }
     }
-    std::cout << "عدد الأحرف العربية المحتملة المكتشفة (أول 50 بايت): " << arabicCount << std::endl;
-    std::cout << "=== انتهى تحليل الترميز ===" << std::endl
+    consoleOutput() << "عدد الأحرف العربية المحتملة المكتشفة (أول 50 بايت): " << arabicCount << std::endl;
+    consoleOutput() << "=== انتهى تحليل الترميز ===" << std::endl
               << std::endl;
 }
 
@@ -99,16 +100,16 @@ void Lexer::debugChar(char c)
     if (!debug)
         return;
     unsigned char uc = static_cast<unsigned char>(c);
-    std::cout << "🔍 تصحيح قراءة حرف: Char='";
+    consoleOutput() << "🔍 تصحيح قراءة حرف: Char='";
     if (uc >= 32 && uc < 127)
     {
-        std::cout << c;
+        consoleOutput() << c;
     }
     else
     {
-        std::cout << "?";
+        consoleOutput() << "?";
     }
-    std::cout << "' ASCII=" << static_cast<int>(uc)
+    consoleOutput() << "' ASCII=" << static_cast<int>(uc)
               << " Hex=0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(uc) << std::dec
               << " Position=" << position
               << " Line=" << line
@@ -400,7 +401,7 @@ std::vector<Token> Lexer::tokenize()
 
         if (token.type == TokenType::ERROR)
         {
-            std::cerr << "🛑 خطأ في التحليل اللغوي: " << token.value
+            consoleErrors() << "🛑 خطأ في التحليل اللغوي: " << token.value
                       << " في السطر " << token.line << ", العمود التقريبي " << token.column << std::endl;
             break; // Stop on first error
         }
@@ -650,7 +651,7 @@ Token Lexer::getNextToken()
                 ctx << std::hex << std::setw(2) << std::setfill('0') << (static_cast<int>(static_cast<unsigned char>(source[i]))) << " ";
             }
             ctx << std::dec << "\n";
-            std::cerr << ctx.str();
+            consoleErrors() << ctx.str();
         }
         catch (...)
         {
@@ -0,0 +1,203 @@
+#include "MipsPeephole.h"
+#include <unordered_map>
+
+std::string MipsInstr::toString() const
+{
+    switch (kind)
+    {
+    case Kind::Label:
+        return op + ":";
+    case Kind::Comment:
+        return "# " + op;
+    default:
+        break;
+    }
+    std::string text = op;
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        text += (i == 0 ? " " : ", ") + args[i];
+    }
+    return text;
+}
+
+// جدول الأنماط بترتيب المحاولة
+const std::vector<MipsPeephole::Rule> &MipsPeephole::rules()
+{
+    static const std::vector<Rule> table = {
+        {"sw r, x ; lw r2, x  =>  sw r, x ; move r2, r", &MipsPeephole::storeThenLoad},
+        {"lw r, x ; lw r, x  =>  lw r, x", &MipsPeephole::repeatedLoad},
+        {"lw r, x ; sw r, x  =>  lw r, x", &MipsPeephole::loadThenStore},
+        {"sw r, x ; sw r2, x  =>  sw r2, x", &MipsPeephole::deadStore},
+        {"move r, r  =>  (حذف)", &MipsPeephole::selfMove},
+        {"move a, b ; move b, a  =>  move a, b", &MipsPeephole::moveBack},
+        {"j L ; L:  =>  L:", &MipsPeephole::jumpToNext},
+        {"bcc L1 ; j L2 ; L1:  =>  b!cc L2 ; L1:", &MipsPeephole::branchOverJump},
+        {"j L ; (تعليمة بلا تسمية)  =>  j L", &MipsPeephole::unreachableAfterJump},
+    };
+    return table;
+}
+
+size_t MipsPeephole::next(size_t i) const
+{
+    size_t j = i + 1;
+    while (j < code.size() && code[j].kind == MipsInstr::Kind::Comment)
+        ++j;
+    return j;
+}
+
+void MipsPeephole::erase(size_t i)
+{
+    code.erase(code.begin() + static_cast<long>(i));
+}
+
+// عنوان رمزي بسيط (بدون سجل أساس) حتى لا يتأثر بتغيير السجلات
+static bool isSymbolAddress(const std::string &address)
+{
+    return address.find('(') == std::string::npos;
+}
+
+bool MipsPeephole::storeThenLoad(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("sw") || !isSymbolAddress(code[i].args[1]))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("lw") || code[j].args[1] != code[i].args[1])
+        return false;
+    if (code[j].args[0] == code[i].args[0])
+        self.erase(j);
+    else
+        code[j] = MipsInstr::instr("move", {code[j].args[0], code[i].args[0]});
+    return true;
+}
+
+bool MipsPeephole::repeatedLoad(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("lw") || !isSymbolAddress(code[i].args[1]))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("lw") || code[j].args != code[i].args)
+        return false;
+    self.erase(j);
+    return true;
+}
+
+bool MipsPeephole::loadThenStore(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("lw") || !isSymbolAddress(code[i].args[1]))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("sw") || code[j].args != code[i].args)
+        return false;
+    self.erase(j);
+    return true;
+}
+
+bool MipsPeephole::deadStore(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("sw") || !isSymbolAddress(code[i].args[1]))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("sw") || code[j].args[1] != code[i].args[1])
+        return false;
+    self.erase(i);
+    return true;
+}
+
+bool MipsPeephole::selfMove(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("move") || code[i].args[0] != code[i].args[1])
+        return false;
+    self.erase(i);
+    return true;
+}
+
+bool MipsPeephole::moveBack(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("move"))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("move") ||
+        code[j].args[0] != code[i].args[1] || code[j].args[1] != code[i].args[0])
+        return false;
+    self.erase(j);
+    return true;
+}
+
+bool MipsPeephole::jumpToNext(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("j"))
+        return false;
+    for (size_t k = self.next(i); k < code.size() && code[k].kind == MipsInstr::Kind::Label; k = self.next(k))
+    {
+        if (code[k].op == code[i].args[0])
+        {
+            self.erase(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MipsPeephole::branchOverJump(MipsPeephole &self, size_t i)
+{
+    static const std::unordered_map<std::string, std::string> inverse = {
+        {"beq", "bne"}, {"bne", "beq"}, {"bgt", "ble"}, {"ble", "bgt"}, {"blt", "bge"}, {"bge", "blt"}, {"beqz", "bnez"}, {"bnez", "beqz"}};
+
+    auto &code = self.code;
+    if (code[i].kind != MipsInstr::Kind::Instruction)
+        return false;
+    auto inv = inverse.find(code[i].op);
+    if (inv == inverse.end())
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || !code[j].is("j"))
+        return false;
+    size_t k = self.next(j);
+    if (k >= code.size() || code[k].kind != MipsInstr::Kind::Label || code[k].op != code[i].args.back())
+        return false;
+    code[i].op = inv->second;
+    code[i].args.back() = code[j].args[0];
+    self.erase(j);
+    return true;
+}
+
+bool MipsPeephole::unreachableAfterJump(MipsPeephole &self, size_t i)
+{
+    auto &code = self.code;
+    if (!code[i].is("j") && !code[i].is("jr"))
+        return false;
+    size_t j = self.next(i);
+    if (j >= code.size() || code[j].kind != MipsInstr::Kind::Instruction)
+        return false;
+    self.erase(j);
+    return true;
+}
+
+int MipsPeephole::run()
+{
+    int rewrites = 0;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 0; i < code.size(); ++i)
+        {
+            for (const auto &rule : rules())
+            {
+                if (i < code.size() && rule.apply(*this, i))
+                {
+                    ++rewrites;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return rewrites;
+}
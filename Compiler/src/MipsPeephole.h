@@ -0,0 +1,71 @@
+#ifndef MIPS_PEEPHOLE_H
+#define MIPS_PEEPHOLE_H
+
+#include <string>
+#include <vector>
+
+// تعليمة MIPS مهيكلة قبل كتابتها نصاً
+struct MipsInstr
+{
+    enum class Kind
+    {
+        Instruction,
+        Label,
+        Comment
+    };
+
+    Kind kind;
+    std::string op; // اسم التعليمة، أو التسمية، أو نص التعليق
+    std::vector<std::string> args;
+
+    MipsInstr(Kind kind, const std::string &op, std::vector<std::string> args = {})
+        : kind(kind), op(op), args(std::move(args)) {}
+
+    static MipsInstr instr(const std::string &op, std::vector<std::string> args = {})
+    {
+        return MipsInstr(Kind::Instruction, op, std::move(args));
+    }
+    static MipsInstr label(const std::string &name) { return MipsInstr(Kind::Label, name); }
+    static MipsInstr comment(const std::string &text) { return MipsInstr(Kind::Comment, text); }
+
+    bool is(const char *name) const { return kind == Kind::Instruction && op == name; }
+    std::string toString() const;
+};
+
+// محسّن ثقب المفتاح: جدول أنماط يطبق على نافذة صغيرة من التعليمات المتتالية
+// حتى لا يتغير شيء. التعليقات لا تقطع النافذة، والتسميات تقطعها.
+class MipsPeephole
+{
+private:
+    struct Rule
+    {
+        const char *name;
+        // يحاول تطبيق النمط بدءاً من التعليمة i، ويعيد true إذا غيّر شيئاً
+        bool (*apply)(MipsPeephole &self, size_t i);
+    };
+
+    std::vector<MipsInstr> &code;
+    static const std::vector<Rule> &rules();
+
+    // موضع التعليمة أو التسمية التالية بعد i مع تخطي التعليقات (أو code.size())
+    size_t next(size_t i) const;
+    void erase(size_t i);
+
+    static bool storeThenLoad(MipsPeephole &self, size_t i);
+    static bool repeatedLoad(MipsPeephole &self, size_t i);
+    static bool loadThenStore(MipsPeephole &self, size_t i);
+    static bool deadStore(MipsPeephole &self, size_t i);
+    static bool selfMove(MipsPeephole &self, size_t i);
+    static bool moveBack(MipsPeephole &self, size_t i);
+    static bool jumpToNext(MipsPeephole &self, size_t i);
+    static bool branchOverJump(MipsPeephole &self, size_t i);
+    static bool unreachableAfterJump(MipsPeephole &self, size_t i);
+
+public:
+    explicit MipsPeephole(std::vector<MipsInstr> &code) : code(code) {}
+
+    // يعيد عدد التعديلات التي أجراها
+    int run();
+};
+
+#endif
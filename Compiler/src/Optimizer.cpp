@@ -0,0 +1,1572 @@
+#include "Optimizer.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <map>
+#include <cstdlib>
+#include <cstring>
+
+Optimizer::Optimizer(std::vector<Instruction> &instructions, int &tempVarCounter, int &labelCounter,
+                     const std::unordered_map<std::string, ProcedureFrame> *frames,
+                     const std::unordered_map<std::string, std::string> *symbolTable)
+    : instructions(instructions), tempVarCounter(tempVarCounter), labelCounter(labelCounter), frames(frames),
+      symbolTable(symbolTable) {}
+
+std::string Optimizer::newLabel()
+{
+    return "L" + std::to_string(labelCounter++);
+}
+
+std::string Optimizer::newTemp()
+{
+    return "t" + std::to_string(tempVarCounter++);
+}
+
+// اسم المتغير الأساسي لحقول السجلات (rec.field -> rec)
+static std::string memoryBase(const std::string &name)
+{
+    size_t dot = name.find('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+static bool isHoistable(InstructionType type)
+{
+    switch (type)
+    {
+    case InstructionType::LOAD:
+    case InstructionType::ADD:
+    case InstructionType::SUB:
+    case InstructionType::MUL:
+    case InstructionType::AND:
+    case InstructionType::OR:
+    case InstructionType::DIV:
+    case InstructionType::MOD:
+    case InstructionType::LOAD_INDEXED:
+    case InstructionType::SHL:
+    case InstructionType::SHR:
+    case InstructionType::SAR:
+    case InstructionType::BITAND:
+    case InstructionType::MULHI:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// القسمة وقراءة المصفوفات قد تفشل، فلا تُنقل إلا إذا كانت ستُنفذ على أي حال
+static bool mayTrap(InstructionType type)
+{
+    return type == InstructionType::DIV || type == InstructionType::MOD ||
+           type == InstructionType::LOAD_INDEXED;
+}
+
+bool Optimizer::touchesReference(const Instruction &instr) const
+{
+    if (!frames)
+        return false;
+    std::vector<std::string> names;
+    getUsedNames(instr, names);
+    names.push_back(getDefinedName(instr));
+    for (const auto &name : names)
+    {
+        for (const auto &entry : *frames)
+        {
+            if (entry.second.byReference.count(name))
+                return true;
+        }
+    }
+    return false;
+}
+
+bool Optimizer::hoistLoopInvariants()
+{
+    bool changed = false;
+    // كل جولة تنقل من حلقة واحدة ثم يعاد بناء المخطط، فتنتقل التعليمات
+    // من الحلقات الداخلية إلى الخارجية تدريجياً
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        ControlFlowGraph cfg(instructions);
+        for (const auto &loop : cfg.findLoops())
+        {
+            if (hoistFromLoop(cfg, loop))
+            {
+                progress = true;
+                changed = true;
+                break;
+            }
+        }
+    }
+    return changed;
+}
+
+bool Optimizer::hoistFromLoop(const ControlFlowGraph &cfg, const Loop &loop)
+{
+    const auto &blocks = cfg.getBlocks();
+    const BasicBlock &header = blocks[loop.header];
+    if (instructions[header.start].type != InstructionType::LABEL)
+        return false;
+
+    // عدد تعريفات كل مؤقت في البرنامج كله
+    std::unordered_map<std::string, int> defCount;
+    for (const auto &instr : instructions)
+    {
+        std::string def = getDefinedName(instr);
+        if (isTempName(def))
+            defCount[def]++;
+    }
+
+    // ما تكتبه الحلقة: مؤقتات ومتغيرات في الذاكرة
+    std::unordered_set<std::string> loopDefs;
+    std::unordered_set<std::string> writtenMemory;
+    bool visible = false; // الحلقة تطبع أو تقرأ
+    for (size_t b : loop.blocks)
+    {
+        for (size_t i = blocks[b].start; i < blocks[b].end; ++i)
+        {
+            const Instruction &instr = instructions[i];
+            // الاستدعاءات قد تغير أي متغير عام
+            if (instr.type == InstructionType::CALL || instr.type == InstructionType::RET)
+                return false;
+            if (instr.type == InstructionType::PRINT || instr.type == InstructionType::READ)
+                visible = true;
+            // المعامل بالمرجع قد يشير إلى أي متغير، فلا يُعرف ما تكتبه الحلقة
+            if (touchesReference(instr))
+                return false;
+            std::string def = getDefinedName(instr);
+            if (!def.empty())
+                loopDefs.insert(def);
+            std::string mem = getWrittenMemory(instr);
+            if (!mem.empty())
+                writtenMemory.insert(memoryBase(mem));
+        }
+    }
+
+    std::unordered_set<std::string> invariantTemps;
+    auto operandInvariant = [&](const std::string &name)
+    {
+        if (name.empty() || isConstantOperand(name))
+            return true;
+        if (isTempName(name))
+            return !loopDefs.count(name) || invariantTemps.count(name);
+        return !writtenMemory.count(memoryBase(name));
+    };
+
+    std::vector<size_t> hoisted;
+    std::vector<bool> marked(instructions.size(), false);
+    bool found = true;
+    while (found)
+    {
+        found = false;
+        for (size_t b : loop.blocks)
+        {
+            bool executesAlways = true;
+            for (size_t exitBlock : loop.exiting)
+            {
+                if (!cfg.dominates(b, exitBlock))
+                    executesAlways = false;
+            }
+
+            for (size_t i = blocks[b].start; i < blocks[b].end; ++i)
+            {
+                const Instruction &instr = instructions[i];
+                if (marked[i])
+                    continue;
+
+                // فحص الحدود يُنقل إذا نُفذ في كل دورة على فهرس ثابت، ولا تُنقل قراءة دون فحصها.
+                // ما قد يوقف البرنامج لا يتقدم على طباعة الدورة الأولى
+                if (instr.type == InstructionType::BOUNDS)
+                {
+                    if (executesAlways && !visible && operandInvariant(instr.operand1))
+                    {
+                        marked[i] = true;
+                        hoisted.push_back(i);
+                        found = true;
+                    }
+                    continue;
+                }
+                if (!isHoistable(instr.type))
+                    continue;
+                if (instr.type == InstructionType::LOAD_INDEXED && i > 0 && !marked[i - 1] &&
+                    instructions[i - 1].type == InstructionType::BOUNDS)
+                    continue;
+                if (!isTempName(instr.operand1) || defCount[instr.operand1] != 1)
+                    continue;
+                if (mayTrap(instr.type) &&
+                    (!executesAlways || (visible && instr.type != InstructionType::LOAD_INDEXED)))
+                    continue;
+
+                std::vector<std::string> uses;
+                getUsedNames(instr, uses);
+                bool invariant = true;
+                for (const auto &use : uses)
+                {
+                    if (!operandInvariant(use))
+                    {
+                        invariant = false;
+                        break;
+                    }
+                }
+                if (!invariant)
+                    continue;
+
+                marked[i] = true;
+                invariantTemps.insert(instr.operand1);
+                hoisted.push_back(i);
+                found = true;
+            }
+        }
+    }
+
+    if (hoisted.empty())
+        return false;
+
+    // بناء الرأس المسبق: التعليمات المنقولة بترتيب اكتشافها قبل تسمية الرأس
+    const std::string headerLabel = instructions[header.start].operand1;
+    std::vector<Instruction> preheader;
+    for (size_t i : hoisted)
+        preheader.push_back(instructions[i]);
+
+    bool fallsIntoHeaderFromLoop = false;
+    bool jumpsFromOutside = false;
+    for (size_t p : header.predecessors)
+    {
+        const Instruction &last = instructions[blocks[p].end - 1];
+        bool jumps = getJumpTarget(last) == headerLabel;
+        if (loop.contains(p))
+        {
+            if (!jumps && p + 1 == loop.header)
+                fallsIntoHeaderFromLoop = true;
+        }
+        else if (jumps)
+        {
+            jumpsFromOutside = true;
+        }
+    }
+
+    std::string preheaderLabel;
+    if (jumpsFromOutside || fallsIntoHeaderFromLoop)
+    {
+        preheaderLabel = newLabel();
+        preheader.insert(preheader.begin(), Instruction(InstructionType::LABEL, preheaderLabel));
+    }
+    if (fallsIntoHeaderFromLoop)
+    {
+        preheader.insert(preheader.begin(), Instruction(InstructionType::JMP, headerLabel));
+    }
+
+    if (jumpsFromOutside)
+    {
+        for (size_t p : header.predecessors)
+        {
+            if (loop.contains(p))
+                continue;
+            Instruction &last = instructions[blocks[p].end - 1];
+            if (getJumpTarget(last) != headerLabel)
+                continue;
+            if (last.type == InstructionType::JZ || last.type == InstructionType::JNZ)
+                last.operand2 = preheaderLabel;
+            else
+                last.operand1 = preheaderLabel;
+        }
+    }
+
+    std::vector<Instruction> result;
+    result.reserve(instructions.size() + 2);
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (i == header.start)
+            result.insert(result.end(), preheader.begin(), preheader.end());
+        if (!marked[i])
+            result.push_back(instructions[i]);
+    }
+    instructions.swap(result);
+    return true;
+}
+
+bool Optimizer::eliminateTailCalls()
+{
+    if (!frames || frames->empty())
+        return false;
+
+    std::unordered_map<std::string, size_t> labelPositions;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (instructions[i].type == InstructionType::LABEL)
+            labelPositions[instructions[i].operand1] = i;
+    }
+
+    // هل ينتهي التنفيذ بعد الموضع i بإرجاع بلا قيمة، عبر التسميات والقفزات فقط؟
+    auto returnsAfter = [&](size_t i)
+    {
+        std::unordered_set<size_t> seen;
+        size_t j = i + 1;
+        while (j < instructions.size() && seen.insert(j).second)
+        {
+            const Instruction &next = instructions[j];
+            if (next.type == InstructionType::LABEL)
+            {
+                ++j;
+                continue;
+            }
+            if (next.type != InstructionType::JMP)
+                return next.type == InstructionType::RET && next.operand1.empty();
+            auto it = labelPositions.find(next.operand1);
+            if (it == labelPositions.end())
+                return false;
+            j = it->second;
+        }
+        return false;
+    };
+
+    // مواضع الاستدعاءات الذاتية (تصبح حلقة) واستدعاءات الأشقاء (تعيد استخدام الإطار)
+    std::unordered_set<size_t> selfCalls;
+    std::unordered_set<size_t> siblingCalls;
+    std::vector<std::string> loopingFrames; // بترتيب الظهور حتى تثبت أرقام التسميات
+    const ProcedureFrame *frame = nullptr;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const Instruction &instr = instructions[i];
+        if (instr.type == InstructionType::FUNC)
+        {
+            auto it = frames->find(instr.operand1);
+            frame = it == frames->end() ? nullptr : &it->second;
+            continue;
+        }
+        if (!frame || instr.type != InstructionType::CALL || !frames->count(instr.operand1) || !returnsAfter(i))
+            continue;
+
+        // المعاملات تسبق الاستدعاء مباشرة بترتيبها
+        size_t count = static_cast<size_t>(std::stoi(instr.operand2.empty() ? "0" : instr.operand2));
+        if (count > i)
+            continue;
+        bool self = instr.operand1 == frame->label;
+        bool eligible = self || count <= 4;
+        for (size_t k = 0; k < count && eligible; ++k)
+        {
+            const Instruction &arg = instructions[i - count + k];
+            if (arg.type != InstructionType::ARG || arg.operand1 != std::to_string(k))
+                eligible = false;
+            else if (isElementReference(arg))
+            {
+                // عنوان عنصر في قائمة محلية لا يبقى صالحاً بعد إعادة استخدام الإطار
+                eligible = !self && !frame->owns(arg.operand2);
+            }
+            else if (arg.operand3 == "ref")
+            {
+                // عنوان متغير محلي لا يبقى صالحاً بعد إعادة استخدام الإطار
+                if (self)
+                    eligible = k < frame->parameters.size() && arg.operand2 == frame->parameters[k];
+                else
+                    eligible = !frame->owns(arg.operand2) || frame->byReference.count(arg.operand2);
+            }
+            else if (self)
+            {
+                // القيم محسوبة في مؤقتات، فالإسناد المتتالي للمعاملات آمن
+                eligible = isTempName(arg.operand2) || isConstantOperand(arg.operand2);
+            }
+        }
+        if (!eligible)
+            continue;
+
+        if (self)
+        {
+            selfCalls.insert(i);
+            if (std::find(loopingFrames.begin(), loopingFrames.end(), frame->label) == loopingFrames.end())
+                loopingFrames.push_back(frame->label);
+        }
+        else
+        {
+            siblingCalls.insert(i);
+        }
+    }
+
+    if (selfCalls.empty() && siblingCalls.empty())
+        return false;
+
+    std::unordered_map<std::string, std::string> bodyLabels;
+    for (const auto &label : loopingFrames)
+        bodyLabels[label] = newLabel();
+
+    // حقول السجلات المحلية المستخدمة (محلي.حقل): هي ما يُصفّر من السجل
+    std::map<std::string, std::vector<std::string>> recordFields;
+    std::vector<std::string> names;
+    for (const auto &instr : instructions)
+    {
+        names.clear();
+        getUsedNames(instr, names);
+        names.push_back(getDefinedName(instr));
+        for (const auto &name : names)
+        {
+            size_t dot = name.find('.');
+            if (dot == std::string::npos)
+                continue;
+            auto &fields = recordFields[name.substr(0, dot)];
+            if (std::find(fields.begin(), fields.end(), name) == fields.end())
+                fields.push_back(name);
+        }
+    }
+    for (auto &entry : recordFields)
+        std::sort(entry.second.begin(), entry.second.end());
+
+    std::vector<Instruction> result;
+    result.reserve(instructions.size() + loopingFrames.size());
+
+    // المحلي يعود إلى الصفر كما في مقدمة الإطار: القائمة عنصراً عنصراً (بحلقة
+    // إذا طالت) والسجل حقلاً حقلاً، مثل تصفير المحليات في التضمين
+    auto zeroLocal = [&](const std::string &local)
+    {
+        const std::string &meta = frame->symbols.at(local);
+        if (meta == "ثابت")
+            return;
+        if (meta.rfind("primitive:", 0) == 0)
+        {
+            result.emplace_back(InstructionType::STORE, local, "0");
+            return;
+        }
+        std::string zero = newTemp();
+        result.emplace_back(InstructionType::LOAD, zero, "0");
+        if (meta.rfind("record:", 0) == 0)
+        {
+            for (const auto &field : recordFields[local])
+                result.emplace_back(InstructionType::STORE, field, zero);
+            return;
+        }
+        size_t colon = meta.rfind(':');
+        int length = meta.rfind("array:", 0) == 0 && colon > strlen("array:") ? std::atoi(meta.c_str() + colon + 1) : 0;
+        if (length <= 8)
+        {
+            for (int k = 0; k < length; ++k)
+            {
+                std::string index = newTemp();
+                result.emplace_back(InstructionType::LOAD, index, std::to_string(k));
+                result.emplace_back(InstructionType::STORE_INDEXED, local, index, zero);
+            }
+            return;
+        }
+        std::string index = newTemp(), one = newTemp(), next = newTemp(), limit = newTemp();
+        std::string loopLabel = newLabel();
+        result.emplace_back(InstructionType::LOAD, index, "0");
+        result.emplace_back(InstructionType::LABEL, loopLabel);
+        result.emplace_back(InstructionType::STORE_INDEXED, local, index, zero);
+        result.emplace_back(InstructionType::LOAD, one, "1");
+        result.emplace_back(InstructionType::ADD, next, index, one);
+        result.emplace_back(InstructionType::LOAD, index, next);
+        result.emplace_back(InstructionType::LOAD, limit, std::to_string(length));
+        result.emplace_back(InstructionType::CMP, next, limit);
+        result.emplace_back(InstructionType::JL, loopLabel);
+    };
+
+    frame = nullptr;
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        const Instruction &instr = instructions[i];
+        if (instr.type == InstructionType::FUNC)
+        {
+            frame = &frames->at(instr.operand1);
+            result.push_back(instr);
+            // بداية الجسم بعد مقدمة الإطار: هدف القفزة الراجعة
+            if (bodyLabels.count(frame->label))
+                result.emplace_back(InstructionType::LABEL, bodyLabels[frame->label]);
+            continue;
+        }
+        if (siblingCalls.count(i))
+        {
+            result.emplace_back(instr.type, instr.operand1, instr.operand2, "tail");
+            continue;
+        }
+        if (!selfCalls.count(i))
+        {
+            result.push_back(instr);
+            continue;
+        }
+
+        // استدعاء ذاتي أخير: المعاملات بالقيمة تأخذ قيمها الجديدة، والمعاملات
+        // بالمرجع تبقى كما هي، وكل المحليات بسيطة وقوائم وسجلات تُصفّر هنا
+        // كما تصفرها مقدمة الإطار، لأن القفزة لا تمر بها
+        size_t count = static_cast<size_t>(std::stoi(instr.operand2.empty() ? "0" : instr.operand2));
+        result.erase(result.end() - static_cast<long>(count), result.end());
+        for (size_t k = 0; k < count; ++k)
+        {
+            const Instruction &arg = instructions[i - count + k];
+            if (!isReferenceArgument(arg))
+                result.emplace_back(InstructionType::STORE, frame->parameters[k], arg.operand2);
+        }
+        for (const auto &local : frame->locals)
+            zeroLocal(local);
+        result.emplace_back(InstructionType::JMP, bodyLabels[frame->label]);
+    }
+    instructions = std::move(result);
+    return true;
+}
+
+// حذف تعريفات المؤقتات التي لم يبق من يقرؤها (النسخ والثوابت التي استُبدلت
+// استخداماتها)، عدا ما قد يفشل وقت التنفيذ
+static bool eraseDeadDefinitions(std::vector<Instruction> &code)
+{
+    bool changed = false;
+    bool progress = true;
+    std::vector<std::string> uses;
+    while (progress)
+    {
+        progress = false;
+        std::unordered_set<std::string> used;
+        for (const auto &instr : code)
+        {
+            uses.clear();
+            getUsedNames(instr, uses);
+            used.insert(uses.begin(), uses.end());
+        }
+        auto dead = [&used](const Instruction &instr)
+        {
+            return isHoistable(instr.type) && !mayTrap(instr.type) && isTempName(instr.operand1) &&
+                   !used.count(instr.operand1);
+        };
+        auto end = std::remove_if(code.begin(), code.end(), dead);
+        if (end != code.end())
+        {
+            code.erase(end, code.end());
+            progress = changed = true;
+        }
+    }
+    return changed;
+}
+
+// ترقيم القيم: كل اسم (مؤقت أو متغير في الذاكرة) وكل نسخة من قائمة تحمل رقم
+// القيمة التي فيها، وكل عملية حُسبت مفتاحها رقما معاملَيها
+struct ValueState
+{
+    std::unordered_map<std::string, int> names;
+    std::unordered_map<std::string, int> arrays;
+    std::unordered_map<std::string, int> expressions;
+    std::unordered_map<int, std::string> leaders; // أول مؤقت يحمل القيمة
+    std::unordered_set<std::string> checks;       // فحوص حدود نُفذت على (فهرس، طول)
+};
+
+static bool isCommutative(InstructionType type)
+{
+    return type == InstructionType::ADD || type == InstructionType::MUL || type == InstructionType::AND ||
+           type == InstructionType::OR;
+}
+
+bool Optimizer::numberValues()
+{
+    if (instructions.empty())
+        return false;
+
+    // المعامل بالمرجع قد يشير إلى أي متغير: كل كتابة في الذاكرة تُسقط كل ما عُرف عنها
+    bool aliased = false;
+    if (frames)
+    {
+        for (const auto &entry : *frames)
+        {
+            if (!entry.second.byReference.empty())
+                aliased = true;
+        }
+    }
+
+    int nextValue = 0;
+    std::unordered_map<std::string, int> constants;
+    auto valueOf = [&](ValueState &state, const std::string &name)
+    {
+        auto &table = isConstantOperand(name) ? constants : state.names;
+        auto it = table.find(name);
+        if (it != table.end())
+            return it->second;
+        return table[name] = nextValue++;
+    };
+    auto arrayVersion = [&](ValueState &state, const std::string &array)
+    {
+        auto it = state.arrays.find(array);
+        if (it != state.arrays.end())
+            return it->second;
+        return state.arrays[array] = nextValue++;
+    };
+    auto leaderOf = [](const ValueState &state, int value) -> std::string
+    {
+        auto it = state.leaders.find(value);
+        if (it == state.leaders.end())
+            return "";
+        auto holder = state.names.find(it->second);
+        return holder != state.names.end() && holder->second == value ? it->second : "";
+    };
+    auto define = [&](ValueState &state, const std::string &name, int value)
+    {
+        state.names[name] = value;
+        if (isTempName(name) && leaderOf(state, value).empty())
+            state.leaders[value] = name;
+    };
+    auto killMemory = [&](ValueState &state, const std::string &name)
+    {
+        for (auto &entry : state.names)
+        {
+            if (!isTempName(entry.first) && (aliased || memoryBase(entry.first) == memoryBase(name)))
+                entry.second = nextValue++;
+        }
+        if (aliased)
+            state.arrays.clear();
+        state.names[name] = nextValue++;
+    };
+    auto killArray = [&](ValueState &state, const std::string &array)
+    {
+        if (aliased)
+        {
+            state.arrays.clear();
+            for (auto &entry : state.names)
+            {
+                if (!isTempName(entry.first))
+                    entry.second = nextValue++;
+            }
+        }
+        state.arrays[array] = nextValue++;
+    };
+    // أثر التعليمة على ما هو معروف، دون إعادة استخدام شيء
+    auto clobber = [&](ValueState &state, const Instruction &instr)
+    {
+        if (instr.type == InstructionType::CALL)
+        {
+            state = ValueState();
+            return;
+        }
+        if (instr.type == InstructionType::STORE_INDEXED)
+        {
+            killArray(state, instr.operand1);
+            return;
+        }
+        std::string memory = getWrittenMemory(instr);
+        if (!memory.empty())
+            killMemory(state, memory);
+        std::string def = getDefinedName(instr);
+        if (!def.empty() && isTempName(def))
+            state.names[def] = nextValue++;
+    };
+
+    ControlFlowGraph cfg(instructions);
+    const auto &blocks = cfg.getBlocks();
+    const size_t n = blocks.size();
+
+    std::vector<std::vector<size_t>> children(n);
+    std::vector<size_t> roots;
+    for (size_t b : cfg.reversePostOrder())
+    {
+        long parent = cfg.immediateDominator(b);
+        if (parent < 0)
+            continue;
+        if (static_cast<size_t>(parent) == b)
+            roots.push_back(b);
+        else
+            children[parent].push_back(b);
+    }
+
+    std::vector<bool> removed(instructions.size(), false);
+    bool changed = false;
+
+    std::vector<ValueState> endState(n);
+    std::vector<size_t> order(roots.rbegin(), roots.rend());
+    while (!order.empty())
+    {
+        size_t b = order.back();
+        order.pop_back();
+
+        // ما عُرف في نهاية المسيطر يصح هنا إلا ما يُكتب على مسار منه إلى الكتلة
+        ValueState state;
+        long parent = cfg.immediateDominator(b);
+        if (static_cast<size_t>(parent) != b)
+        {
+            state = endState[parent];
+            std::vector<bool> seen(n, false);
+            std::vector<size_t> pending(blocks[b].predecessors);
+            while (!pending.empty())
+            {
+                size_t p = pending.back();
+                pending.pop_back();
+                if (p == static_cast<size_t>(parent) || seen[p])
+                    continue;
+                seen[p] = true;
+                for (size_t i = blocks[p].start; i < blocks[p].end; ++i)
+                    clobber(state, instructions[i]);
+                pending.insert(pending.end(), blocks[p].predecessors.begin(), blocks[p].predecessors.end());
+            }
+        }
+
+        for (size_t i = blocks[b].start; i < blocks[b].end; ++i)
+        {
+            Instruction &instr = instructions[i];
+
+            // المؤقت المكرر يُستبدل في الاستخدامات بأول مؤقت حمل قيمته
+            auto canonical = [&](std::string &operand)
+            {
+                if (!isTempName(operand))
+                    return;
+                auto it = state.names.find(operand);
+                if (it == state.names.end())
+                    return;
+                std::string leader = leaderOf(state, it->second);
+                if (!leader.empty() && leader != operand)
+                {
+                    operand = leader;
+                    changed = true;
+                }
+            };
+            switch (instr.type)
+            {
+            case InstructionType::LOAD:
+            case InstructionType::STORE:
+            case InstructionType::PRINT:
+                canonical(instr.operand2);
+                break;
+            case InstructionType::ARG:
+                if (!isReferenceArgument(instr))
+                    canonical(instr.operand2);
+                else if (isElementReference(instr))
+                    canonical(instr.operand3);
+                break;
+            case InstructionType::JZ:
+            case InstructionType::JNZ:
+            case InstructionType::RET:
+                canonical(instr.operand1);
+                break;
+            case InstructionType::CMP:
+            case InstructionType::BOUNDS:
+                canonical(instr.operand1);
+                canonical(instr.operand2);
+                break;
+            case InstructionType::LOAD_INDEXED:
+                canonical(instr.operand3);
+                break;
+            case InstructionType::STORE_INDEXED:
+                canonical(instr.operand2);
+                canonical(instr.operand3);
+                break;
+            default:
+                if (isHoistable(instr.type) && !instr.operand3.empty())
+                {
+                    canonical(instr.operand2);
+                    canonical(instr.operand3);
+                }
+                break;
+            }
+
+            // قيمة محسوبة من قبل: نسخ من المؤقت الذي يحملها أو حذف إن كانت في الهدف أصلاً
+            auto reuse = [&](int value)
+            {
+                auto current = state.names.find(instr.operand1);
+                if (current != state.names.end() && current->second == value)
+                {
+                    removed[i] = true;
+                    changed = true;
+                    return;
+                }
+                std::string leader = leaderOf(state, value);
+                if (!leader.empty())
+                {
+                    instr = Instruction(InstructionType::LOAD, instr.operand1, leader);
+                    changed = true;
+                }
+                define(state, instr.operand1, value);
+            };
+
+            switch (instr.type)
+            {
+            case InstructionType::LOAD:
+                if (isTempName(instr.operand2) || isConstantOperand(instr.operand2))
+                {
+                    auto current = state.names.find(instr.operand1);
+                    int value = valueOf(state, instr.operand2);
+                    if (current != state.names.end() && current->second == value)
+                    {
+                        removed[i] = true;
+                        changed = true;
+                    }
+                    else
+                        define(state, instr.operand1, value);
+                }
+                else
+                    reuse(valueOf(state, instr.operand2));
+                break;
+
+            case InstructionType::STORE:
+            {
+                int value = valueOf(state, instr.operand2);
+                if (isTempName(instr.operand1))
+                {
+                    define(state, instr.operand1, value);
+                    break;
+                }
+                // المتغير يحمل القيمة نفسها: الكتابة زائدة
+                auto current = state.names.find(instr.operand1);
+                if (current != state.names.end() && current->second == value)
+                {
+                    removed[i] = true;
+                    changed = true;
+                    break;
+                }
+                killMemory(state, instr.operand1);
+                state.names[instr.operand1] = value;
+                break;
+            }
+
+            case InstructionType::ADD:
+            case InstructionType::SUB:
+            case InstructionType::MUL:
+            case InstructionType::DIV:
+            case InstructionType::MOD:
+            case InstructionType::AND:
+            case InstructionType::OR:
+            case InstructionType::SHL:
+            case InstructionType::SHR:
+            case InstructionType::SAR:
+            case InstructionType::BITAND:
+            case InstructionType::MULHI:
+            {
+                const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+                const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+                int a = valueOf(state, left), c = valueOf(state, right);
+                if (isCommutative(instr.type) && c < a)
+                    std::swap(a, c);
+                std::string key = std::to_string(static_cast<int>(instr.type)) + ":" + std::to_string(a) + "," +
+                                  std::to_string(c);
+                auto it = state.expressions.find(key);
+                if (it != state.expressions.end())
+                    reuse(it->second);
+                else
+                {
+                    int value = nextValue++;
+                    state.expressions[key] = value;
+                    define(state, instr.operand1, value);
+                }
+                break;
+            }
+
+            case InstructionType::LOAD_INDEXED:
+            {
+                std::string key = "[]:" + std::to_string(arrayVersion(state, instr.operand2)) + "," +
+                                  std::to_string(valueOf(state, instr.operand3));
+                auto it = state.expressions.find(key);
+                if (it != state.expressions.end())
+                    reuse(it->second);
+                else
+                {
+                    int value = nextValue++;
+                    state.expressions[key] = value;
+                    define(state, instr.operand1, value);
+                }
+                break;
+            }
+
+            case InstructionType::STORE_INDEXED:
+            {
+                int index = valueOf(state, instr.operand2);
+                int value = valueOf(state, instr.operand3);
+                killArray(state, instr.operand1);
+                state.expressions["[]:" + std::to_string(arrayVersion(state, instr.operand1)) + "," +
+                                  std::to_string(index)] = value;
+                break;
+            }
+
+            case InstructionType::BOUNDS:
+            {
+                std::string key = std::to_string(valueOf(state, instr.operand1)) + "," + instr.operand2;
+                if (!state.checks.insert(key).second)
+                {
+                    removed[i] = true;
+                    changed = true;
+                }
+                break;
+            }
+
+            default:
+                clobber(state, instr);
+                break;
+            }
+        }
+
+        endState[b] = state;
+        for (auto it = children[b].rbegin(); it != children[b].rend(); ++it)
+            order.push_back(*it);
+    }
+
+    std::vector<Instruction> result;
+    result.reserve(instructions.size());
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (!removed[i])
+            result.push_back(instructions[i]);
+    }
+    changed = eraseDeadDefinitions(result) || changed;
+    instructions = std::move(result);
+    return changed;
+}
+
+static void setJumpTarget(Instruction &instr, const std::string &label)
+{
+    if (instr.type == InstructionType::JZ || instr.type == InstructionType::JNZ)
+        instr.operand2 = label;
+    else
+        instr.operand1 = label;
+}
+
+static InstructionType invertJump(InstructionType type)
+{
+    switch (type)
+    {
+    case InstructionType::JE:
+        return InstructionType::JNE;
+    case InstructionType::JNE:
+        return InstructionType::JE;
+    case InstructionType::JG:
+        return InstructionType::JLE;
+    case InstructionType::JLE:
+        return InstructionType::JG;
+    case InstructionType::JL:
+        return InstructionType::JGE;
+    case InstructionType::JGE:
+        return InstructionType::JL;
+    case InstructionType::JZ:
+        return InstructionType::JNZ;
+    default:
+        return InstructionType::JZ;
+    }
+}
+
+bool Optimizer::simplifyControlFlow()
+{
+    bool changed = false;
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        const size_t n = instructions.size();
+        std::vector<bool> removed(n, false);
+
+        // مواضع التسميات؛ كل سلسلة تسميات متتالية تُمثَّل بأولها
+        std::unordered_map<std::string, size_t> position;
+        std::unordered_map<std::string, std::string> canonical;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (instructions[i].type != InstructionType::LABEL)
+                continue;
+            const std::string &label = instructions[i].operand1;
+            position[label] = i;
+            bool chained = i > 0 && instructions[i - 1].type == InstructionType::LABEL;
+            canonical[label] = chained ? canonical[instructions[i - 1].operand1] : label;
+        }
+        // أول تعليمة بعد سلسلة التسميات
+        auto after = [&](const std::string &label)
+        {
+            size_t i = position.at(label);
+            while (i < n && instructions[i].type == InstructionType::LABEL)
+                ++i;
+            return i;
+        };
+        // الوجهة النهائية بعد تخطي القفزات إلى قفزات
+        auto resolve = [&](std::string label)
+        {
+            std::unordered_set<std::string> seen;
+            while (position.count(label) && seen.insert(label).second)
+            {
+                size_t i = after(label);
+                if (i >= n || instructions[i].type != InstructionType::JMP)
+                    break;
+                label = instructions[i].operand1;
+            }
+            return position.count(label) ? canonical[label] : label;
+        };
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            Instruction &instr = instructions[i];
+            if (removed[i])
+                continue;
+
+            // ما بعد قفزة غير مشروطة أو إرجاع لا يصل إليه شيء حتى التسمية التالية
+            if (isTerminator(instr.type))
+            {
+                for (size_t j = i + 1; j < n && instructions[j].type != InstructionType::LABEL &&
+                                       instructions[j].type != InstructionType::FUNC;
+                     ++j)
+                {
+                    removed[j] = true;
+                    progress = true;
+                }
+            }
+
+            std::string target = getJumpTarget(instr);
+            if (target.empty() || !position.count(target))
+                continue;
+            std::string resolved = resolve(target);
+            if (resolved != target)
+            {
+                setJumpTarget(instr, resolved);
+                target = resolved;
+                progress = true;
+            }
+
+            // قفزة إلى التعليمة التالية مباشرة
+            size_t destination = position.at(target);
+            bool fallsThrough = destination > i;
+            for (size_t j = i + 1; fallsThrough && j < destination; ++j)
+                fallsThrough = removed[j] || instructions[j].type == InstructionType::LABEL;
+            if (fallsThrough)
+            {
+                removed[i] = true;
+                progress = true;
+                continue;
+            }
+
+            if (instr.type == InstructionType::JMP)
+            {
+                // القفز إلى إرجاع أو إنهاء يصبح الإرجاع نفسه
+                size_t landing = after(target);
+                if (landing < n && (instructions[landing].type == InstructionType::RET ||
+                                    instructions[landing].type == InstructionType::HALT))
+                {
+                    instr = instructions[landing];
+                    progress = true;
+                }
+                continue;
+            }
+
+            // شرط يقفز فوق قفزة غير مشروطة: يُعكس الشرط وتُحذف القفزة
+            if (i + 1 < n && instructions[i + 1].type == InstructionType::JMP && !removed[i + 1])
+            {
+                bool skipsJump = false;
+                for (size_t j = i + 2; j < n && instructions[j].type == InstructionType::LABEL; ++j)
+                    skipsJump = skipsJump || instructions[j].operand1 == target;
+                if (skipsJump)
+                {
+                    instr.type = invertJump(instr.type);
+                    setJumpTarget(instr, instructions[i + 1].operand1);
+                    removed[i + 1] = true;
+                    progress = true;
+                }
+            }
+        }
+
+        std::vector<Instruction> kept;
+        kept.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (!removed[i])
+                kept.push_back(instructions[i]);
+        }
+        instructions = std::move(kept);
+        if (instructions.empty())
+            break;
+
+        // الكتل التي لا تصل إليها أي بداية، والتسميات التي لا يقفز إليها شيء،
+        // والمقارنات التي حُذفت قفزاتها
+        ControlFlowGraph cfg(instructions);
+        std::unordered_set<std::string> referenced;
+        for (size_t i = 0; i < instructions.size(); ++i)
+        {
+            if (cfg.isReachable(cfg.blockOf(i)))
+                referenced.insert(getJumpTarget(instructions[i]));
+        }
+        kept.clear();
+        for (size_t i = 0; i < instructions.size(); ++i)
+        {
+            const Instruction &instr = instructions[i];
+            bool dead = !cfg.isReachable(cfg.blockOf(i)) ||
+                        (instr.type == InstructionType::LABEL && !referenced.count(instr.operand1)) ||
+                        (instr.type == InstructionType::CMP &&
+                         (i + 1 >= instructions.size() || !isConditionalJump(instructions[i + 1].type)));
+            if (dead)
+                progress = true;
+            else
+                kept.push_back(instr);
+        }
+        instructions = std::move(kept);
+        changed = changed || progress;
+    }
+    return changed;
+}
+
+// قيمة معامل صحيح ثابت: عدد مكتوب أو مؤقت يُعرَّف مرة واحدة بتحميل عدد، ضمن مدى int
+static bool integerOperand(const std::string &operand, const std::unordered_map<std::string, long long> &constants,
+                           long long &value)
+{
+    if (isNumericOperand(operand))
+    {
+        if (operand.find('.') != std::string::npos || operand.size() > 11)
+            return false;
+        value = std::stoll(operand);
+    }
+    else
+    {
+        auto it = constants.find(operand);
+        if (it == constants.end())
+            return false;
+        value = it->second;
+    }
+    return value > -2147483648LL && value < 2147483648LL;
+}
+
+static std::unordered_map<std::string, long long> integerTemps(const std::vector<Instruction> &code)
+{
+    std::unordered_map<std::string, int> defCount;
+    std::unordered_map<std::string, long long> values;
+    const std::unordered_map<std::string, long long> none;
+    for (const auto &instr : code)
+    {
+        std::string def = getDefinedName(instr);
+        if (!isTempName(def))
+            continue;
+        long long value;
+        if (defCount[def]++ == 0 && instr.type == InstructionType::LOAD && integerOperand(instr.operand2, none, value))
+            values[def] = value;
+    }
+    for (auto it = values.begin(); it != values.end();)
+        it = defCount[it->first] == 1 ? std::next(it) : values.erase(it);
+    return values;
+}
+
+// نوع المتغير بصيغة جدول الرموز؛ أسماء محليات الإطارات تحمل اسم الإجراء فلا تتصادم
+std::string Optimizer::metaOf(const std::string &name) const
+{
+    if (symbolTable)
+    {
+        auto it = symbolTable->find(name);
+        if (it != symbolTable->end())
+            return it->second;
+    }
+    if (frames)
+    {
+        for (const auto &entry : *frames)
+        {
+            auto it = entry.second.symbols.find(name);
+            if (it != entry.second.symbols.end())
+                return it->second;
+        }
+    }
+    return "";
+}
+
+// المؤقتات التي تحمل عدداً صحيحاً في كل تعريف لها: عدد صحيح مكتوب، أو متغير
+// أو عنصر قائمة من نوع int، أو عملية على صحيحين. يبدأ كل مؤقت صحيحاً ويُستبعد
+// ما له تعريف غير مثبت حتى الاستقرار، فيبقى عداد الحلقة t = t + 1 صحيحاً
+std::unordered_set<std::string> Optimizer::integerValues() const
+{
+    std::unordered_set<std::string> integers;
+    for (const auto &instr : instructions)
+    {
+        std::string def = getDefinedName(instr);
+        if (isTempName(def))
+            integers.insert(def);
+    }
+
+    auto integer = [&](const std::string &operand)
+    {
+        if (operand == "صح" || operand == "خطأ")
+            return true;
+        if (isNumericOperand(operand))
+            return operand.find('.') == std::string::npos;
+        if (isTempName(operand))
+            return integers.count(operand) != 0;
+        return metaOf(operand) == "primitive:int";
+    };
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (const auto &instr : instructions)
+        {
+            std::string def = getDefinedName(instr);
+            if (!integers.count(def))
+                continue;
+            bool proven;
+            switch (instr.type)
+            {
+            case InstructionType::LOAD:
+            case InstructionType::STORE:
+                proven = integer(instr.operand2);
+                break;
+            case InstructionType::ADD:
+            case InstructionType::SUB:
+            case InstructionType::MUL:
+            case InstructionType::DIV:
+            case InstructionType::MOD:
+                proven = instr.operand3.empty() ? integer(instr.operand1) && integer(instr.operand2)
+                                                : integer(instr.operand2) && integer(instr.operand3);
+                break;
+            case InstructionType::LOAD_INDEXED:
+                proven = metaOf(instr.operand2).rfind("array:int:", 0) == 0;
+                break;
+            case InstructionType::AND:
+            case InstructionType::OR:
+            case InstructionType::SHL:
+            case InstructionType::SHR:
+            case InstructionType::SAR:
+            case InstructionType::BITAND:
+            case InstructionType::MULHI:
+                proven = true;
+                break;
+            default:
+                proven = false;
+                break;
+            }
+            if (!proven)
+            {
+                integers.erase(def);
+                changed = true;
+            }
+        }
+    }
+    return integers;
+}
+
+static int powerOfTwo(long long value)
+{
+    if (value <= 0 || (value & (value - 1)) != 0)
+        return -1;
+    int k = 0;
+    while ((1LL << k) != value)
+        ++k;
+    return k;
+}
+
+// الرقم السحري للقسمة الصحيحة بإشارة على ثابت d >= 3 ليس قوة للعدد 2
+// (Hacker's Delight، الفصل 10): q = hi(x * magic) [+ x] >> shift، ثم +1 للسالب
+static void divisionMagic(long long d, long long &magic, int &shift)
+{
+    const unsigned long long two31 = 0x80000000ULL;
+    unsigned long long anc = two31 - 1 - two31 % d;
+    int p = 31;
+    unsigned long long q1 = two31 / anc, r1 = two31 - q1 * anc;
+    unsigned long long q2 = two31 / d, r2 = two31 - q2 * d;
+    unsigned long long delta;
+    do
+    {
+        ++p;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc)
+        {
+            ++q1;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= static_cast<unsigned long long>(d))
+        {
+            ++q2;
+            r2 -= d;
+        }
+        delta = d - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+    magic = static_cast<long long>(q2 + 1);
+    if (magic >= 2147483648LL)
+        magic -= 4294967296LL;
+    shift = p - 32;
+}
+
+bool Optimizer::reduceStrength()
+{
+    bool changed = false;
+
+    // ضرب متغير الحلقة في ثابت يصبح جمعاً، حلقة بعد حلقة حتى لا يبقى شيء
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        ControlFlowGraph cfg(instructions);
+        auto constants = integerTemps(instructions);
+        auto integers = integerValues();
+        for (const auto &loop : cfg.findLoops())
+        {
+            if (reduceInductionMultiplies(cfg, loop, constants, integers))
+            {
+                progress = changed = true;
+                break;
+            }
+        }
+    }
+
+    auto constants = integerTemps(instructions);
+    auto integers = integerValues();
+    std::vector<Instruction> result;
+    result.reserve(instructions.size());
+    auto emit = [&result](InstructionType type, const std::string &a, const std::string &b = "",
+                          const std::string &c = "")
+    {
+        result.emplace_back(type, a, b, c);
+    };
+    auto negate = [&](const std::string &target, const std::string &value)
+    {
+        std::string zero = newTemp();
+        emit(InstructionType::LOAD, zero, "0");
+        emit(InstructionType::SUB, target, zero, value);
+    };
+    // x + (2^k - 1) للسالب فقط، لتقريب القسمة على 2^k نحو الصفر كما في C
+    auto roundTowardZero = [&](const std::string &x, int k)
+    {
+        std::string bias = newTemp();
+        if (k == 1)
+            emit(InstructionType::SHR, bias, x, "31");
+        else
+        {
+            std::string sign = newTemp();
+            emit(InstructionType::SAR, sign, x, "31");
+            emit(InstructionType::SHR, bias, sign, std::to_string(32 - k));
+        }
+        std::string sum = newTemp();
+        emit(InstructionType::ADD, sum, x, bias);
+        return sum;
+    };
+    // target = x / d حيث d > 1
+    auto divide = [&](const std::string &target, const std::string &x, long long d)
+    {
+        int k = powerOfTwo(d);
+        if (k > 0)
+        {
+            emit(InstructionType::SAR, target, roundTowardZero(x, k), std::to_string(k));
+            return;
+        }
+        long long magic;
+        int shift;
+        divisionMagic(d, magic, shift);
+        std::string q = newTemp();
+        emit(InstructionType::MULHI, q, x, std::to_string(magic));
+        if (magic < 0)
+        {
+            std::string added = newTemp();
+            emit(InstructionType::ADD, added, q, x);
+            q = added;
+        }
+        if (shift > 0)
+        {
+            std::string shifted = newTemp();
+            emit(InstructionType::SAR, shifted, q, std::to_string(shift));
+            q = shifted;
+        }
+        std::string sign = newTemp();
+        emit(InstructionType::SHR, sign, x, "31");
+        emit(InstructionType::ADD, target, q, sign);
+    };
+
+    for (const auto &instr : instructions)
+    {
+        long long c, unused;
+        bool reducible = !instr.operand3.empty() &&
+                         (instr.type == InstructionType::MUL || instr.type == InstructionType::DIV ||
+                          instr.type == InstructionType::MOD);
+        std::string x = instr.operand2;
+        // الإزاحة والرقم السحري لا يصحان إلا للقسمة والضرب الصحيحين
+        reducible = reducible && integers.count(instr.operand1);
+        if (reducible && integerOperand(instr.operand3, constants, c))
+            reducible = !integerOperand(x, constants, unused) && c != 0;
+        else if (reducible && instr.type == InstructionType::MUL && integerOperand(instr.operand2, constants, c))
+        {
+            x = instr.operand3;
+            reducible = !integerOperand(x, constants, unused) && c != 0;
+        }
+        else
+            reducible = false;
+
+        const std::string &target = instr.operand1;
+        long long magnitude = c < 0 ? -c : c;
+        if (!reducible)
+            result.push_back(instr);
+        else if (instr.type == InstructionType::MUL)
+        {
+            if (c == 1)
+                emit(InstructionType::LOAD, target, x);
+            else if (powerOfTwo(c) > 0)
+                emit(InstructionType::SHL, target, x, std::to_string(powerOfTwo(c)));
+            else
+                result.push_back(instr);
+        }
+        else if (instr.type == InstructionType::DIV)
+        {
+            if (c == 1)
+                emit(InstructionType::LOAD, target, x);
+            else if (magnitude == 1)
+                negate(target, x);
+            else if (c > 0)
+                divide(target, x, c);
+            else
+            {
+                std::string q = newTemp();
+                divide(q, x, magnitude);
+                negate(target, q);
+            }
+        }
+        else
+        {
+            // باقي C يأخذ إشارة المقسوم فقط: x % c == x % |c|
+            int k = powerOfTwo(magnitude);
+            if (magnitude == 1)
+                emit(InstructionType::LOAD, target, "0");
+            else if (k > 0)
+            {
+                std::string rounded = newTemp();
+                emit(InstructionType::BITAND, rounded, roundTowardZero(x, k), std::to_string(-magnitude));
+                emit(InstructionType::SUB, target, x, rounded);
+            }
+            else
+            {
+                std::string q = newTemp(), product = newTemp();
+                divide(q, x, magnitude);
+                emit(InstructionType::MUL, product, q, std::to_string(magnitude));
+                emit(InstructionType::SUB, target, x, product);
+            }
+        }
+        changed = changed || reducible;
+    }
+    instructions = std::move(result);
+    return eraseDeadDefinitions(instructions) || changed;
+}
+
+// إذا كانت كل كتابة لمتغير في الحلقة v = v + c فإن v * K يبقى في مؤقت r يُهيأ
+// قبل الحلقة ويزداد بـ c * K بعد كل كتابة، فيصبح كل ضرب v * K نسخاً من r
+bool Optimizer::reduceInductionMultiplies(const ControlFlowGraph &cfg, const Loop &loop,
+                                          const std::unordered_map<std::string, long long> &constants,
+                                          const std::unordered_set<std::string> &integers)
+{
+    const auto &blocks = cfg.getBlocks();
+    const BasicBlock &header = blocks[loop.header];
+    if (instructions[header.start].type != InstructionType::LABEL)
+        return false;
+    // التهيئة تُدرج قبل تسمية الرأس، فلا يدخل الحلقة إلا ما يسقط إليها
+    for (size_t p : header.predecessors)
+    {
+        if (!loop.contains(p) &&
+            (p + 1 != loop.header || getJumpTarget(instructions[blocks[p].end - 1]) == instructions[header.start].operand1))
+            return false;
+    }
+
+    struct Increment
+    {
+        std::string variable;
+        long long step;
+    };
+    std::unordered_set<std::string> invalid;                // متغيرات تُكتب بغير زيادة ثابتة
+    std::vector<std::pair<size_t, Increment>> stores;      // كتابات v = v + c
+    std::vector<std::pair<size_t, Increment>> multiplies;  // ضرب v في K (step = K)
+
+    for (size_t b : loop.blocks)
+    {
+        std::unordered_map<std::string, std::string> holds;    // مؤقت -> المتغير الذي يحمل قيمته الحالية
+        std::unordered_map<std::string, Increment> increments; // مؤقت = متغير + ثابت
+        for (size_t i = blocks[b].start; i < blocks[b].end; ++i)
+        {
+            const Instruction &instr = instructions[i];
+            if (instr.type == InstructionType::CALL || instr.type == InstructionType::RET || touchesReference(instr))
+                return false;
+            if (instr.type == InstructionType::READ)
+                invalid.insert(instr.operand1);
+
+            long long value;
+            if (instr.type == InstructionType::MUL && !instr.operand3.empty() && integers.count(instr.operand1))
+            {
+                const std::string *variable = nullptr;
+                if (holds.count(instr.operand2) && integerOperand(instr.operand3, constants, value))
+                    variable = &holds[instr.operand2];
+                else if (holds.count(instr.operand3) && integerOperand(instr.operand2, constants, value))
+                    variable = &holds[instr.operand3];
+                if (variable)
+                    multiplies.push_back({i, Increment{*variable, value}});
+            }
+
+            if (instr.type == InstructionType::STORE && !isTempName(instr.operand1))
+            {
+                const std::string &variable = instr.operand1;
+                auto increment = increments.find(instr.operand2);
+                if (increment != increments.end() && increment->second.variable == variable)
+                    stores.push_back({i, increment->second});
+                else
+                    invalid.insert(variable);
+                // ما حُمّل من المتغير قبل الكتابة لم يعد قيمته الحالية
+                for (auto it = holds.begin(); it != holds.end();)
+                    it = it->second == variable ? holds.erase(it) : std::next(it);
+                for (auto it = increments.begin(); it != increments.end();)
+                    it = it->second.variable == variable ? increments.erase(it) : std::next(it);
+                if (isTempName(instr.operand2))
+                    holds[instr.operand2] = variable;
+                continue;
+            }
+
+            std::string def = getDefinedName(instr);
+            if (def.empty())
+                continue;
+            holds.erase(def);
+            increments.erase(def);
+            if (instr.type == InstructionType::LOAD && !isTempName(instr.operand2) &&
+                !isConstantOperand(instr.operand2) && instr.operand2.find('.') == std::string::npos)
+                holds[def] = instr.operand2;
+            else if (instr.type == InstructionType::ADD && !instr.operand3.empty())
+            {
+                if (holds.count(instr.operand2) && integerOperand(instr.operand3, constants, value))
+                    increments[def] = Increment{holds[instr.operand2], value};
+                else if (holds.count(instr.operand3) && integerOperand(instr.operand2, constants, value))
+                    increments[def] = Increment{holds[instr.operand3], value};
+            }
+        }
+    }
+
+    // مؤقت لكل (متغير، ثابت)
+    std::map<std::pair<std::string, long long>, std::string> products;
+    std::unordered_map<size_t, std::string> copies;
+    for (const auto &entry : multiplies)
+    {
+        const Increment &mul = entry.second;
+        if (invalid.count(mul.variable))
+            continue;
+        bool fits = true;
+        for (const auto &store : stores)
+        {
+            long long delta = store.second.step * mul.step;
+            if (store.second.variable == mul.variable && (delta <= -2147483648LL || delta >= 2147483648LL))
+                fits = false;
+        }
+        if (!fits)
+            continue;
+        auto key = std::make_pair(mul.variable, mul.step);
+        if (!products.count(key))
+            products[key] = newTemp();
+        copies[entry.first] = products[key];
+    }
+    if (copies.empty())
+        return false;
+
+    std::vector<Instruction> result;
+    result.reserve(instructions.size() + 2 * products.size() + stores.size());
+    for (size_t i = 0; i < instructions.size(); ++i)
+    {
+        if (i == header.start)
+        {
+            std::unordered_map<std::string, std::string> loaded;
+            for (const auto &product : products)
+            {
+                const std::string &variable = product.first.first;
+                if (!loaded.count(variable))
+                {
+                    loaded[variable] = newTemp();
+                    result.emplace_back(InstructionType::LOAD, loaded[variable], variable);
+                }
+                result.emplace_back(InstructionType::MUL, product.second, loaded[variable],
+                                    std::to_string(product.first.second));
+            }
+        }
+        auto copy = copies.find(i);
+        if (copy != copies.end())
+            result.emplace_back(InstructionType::LOAD, instructions[i].operand1, copy->second);
+        else
+            result.push_back(instructions[i]);
+        for (const auto &store : stores)
+        {
+            if (store.first != i)
+                continue;
+            for (const auto &product : products)
+            {
+                if (product.first.first == store.second.variable)
+                    result.emplace_back(InstructionType::ADD, product.second, product.second,
+                                        std::to_string(store.second.step * product.first.second));
+            }
+        }
+    }
+    instructions = std::move(result);
+    return true;
+}
@@ -0,0 +1,58 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "Instruction.h"
+#include "CFG.h"
+#include "ProcedureFrame.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+// تحسينات تعمل على الكود الوسيط بعد الترجمة وقبل توليد المخرجات
+class Optimizer
+{
+private:
+    std::vector<Instruction> &instructions;
+    int &tempVarCounter;
+    int &labelCounter;
+    const std::unordered_map<std::string, ProcedureFrame> *frames; // إطارات الإجراءات حسب التسمية
+    const std::unordered_map<std::string, std::string> *symbolTable; // أنواع المتغيرات العامة والمضمنة
+
+    std::string newLabel();
+    std::string newTemp();
+
+    bool hoistFromLoop(const ControlFlowGraph &cfg, const Loop &loop);
+    bool touchesReference(const Instruction &instr) const;
+    std::string metaOf(const std::string &name) const;
+    std::unordered_set<std::string> integerValues() const;
+    bool reduceInductionMultiplies(const ControlFlowGraph &cfg, const Loop &loop,
+                                   const std::unordered_map<std::string, long long> &constants,
+                                   const std::unordered_set<std::string> &integers);
+
+public:
+    Optimizer(std::vector<Instruction> &instructions, int &tempVarCounter, int &labelCounter,
+              const std::unordered_map<std::string, ProcedureFrame> *frames = nullptr,
+              const std::unordered_map<std::string, std::string> *symbolTable = nullptr);
+
+    // تبسيط مخطط التدفق: تمرير القفزات إلى وجهاتها النهائية، حذف القفزات إلى
+    // التالي مباشرة والكود الذي لا يُوصل إليه والتسميات غير المستخدمة، ودمج الكتل
+    bool simplifyControlFlow();
+
+    // ترقيم القيم على شجرة المسيطرات: العملية المحسوبة من قبل (مع مراعاة تبديل
+    // معاملي + و* و و/أو) تُستبدل بنسخة من نتيجتها، وتُحذف الكتابات والفحوص المكررة
+    bool numberValues();
+
+    // تخفيف العمليات: ضرب متغير الحلقة في ثابت يصبح جمعاً، والضرب والقسمة والباقي
+    // على ثوابت تصبح إزاحات وأقنعة أو ضرباً في رقم سحري. يقتصر على القيم الصحيحة
+    bool reduceStrength();
+
+    // نقل التعليمات الثابتة داخل الحلقات إلى ما قبل رأس الحلقة
+    bool hoistLoopInvariants();
+
+    // الاستدعاء الأخير قبل الإرجاع: استدعاء الإجراء نفسه يصبح حلقة،
+    // واستدعاء غيره يُعلَّم "tail" ليعيد المولد استخدام الإطار الحالي
+    bool eliminateTailCalls();
+};
+
+#endif
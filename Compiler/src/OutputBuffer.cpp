@@ -0,0 +1,92 @@
+#include "OutputBuffer.h"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const size_t initialCapacity = 1 << 16;
+}
+
+OutputBuffer::Buffer::Buffer() : storage(initialCapacity)
+{
+    setp(storage.data(), storage.data() + storage.size());
+}
+
+void OutputBuffer::Buffer::grow(size_t extra)
+{
+    // مضاعفة السعة، مع إعادة مؤشر الكتابة إلى موضعه في المخزن الجديد
+    size_t used = size();
+    storage.resize(std::max(storage.size() * 2, used + extra));
+    setp(storage.data(), storage.data() + storage.size());
+    while (used > 0)
+    {
+        int step = static_cast<int>(std::min<size_t>(used, INT_MAX));
+        pbump(step);
+        used -= static_cast<size_t>(step);
+    }
+}
+
+OutputBuffer::Buffer::int_type OutputBuffer::Buffer::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+        return traits_type::not_eof(ch);
+    grow(1);
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
+
+std::streamsize OutputBuffer::Buffer::xsputn(const char *text, std::streamsize count)
+{
+    size_t length = static_cast<size_t>(count);
+    if (static_cast<size_t>(epptr() - pptr()) < length)
+        grow(length);
+    std::memcpy(pptr(), text, length);
+    while (length > 0)
+    {
+        int step = static_cast<int>(std::min<size_t>(length, INT_MAX));
+        pbump(step);
+        length -= static_cast<size_t>(step);
+    }
+    return count;
+}
+
+OutputBuffer::OutputBuffer() : std::ostream(nullptr)
+{
+    rdbuf(&buffer);
+}
+
+void OutputBuffer::commit(const std::string &filename, bool binary) const
+{
+    std::FILE *file = std::fopen(filename.c_str(), binary ? "wb" : "w");
+    if (!file)
+    {
+        throw std::runtime_error("لا يمكن فتح الملف: " + filename);
+    }
+    bool written = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    if (std::fclose(file) != 0 || !written)
+    {
+        throw std::runtime_error("تعذرت كتابة الملف: " + filename);
+    }
+}
+
+std::string escapeString(const std::string &text)
+{
+    std::string result;
+    result.reserve(text.size() + 8);
+    size_t start = 0;
+    for (size_t special = text.find_first_of("\"\\\n\t"); special != std::string::npos;
+         special = text.find_first_of("\"\\\n\t", start))
+    {
+        result.append(text, start, special - start);
+        char ch = text[special];
+        result += '\\';
+        result += ch == '\n' ? 'n' : ch == '\t' ? 't' : ch;
+        start = special + 1;
+    }
+    result.append(text, start, std::string::npos);
+    return result;
+}
@@ -0,0 +1,43 @@
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// مخرج المولدات: يُنسَّق كله في مخزن واحد في الذاكرة ثم يُكتب إلى الملف
+// باستدعاء واحد في commit(). std::endl لا يفرغ شيئاً قبل ذلك
+class OutputBuffer : public std::ostream
+{
+private:
+    class Buffer : public std::streambuf
+    {
+    private:
+        std::vector<char> storage;
+        void grow(size_t extra);
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char *text, std::streamsize count) override;
+
+    public:
+        Buffer();
+        const char *data() const { return pbase(); }
+        size_t size() const { return static_cast<size_t>(pptr() - pbase()); }
+    };
+
+    Buffer buffer;
+
+public:
+    OutputBuffer();
+
+    // كتابة ما تجمع إلى filename دفعة واحدة؛ binary لملفات الكائن
+    void commit(const std::string &filename, bool binary = false) const;
+};
+
+// نص سلسلة بين علامتي تنصيص في ملفات التجميع (MIPS وGNU as): هروب علامة
+// التنصيص والشرطة المائلة والسطر الجديد وTab، ونسخ ما بينها قطعة واحدة
+std::string escapeString(const std::string &text);
+
+#endif
@@ -1,4 +1,5 @@
 #include "Parser.h"
+#include "Console.h"
 #include <iostream>
 #include <memory>
 
@@ -22,7 +23,7 @@ Token Parser::consume(TokenType type, const std::string &message)
 {
     if (check(type))
         return advance();
-    std::cout << "[ERR] consume failed: expected=" << Token(type, "", 0, 0).typeToString()
+    consoleOutput() << "[ERR] consume failed: expected=" << Token(type, "", 0, 0).typeToString()
               << ", got=" << peek().typeToString() << " ('" << peek().value << ")"
               << " at line=" << peek().line << ", col=" << peek().column << std::endl;
     throw ParseError(peek(), message);
@@ -91,12 +92,12 @@ std::unique_ptr<ProgramNode> Parser::parse()
 {
     try
     {
-        std::cout << "[DBG] Parser::parse() starting with " << tokens.size() << " tokens" << std::endl;
+        consoleOutput() << "[DBG] Parser::parse() starting with " << tokens.size() << " tokens" << std::endl;
         return parseProgram();
     }
     catch (const ParseError &error)
     {
-        std::cout << "💥 خطأ في التحليل النحوي: " << error.what()
+        consoleOutput() << "💥 خطأ في التحليل النحوي: " << error.what()
                   << " في السطر " << error.token.line << std::endl;
         return nullptr;
     }
@@ -120,7 +121,7 @@ std::unique_ptr<ProgramNode> Parser::parseProgram()
     }
     program->name = advance().value;
 
-    std::cout << "[DBG] program name='" << program->name << "' next token="
+    consoleOutput() << "[DBG] program name='" << program->name << "' next token="
               << peek().typeToString() << " ('" << peek().value << ")" << std::endl;
 
     // قبول فاصلة منقوطة اختيارية بعد اسم البرنامج
@@ -139,7 +140,7 @@ std::unique_ptr<ProgramNode> Parser::parseProgram()
         if (check(TokenType::VARIABLE) || check(TokenType::CONSTANT) ||
             check(TokenType::TYPE) || check(TokenType::PROCEDURE))
         {
-            std::cout << "[DBG] parsing declaration, current token=" << peek().typeToString()
+            consoleOutput() << "[DBG] parsing declaration, current token=" << peek().typeToString()
                       << " ('" << peek().value << ")" << std::endl;
             auto decl = parseDeclaration();
             if (decl)
@@ -149,13 +150,13 @@ std::unique_ptr<ProgramNode> Parser::parseProgram()
             else
             {
                 // إذا كانت النتيجة nullptr، فهذا جملة تعيين، معالجتها كجملة
-                std::cout << "[DBG] declaration returned nullptr, treating as statement" << std::endl;
+                consoleOutput() << "[DBG] declaration returned nullptr, treating as statement" << std::endl;
                 program->statements.push_back(parseStatement());
             }
         }
         else
         {
-            std::cout << "[DBG] parsing statement, current token=" << peek().typeToString()
+            consoleOutput() << "[DBG] parsing statement, current token=" << peek().typeToString()
                       << " ('" << peek().value << ") at line=" << peek().line << std::endl;
             program->statements.push_back(parseStatement());
         }
@@ -164,13 +165,13 @@ std::unique_ptr<ProgramNode> Parser::parseProgram()
     // قبول كلمة "نهاية" اختيارية في النهاية
     if (match(TokenType::END))
     {
-        std::cout << "[DBG] found END keyword" << std::endl;
+        consoleOutput() << "[DBG] found END keyword" << std::endl;
     }
 
     // قبول النقطة الأخيرة (نهاية البرنامج)
     if (match(TokenType::DOT))
     {
-        std::cout << "[DBG] found DOT (end of program)" << std::endl;
+        consoleOutput() << "[DBG] found DOT (end of program)" << std::endl;
     }
 
     return program;
@@ -237,7 +238,7 @@ std::unique_ptr<VariableDeclarationNode> Parser::parseVariableDeclaration()
 {
     auto declaration = std::make_unique<VariableDeclarationNode>();
 
-    std::cout << "[DBG] parseVariableDeclaration: expecting IDENTIFIER, got "
+    consoleOutput() << "[DBG] parseVariableDeclaration: expecting IDENTIFIER, got "
               << peek().typeToString() << " ('" << peek().value << ") at line="
               << peek().line << ", col=" << peek().column << std::endl;
 
@@ -257,14 +258,14 @@ std::unique_ptr<VariableDeclarationNode> Parser::parseVariableDeclaration()
         throw ParseError(peek(), "توقع اسم المتغير");
     }
 
-    std::cout << "[DBG] name='" << declaration->name << "' next="
+    consoleOutput() << "[DBG] name='" << declaration->name << "' next="
               << peek().typeToString() << " ('" << peek().value << ")" << std::endl;
 
     // إذا رأينا LBRACKET أو DOT بدلاً من COLON، فهذا ليس تعريف متغير
     // بل هو جملة تعيين، لذا نرجع nullptr للإشارة إلى أن هذا ليس تعريفاً
     if (check(TokenType::LBRACKET) || check(TokenType::DOT))
     {
-        std::cout << "[DBG] Not a variable declaration, looks like assignment" << std::endl;
+        consoleOutput() << "[DBG] Not a variable declaration, looks like assignment" << std::endl;
         // نعود للخلف بخطوة واحدة
         current--;
         return nullptr;
@@ -273,11 +274,11 @@ std::unique_ptr<VariableDeclarationNode> Parser::parseVariableDeclaration()
     // نوع اختياري: ": نوع"
     if (match(TokenType::COLON))
     {
-        std::cout << "[DBG] saw ':' then token=" << peek().typeToString() << " ('" << peek().value << ")" << std::endl;
+        consoleOutput() << "[DBG] saw ':' then token=" << peek().typeToString() << " ('" << peek().value << ")" << std::endl;
         declaration->typeNode = parseType();
         if (declaration->typeNode)
         {
-            std::cout << "[DBG] parsed structured type: '" << declaration->typeNode->toString() << "'" << std::endl;
+            consoleOutput() << "[DBG] parsed structured type: '" << declaration->typeNode->toString() << "'" << std::endl;
         }
     }
 
@@ -319,7 +320,7 @@ std::unique_ptr<ConstantDeclarationNode> Parser::parseConstantDeclaration()
 
 std::unique_ptr<ASTNode> Parser::parseStatement()
 {
-    std::cout << "[DBG] parseStatement at token=" << peek().typeToString()
+    consoleOutput() << "[DBG] parseStatement at token=" << peek().typeToString()
               << " ('" << peek().value << ") line=" << peek().line << std::endl;
 
     // السماح بالكلمات المحجوزة كأسماء متغيرات في جمل التعيين
@@ -388,7 +389,7 @@ std::unique_ptr<ASTNode> Parser::parseStatement()
     }
     else
     {
-        std::cout << "[DBG] parseStatement no match for token=" << peek().typeToString()
+        consoleOutput() << "[DBG] parseStatement no match for token=" << peek().typeToString()
                   << " ('" << peek().value << ") line=" << peek().line << std::endl;
         throw ParseError(peek(), "توقع جملة صالحة");
     }
@@ -861,7 +862,7 @@ void Parser::printAST(const ASTNode *node, int depth) const
         return;
 
     std::string indent(depth * 2, ' ');
-    std::cout << indent << "├─ " << node->toString() << " [" << node->getTypeName() << "]" << std::endl;
+    consoleOutput() << indent << "├─ " << node->toString() << " [" << node->getTypeName() << "]" << std::endl;
 
     if (auto program = dynamic_cast<const ProgramNode *>(node))
     {
@@ -946,21 +947,21 @@ void Parser::printProgramStructure(const ProgramNode *program) const
     if (!program)
         return;
 
-    std::cout << "\n🌳 هيكل شجرة الاشتقاق النحوي (AST):" << std::endl;
-    std::cout << "=================================" << std::endl;
-    std::cout << "اسم البرنامج: " << program->name << std::endl;
-    std::cout << "عدد التعريفات: " << program->declarations.size() << std::endl;
-    std::cout << "عدد الجمل: " << program->statements.size() << std::endl;
-    std::cout << "---------------------------------" << std::endl;
+    consoleOutput() << "\n🌳 هيكل شجرة الاشتقاق النحوي (AST):" << std::endl;
+    consoleOutput() << "=================================" << std::endl;
+    consoleOutput() << "اسم البرنامج: " << program->name << std::endl;
+    consoleOutput() << "عدد التعريفات: " << program->declarations.size() << std::endl;
+    consoleOutput() << "عدد الجمل: " << program->statements.size() << std::endl;
+    consoleOutput() << "---------------------------------" << std::endl;
 
     for (const auto &decl : program->declarations)
     {
-        std::cout << "تعريف: " << decl->toString() << std::endl;
+        consoleOutput() << "تعريف: " << decl->toString() << std::endl;
     }
 
     for (const auto &stmt : program->statements)
     {
-        std::cout << "جملة: " << stmt->toString() << std::endl;
+        consoleOutput() << "جملة: " << stmt->toString() << std::endl;
     }
 }
 
@@ -971,7 +972,7 @@ std::unique_ptr<ProcedureDeclarationNode> Parser::parseProcedureDeclaration()
 
     // الحصول على اسم الإجراء
     procDecl->name = consume(TokenType::IDENTIFIER, "توقع اسم الإجراء").value;
-    std::cout << "[DBG] Parsing procedure: " << procDecl->name << std::endl;
+    consoleOutput() << "[DBG] Parsing procedure: " << procDecl->name << std::endl;
 
     // معالجة المعاملات
     consume(TokenType::LPAREN, "توقع '(' بعد اسم الإجراء");
@@ -993,7 +994,7 @@ std::unique_ptr<ProcedureDeclarationNode> Parser::parseProcedureDeclaration()
         if (check(TokenType::VARIABLE) || check(TokenType::CONSTANT) ||
             check(TokenType::TYPE) || check(TokenType::PROCEDURE))
         {
-            std::cout << "[DBG] parsing declaration in procedure body, current token=" << peek().typeToString()
+            consoleOutput() << "[DBG] parsing declaration in procedure body, current token=" << peek().typeToString()
                       << " ('" << peek().value << ")" << std::endl;
             auto decl = parseDeclaration();
             if (decl)
@@ -1003,7 +1004,7 @@ std::unique_ptr<ProcedureDeclarationNode> Parser::parseProcedureDeclaration()
             else
             {
                 // إذا كانت النتيجة nullptr، فهذا جملة تعيين، معالجتها كجملة
-                std::cout << "[DBG] declaration returned nullptr in procedure, treating as statement" << std::endl;
+                consoleOutput() << "[DBG] declaration returned nullptr in procedure, treating as statement" << std::endl;
                 procDecl->body.push_back(parseStatement());
             }
         }
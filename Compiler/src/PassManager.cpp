@@ -0,0 +1,124 @@
+#include "PassManager.h"
+#include "Optimizer.h"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+PassManager::PassManager() : level(1), unrollFactor(4)
+{
+    registerPass("inline", "تضمين الإجراءات الصغيرة غير التعاودية في مواضع استدعائها",
+                 PassKind::Lowering, 1);
+    registerPass("unroll", "فك حلقات كرر ذات الحدود الثابتة كلياً أو جزئياً",
+                 PassKind::Lowering, 2);
+    registerPass("bounds", "حذف فحوص حدود القوائم الزائدة ونقل فحوص العدادات إلى ما قبل الحلقة",
+                 PassKind::Lowering, 1);
+    registerPass("simplifycfg", "تمرير القفزات وحذف الكتل غير القابلة للوصول والتسميات الزائدة",
+                 PassKind::IR, 1,
+                 [](Optimizer &optimizer)
+                 { return optimizer.simplifyControlFlow(); });
+    registerPass("cse", "حذف العمليات المكررة بترقيم القيم", PassKind::IR, 1,
+                 [](Optimizer &optimizer)
+                 { return optimizer.numberValues(); });
+    registerPass("licm", "نقل التعليمات الثابتة خارج الحلقات", PassKind::IR, 1,
+                 [](Optimizer &optimizer)
+                 { return optimizer.hoistLoopInvariants(); });
+    registerPass("strength", "استبدال الضرب والقسمة على الثوابت بعمليات أرخص", PassKind::IR, 1,
+                 [](Optimizer &optimizer)
+                 { return optimizer.reduceStrength(); });
+    registerPass("tailcall", "تحويل الاستدعاء الأخير في الإجراء إلى قفزة تعيد استخدام إطاره", PassKind::IR, 1,
+                 [](Optimizer &optimizer)
+                 { return optimizer.eliminateTailCalls(); });
+    registerPass("regalloc", "توزيع السجلات في MIPS", PassKind::Codegen, 1);
+    registerPass("peephole", "محسّن ثقب المفتاح لتعليمات MIPS", PassKind::Codegen, 1);
+    registerPass("slots", "إعادة استخدام خانات المؤقتات حسب أعمارها", PassKind::Codegen, 1);
+
+    setOptimizationLevel(1);
+}
+
+void PassManager::registerPass(const std::string &name, const std::string &description, PassKind kind,
+                               int minLevel, std::function<bool(Optimizer &)> run)
+{
+    registry.push_back(Pass{name, description, kind, minLevel, std::move(run)});
+}
+
+const PassManager::Pass *PassManager::find(const std::string &name) const
+{
+    for (const auto &pass : registry)
+    {
+        if (pass.name == name)
+            return &pass;
+    }
+    return nullptr;
+}
+
+void PassManager::setOptimizationLevel(int optimizationLevel)
+{
+    if (optimizationLevel < 0 || optimizationLevel > 2)
+    {
+        throw std::runtime_error("مستوى تحسين غير مدعوم: " + std::to_string(optimizationLevel));
+    }
+    level = optimizationLevel;
+    pipeline.clear();
+    for (const auto &pass : registry)
+    {
+        if (pass.minLevel <= level)
+            pipeline.push_back(pass.name);
+    }
+}
+
+void PassManager::setPasses(const std::string &names)
+{
+    std::vector<std::string> selected;
+    std::stringstream stream(names);
+    std::string name;
+    while (std::getline(stream, name, ','))
+    {
+        if (name.empty())
+            continue;
+        if (!find(name))
+        {
+            throw std::runtime_error("تمريرة غير معروفة: " + name);
+        }
+        if (std::find(selected.begin(), selected.end(), name) == selected.end())
+            selected.push_back(name);
+    }
+    pipeline = selected;
+}
+
+void PassManager::setUnrollFactor(int factor)
+{
+    if (factor < 1 || factor > 64)
+    {
+        throw std::runtime_error("معامل فك الحلقات غير مدعوم: " + std::to_string(factor));
+    }
+    unrollFactor = factor;
+}
+
+bool PassManager::isEnabled(const std::string &name) const
+{
+    return std::find(pipeline.begin(), pipeline.end(), name) != pipeline.end();
+}
+
+void PassManager::run(std::vector<Instruction> &instructions, int &tempVarCounter, int &labelCounter,
+                      const std::unordered_map<std::string, ProcedureFrame> &frames,
+                      const std::unordered_map<std::string, std::string> &symbolTable) const
+{
+    if (instructions.empty())
+        return;
+
+    Optimizer optimizer(instructions, tempVarCounter, labelCounter, &frames, &symbolTable);
+    for (const auto &name : pipeline)
+    {
+        const Pass *pass = find(name);
+        if (pass && pass->kind == PassKind::IR && pass->run)
+            pass->run(optimizer);
+    }
+}
+
+void PassManager::describe(std::ostream &out) const
+{
+    for (const auto &pass : registry)
+    {
+        out << "  " << pass.name << " (-O" << pass.minLevel << ")  " << pass.description << std::endl;
+    }
+}
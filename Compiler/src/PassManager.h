@@ -0,0 +1,71 @@
+#ifndef PASS_MANAGER_H
+#define PASS_MANAGER_H
+
+#include "Instruction.h"
+#include "ProcedureFrame.h"
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class Optimizer;
+
+// مدير التمريرات: يسجل تمريرات الكود الوسيط وخيارات توليد الكود،
+// ويختار المفعّل منها حسب مستوى التحسين (-O0/-O1/-O2) أو --passes=
+class PassManager
+{
+public:
+    // Lowering: خيار يقرؤه Compiler أثناء ترجمة الشجرة (مثل التضمين)
+    // IR: تعمل على الكود الوسيط بين compile والمولدات
+    // Codegen: خيار يقرؤه المولد نفسه (مثل توزيع السجلات)
+    enum class PassKind
+    {
+        Lowering,
+        IR,
+        Codegen
+    };
+
+private:
+    struct Pass
+    {
+        std::string name;
+        std::string description;
+        PassKind kind;
+        int minLevel; // أدنى مستوى تحسين يفعّل التمريرة
+        std::function<bool(Optimizer &)> run;
+    };
+
+    std::vector<Pass> registry;
+    std::vector<std::string> pipeline; // أسماء التمريرات المفعّلة بترتيب التشغيل
+    int level;
+    int unrollFactor; // عدد نسخ جسم الحلقة عند الفك الجزئي
+
+    const Pass *find(const std::string &name) const;
+
+public:
+    PassManager();
+
+    void registerPass(const std::string &name, const std::string &description, PassKind kind,
+                      int minLevel, std::function<bool(Optimizer &)> run = nullptr);
+
+    void setOptimizationLevel(int optimizationLevel);
+    int getOptimizationLevel() const { return level; }
+
+    // قائمة مفصولة بفواصل تحل محل اختيار المستوى؛ ترمي استثناء لاسم غير معروف
+    void setPasses(const std::string &names);
+
+    bool isEnabled(const std::string &name) const;
+
+    // معامل الفك الجزئي للحلقات (1 يعطّل الفك الجزئي ويُبقي الفك الكامل)
+    void setUnrollFactor(int factor);
+    int getUnrollFactor() const { return unrollFactor; }
+
+    // تشغيل تمريرات الكود الوسيط المفعّلة بالترتيب
+    void run(std::vector<Instruction> &instructions, int &tempVarCounter, int &labelCounter,
+             const std::unordered_map<std::string, ProcedureFrame> &frames,
+             const std::unordered_map<std::string, std::string> &symbolTable) const;
+
+    void describe(std::ostream &out) const;
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef PROCEDURE_FRAME_H
+#define PROCEDURE_FRAME_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// إطار إجراء مترجم كدالة حقيقية: معاملاته ومتغيراته المحلية تعيش في
+// إطار على المكدس لكل استدعاء، فيمكن للإجراء أن يستدعي نفسه
+struct ProcedureFrame
+{
+    std::string label;
+    std::vector<std::string> parameters;                  // أسماء المعاملات في الكود الوسيط بالترتيب
+    std::unordered_set<std::string> byReference;          // المعاملات التي تحمل عنوان متغير المستدعي
+    std::vector<std::string> locals;                      // المتغيرات المحلية بترتيب تعريفها
+    std::unordered_map<std::string, std::string> symbols; // الاسم -> النوع بصيغة جدول الرموز
+
+    bool owns(const std::string &name) const { return symbols.count(name) != 0; }
+};
+
+#endif
@@ -0,0 +1,187 @@
+#include "RegisterAllocator.h"
+#include "CFG.h"
+#include <algorithm>
+#include <set>
+#include <unordered_set>
+
+RegisterAllocator::RegisterAllocator(const std::vector<Instruction> &code,
+                                     std::function<bool(const std::string &)> allocatable)
+    : code(code), allocatable(std::move(allocatable)) {}
+
+std::vector<RegisterAllocator::Interval> RegisterAllocator::buildIntervals()
+{
+    ControlFlowGraph cfg(code);
+    Liveness liveness = cfg.computeLiveness(allocatable);
+    const auto &blocks = cfg.getBlocks();
+
+    // عمق الحلقات لكل كتلة لترجيح كلفة الإبقاء في الذاكرة
+    std::vector<int> blockDepth(blocks.size(), 0);
+    for (const auto &loop : cfg.findLoops())
+    {
+        for (size_t b : loop.blocks)
+            blockDepth[b] = std::max(blockDepth[b], loop.depth);
+    }
+
+    std::unordered_map<std::string, Interval> intervals;
+    auto touch = [&](const std::string &name, size_t position, double weight)
+    {
+        auto it = intervals.find(name);
+        if (it == intervals.end())
+        {
+            intervals.emplace(name, Interval{name, position, position, weight});
+            return;
+        }
+        it->second.start = std::min(it->second.start, position);
+        it->second.end = std::max(it->second.end, position);
+        it->second.weight += weight;
+    };
+
+    std::vector<std::string> uses;
+    for (size_t b = 0; b < blocks.size(); ++b)
+    {
+        const BasicBlock &block = blocks[b];
+        for (const auto &name : liveness.liveIn[b])
+            touch(name, block.start, 0);
+        for (const auto &name : liveness.liveOut[b])
+            touch(name, block.end - 1, 0);
+
+        double weight = 1;
+        for (int d = 0; d < blockDepth[b]; ++d)
+            weight *= 10;
+
+        for (size_t i = block.start; i < block.end; ++i)
+        {
+            uses.clear();
+            getUsedNames(code[i], uses);
+            // معاملا CMP يُقرآن فعلياً عند القفزة الشرطية التالية
+            size_t usePosition = i;
+            if (code[i].type == InstructionType::CMP && i + 1 < block.end &&
+                isConditionalJump(code[i + 1].type))
+                usePosition = i + 1;
+            for (const auto &name : uses)
+            {
+                if (allocatable(name))
+                {
+                    touch(name, i, weight);
+                    touch(name, usePosition, 0);
+                }
+            }
+            std::string def = getDefinedName(code[i]);
+            if (!def.empty() && allocatable(def))
+                touch(def, i, weight);
+        }
+    }
+
+    if (!blocks.empty())
+    {
+        for (const auto &name : liveness.liveIn[0])
+            liveAtEntry.push_back(name);
+        std::sort(liveAtEntry.begin(), liveAtEntry.end());
+    }
+
+    std::vector<Interval> result;
+    result.reserve(intervals.size());
+    for (auto &entry : intervals)
+        result.push_back(entry.second);
+    std::sort(result.begin(), result.end(), [](const Interval &a, const Interval &b)
+              { return a.start != b.start ? a.start < b.start : a.name < b.name; });
+    return result;
+}
+
+void RegisterAllocator::allocate(const std::vector<std::string> &registers)
+{
+    assignment.clear();
+    liveAtEntry.clear();
+    std::vector<Interval> intervals = buildIntervals();
+
+    std::set<size_t> freeRegisters;
+    for (size_t r = 0; r < registers.size(); ++r)
+        freeRegisters.insert(r);
+
+    // الفترات النشطة مع رقم السجل المخصص لكل منها
+    std::vector<std::pair<Interval, size_t>> active;
+
+    for (const auto &current : intervals)
+    {
+        // تحرير سجلات الفترات المنتهية قبل بداية الفترة الحالية
+        for (auto it = active.begin(); it != active.end();)
+        {
+            if (it->first.end < current.start)
+            {
+                freeRegisters.insert(it->second);
+                it = active.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (!freeRegisters.empty())
+        {
+            size_t r = *freeRegisters.begin();
+            freeRegisters.erase(freeRegisters.begin());
+            active.push_back({current, r});
+            assignment[current.name] = registers[r];
+            continue;
+        }
+
+        // لا سجل حر: يبقى في الذاكرة الأقل وزناً (والأبعد نهاية عند التساوي)
+        auto victim = active.end();
+        for (auto it = active.begin(); it != active.end(); ++it)
+        {
+            const Interval &candidate = victim == active.end() ? current : victim->first;
+            if (it->first.weight < candidate.weight ||
+                (it->first.weight == candidate.weight && it->first.end > candidate.end))
+                victim = it;
+        }
+        if (victim == active.end())
+            continue; // الفترة الحالية هي الأرخص
+
+        size_t r = victim->second;
+        assignment.erase(victim->first.name);
+        active.erase(victim);
+        active.push_back({current, r});
+        assignment[current.name] = registers[r];
+    }
+
+    liveAtEntry.erase(std::remove_if(liveAtEntry.begin(), liveAtEntry.end(),
+                                     [this](const std::string &name)
+                                     { return !inRegister(name); }),
+                      liveAtEntry.end());
+}
+
+int RegisterAllocator::allocateSlots(const std::string &prefix)
+{
+    // عدد الخانات لا يتجاوز عدد الأسماء، فلا يبقى شيء في الذاكرة
+    std::unordered_set<std::string> names;
+    std::vector<std::string> uses;
+    for (const auto &instr : code)
+    {
+        uses.clear();
+        getUsedNames(instr, uses);
+        uses.push_back(getDefinedName(instr));
+        for (const auto &name : uses)
+        {
+            if (!name.empty() && allocatable(name))
+                names.insert(name);
+        }
+    }
+
+    std::vector<std::string> slots;
+    for (size_t i = 0; i < names.size(); ++i)
+        slots.push_back(prefix + std::to_string(i));
+    allocate(slots);
+
+    // يُختار دائماً أصغر رقم حر، فالخانات المستخدمة متصلة من الصفر
+    std::unordered_set<std::string> used;
+    for (const auto &entry : assignment)
+        used.insert(entry.second);
+    return static_cast<int>(used.size());
+}
+
+std::string RegisterAllocator::registerOf(const std::string &name) const
+{
+    auto it = assignment.find(name);
+    return it == assignment.end() ? "" : it->second;
+}
@@ -0,0 +1,49 @@
+#ifndef REGISTER_ALLOCATOR_H
+#define REGISTER_ALLOCATOR_H
+
+#include "Instruction.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <functional>
+
+// توزيع السجلات بطريقة المسح الخطي (linear scan) على الكود الوسيط.
+// كل اسم مقبول (مؤقت أو متغير بسيط) يحصل على فترة حياة من تحليل الحيوية،
+// وعند نفاد السجلات يبقى الاسم الأقل استخداماً في الذاكرة.
+class RegisterAllocator
+{
+private:
+    struct Interval
+    {
+        std::string name;
+        size_t start;
+        size_t end;
+        double weight; // عدد الاستخدامات مرجحاً بعمق الحلقات
+    };
+
+    const std::vector<Instruction> &code;
+    std::function<bool(const std::string &)> allocatable;
+    std::unordered_map<std::string, std::string> assignment;
+    std::vector<std::string> liveAtEntry;
+
+    std::vector<Interval> buildIntervals();
+
+public:
+    RegisterAllocator(const std::vector<Instruction> &code,
+                      std::function<bool(const std::string &)> allocatable);
+
+    void allocate(const std::vector<std::string> &registers);
+
+    // توزيع بلا حد على خانات باسم prefix + رقم: الأسماء التي لا تتداخل
+    // أعمارها تتشارك خانة واحدة. يعيد عدد الخانات المستخدمة.
+    int allocateSlots(const std::string &prefix);
+
+    // السجل المخصص للاسم، أو نص فارغ إذا بقي في الذاكرة
+    std::string registerOf(const std::string &name) const;
+    bool inRegister(const std::string &name) const { return assignment.count(name) != 0; }
+
+    // أسماء في سجلات تُقرأ قبل أي كتابة، فتحتاج تهيئة بصفر كما في .data
+    const std::vector<std::string> &getLiveAtEntry() const { return liveAtEntry; }
+};
+
+#endif
@@ -0,0 +1,679 @@
+#include "StructuredCGenerator.h"
+#include "Console.h"
+#include <iostream>
+#include <stdexcept>
+
+StructuredCGenerator::StructuredCGenerator(ProgramNode *program, bool checkedArrays)
+    : program(program), insideProcedure(false), checkedArrays(checkedArrays) {}
+
+static std::string quote(const std::string &text)
+{
+    std::string result = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        if (c == '\n')
+        {
+            result += "\\n";
+            continue;
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+// اسم المتغير دون الحقل: موظف.العمر -> موظف
+static std::string baseName(const std::string &name)
+{
+    size_t dot = name.find('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+void StructuredCGenerator::collect()
+{
+    std::vector<ASTNode *> topLevel;
+    for (auto &decl : program->declarations)
+        topLevel.push_back(decl.get());
+    for (auto &stmt : program->statements)
+        topLevel.push_back(stmt.get());
+
+    std::vector<ASTNode *> all;
+    for (ASTNode *node : topLevel)
+    {
+        if (auto proc = dynamic_cast<ProcedureDeclarationNode *>(node))
+        {
+            procedures.push_back(proc);
+            for (auto &stmt : proc->body)
+                walkAST(stmt.get(), [&all](ASTNode *n)
+                        { all.push_back(n); });
+        }
+        else
+        {
+            walkAST(node, [&all](ASTNode *n)
+                    { all.push_back(n); });
+        }
+    }
+
+    // أنواع السجلات والقوائم المسماة (نوع <اسم> = ...) بترتيب تعريفها
+    for (ASTNode *node : all)
+    {
+        auto decl = dynamic_cast<VariableDeclarationNode *>(node);
+        if (!decl || !decl->typeNode)
+            continue;
+        auto type = static_cast<TypeNode *>(decl->typeNode.get());
+        if (dynamic_cast<ArrayTypeNode *>(type) && !typeNames.count(decl->name))
+            typeNames[decl->name] = type;
+        auto rec = dynamic_cast<RecordTypeNode *>(type);
+        if (!rec || records.count(decl->name))
+            continue;
+        typeNames[decl->name] = type;
+        Record record;
+        record.tag = "struct_" + decl->name;
+        for (const auto &field : rec->fields)
+            record.fields.emplace_back(field.name, resolveType(field.type.get(), field.name).ctype);
+        records[decl->name] = record;
+        recordOrder.push_back(decl->name);
+    }
+
+    // متغيرات البرنامج التي تقرؤها الإجراءات أو تكتبها تبقى في مستوى الملف،
+    // وما عداها يصبح متغيراً محلياً في main
+    for (auto *proc : procedures)
+    {
+        std::unordered_set<std::string> own;
+        for (const auto &param : proc->parameters)
+            own.insert(param.name);
+        std::vector<std::string> used;
+        for (auto &stmt : proc->body)
+        {
+            walkAST(stmt.get(), [&](ASTNode *n)
+                    {
+                        if (auto decl = dynamic_cast<VariableDeclarationNode *>(n))
+                            own.insert(decl->name);
+                        else if (auto decl = dynamic_cast<ConstantDeclarationNode *>(n))
+                            own.insert(decl->name);
+                        else if (auto var = dynamic_cast<VariableNode *>(n))
+                            used.push_back(baseName(var->name));
+                        else if (auto read = dynamic_cast<ReadNode *>(n))
+                            used.push_back(baseName(read->variableName));
+                        else if (auto loop = dynamic_cast<ForNode *>(n))
+                            used.push_back(loop->iteratorName); });
+        }
+        for (const auto &name : used)
+        {
+            if (!own.count(name))
+                sharedNames.insert(name);
+        }
+    }
+}
+
+StructuredCGenerator::Variable StructuredCGenerator::resolveType(TypeNode *type, const std::string &name)
+{
+    Variable var;
+    var.ctype = "int";
+    if (auto prim = dynamic_cast<PrimitiveTypeNode *>(type))
+    {
+        auto alias = typeNames.find(prim->name);
+        if (alias != typeNames.end() && alias->second != type)
+            return resolveType(alias->second, prim->name);
+        if (prim->name == "حقيقي")
+            var.ctype = "double";
+        else if (prim->name.rfind("خيط", 0) == 0)
+            var.ctype = "char*";
+    }
+    else if (auto arr = dynamic_cast<ArrayTypeNode *>(type))
+    {
+        var = resolveType(arr->elementType.get(), name);
+        var.length = arr->length;
+    }
+    else if (dynamic_cast<RecordTypeNode *>(type))
+    {
+        auto it = records.find(name);
+        if (it != records.end())
+        {
+            var.ctype = "struct " + it->second.tag;
+            var.record = name;
+        }
+    }
+    return var;
+}
+
+const StructuredCGenerator::Variable *StructuredCGenerator::lookup(const std::string &name) const
+{
+    std::string base = baseName(name);
+    for (auto scope = scopes.rbegin(); scope != scopes.rend(); ++scope)
+    {
+        auto it = scope->find(base);
+        if (it != scope->end())
+            return &it->second;
+    }
+    auto it = globals.find(base);
+    return it == globals.end() ? nullptr : &it->second;
+}
+
+std::string StructuredCGenerator::fieldType(const std::string &name) const
+{
+    const Variable *var = lookup(name);
+    if (!var || var->record.empty())
+        return "int";
+    std::string field = name.substr(name.find('.') + 1);
+    for (const auto &entry : records.at(var->record).fields)
+    {
+        if (entry.first == field)
+            return entry.second;
+    }
+    return "int";
+}
+
+std::string StructuredCGenerator::declaration(const std::string &name, const Variable &var,
+                                              const std::string &init) const
+{
+    if (var.length >= 0)
+        return var.ctype + " " + name + "[" + std::to_string(var.length) + "] = {0};";
+    if (!var.record.empty())
+        return var.ctype + " " + name + " = {0};";
+    if (!init.empty())
+        return var.ctype + " " + name + " = " + init + ";";
+    return var.ctype + " " + name + (var.ctype == "char*" ? " = \"\";" : " = 0;");
+}
+
+std::string StructuredCGenerator::reference(const std::string &name) const
+{
+    const Variable *var = lookup(name);
+    if (var && var->reference)
+        return "(*" + name + ")";
+    return name;
+}
+
+std::string StructuredCGenerator::typeOf(ASTNode *expr) const
+{
+    if (auto literal = dynamic_cast<LiteralNode *>(expr))
+    {
+        if (literal->literalType == TokenType::REAL_LITERAL)
+            return "double";
+        if (literal->literalType == TokenType::STRING_LITERAL)
+            return "char*";
+        return "int";
+    }
+    if (auto variable = dynamic_cast<VariableNode *>(expr))
+    {
+        if (variable->name.find('.') != std::string::npos)
+            return fieldType(variable->name);
+        const Variable *var = lookup(variable->name);
+        return var && var->length < 0 && var->record.empty() ? var->ctype : "int";
+    }
+    if (auto index = dynamic_cast<IndexAccessNode *>(expr))
+    {
+        auto array = dynamic_cast<VariableNode *>(index->variable.get());
+        const Variable *var = array ? lookup(array->name) : nullptr;
+        return var && var->record.empty() ? var->ctype : "int";
+    }
+    if (auto binary = dynamic_cast<BinaryOpNode *>(expr))
+    {
+        switch (binary->op)
+        {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::MULTIPLY:
+        case TokenType::DIVIDE:
+            return typeOf(binary->left.get()) == "double" || typeOf(binary->right.get()) == "double"
+                       ? "double"
+                       : "int";
+        default:
+            return "int";
+        }
+    }
+    if (auto unary = dynamic_cast<UnaryOpNode *>(expr))
+        return unary->op == TokenType::MINUS ? typeOf(unary->operand.get()) : "int";
+    return "int";
+}
+
+std::string StructuredCGenerator::expression(ASTNode *expr) const
+{
+    if (!expr)
+    {
+        throw std::runtime_error("تعبير فارغ في المولد المهيكل");
+    }
+
+    if (auto binary = dynamic_cast<BinaryOpNode *>(expr))
+    {
+        std::string op;
+        switch (binary->op)
+        {
+        case TokenType::PLUS:
+            op = "+";
+            break;
+        case TokenType::MINUS:
+            op = "-";
+            break;
+        case TokenType::MULTIPLY:
+            op = "*";
+            break;
+        case TokenType::DIVIDE:
+            op = "/";
+            break;
+        case TokenType::MOD:
+            op = "%";
+            break;
+        case TokenType::EQUALS:
+            op = "==";
+            break;
+        case TokenType::NOT_EQUALS:
+            op = "!=";
+            break;
+        case TokenType::LESS:
+            op = "<";
+            break;
+        case TokenType::GREATER:
+            op = ">";
+            break;
+        case TokenType::LESS_EQUAL:
+            op = "<=";
+            break;
+        case TokenType::GREATER_EQUAL:
+            op = ">=";
+            break;
+        case TokenType::AND:
+            op = "&&";
+            break;
+        case TokenType::OR:
+            op = "||";
+            break;
+        default:
+            throw std::runtime_error("معامل غير مدعوم في التعبير: " + std::to_string(static_cast<int>(binary->op)));
+        }
+        return operand(binary->left.get()) + " " + op + " " + operand(binary->right.get());
+    }
+    if (auto unary = dynamic_cast<UnaryOpNode *>(expr))
+    {
+        if (unary->op != TokenType::NOT && unary->op != TokenType::MINUS)
+        {
+            throw std::runtime_error("معامل أحادي غير مدعوم: " + std::to_string(static_cast<int>(unary->op)));
+        }
+        return (unary->op == TokenType::NOT ? "!" : "-") + operand(unary->operand.get());
+    }
+    if (auto literal = dynamic_cast<LiteralNode *>(expr))
+    {
+        if (literal->literalType == TokenType::STRING_LITERAL)
+            return quote(literal->value);
+        if (literal->literalType == TokenType::TRUE_VAL)
+            return "1";
+        if (literal->literalType == TokenType::FALSE_VAL)
+            return "0";
+        return literal->value;
+    }
+    if (auto variable = dynamic_cast<VariableNode *>(expr))
+        return reference(variable->name);
+    if (auto index = dynamic_cast<IndexAccessNode *>(expr))
+    {
+        auto array = dynamic_cast<VariableNode *>(index->variable.get());
+        if (!array)
+        {
+            throw std::runtime_error("الوصول للفهرس لا يدعم إلا المتغيرات المباشرة حاليًا");
+        }
+        std::string subscript = expression(index->index.get());
+        const Variable *var = lookup(array->name);
+        auto literal = dynamic_cast<LiteralNode *>(index->index.get());
+        bool inRange = literal && literal->literalType == TokenType::NUMBER && var &&
+                       std::stol(literal->value) < var->length;
+        // الفحوص داخل الحلقات يحذفها مترجم C نفسه حين يثبت مدى الفهرس
+        if (checkedArrays && var && var->length >= 0 && !inRange)
+            subscript = "checked_index(" + subscript + ", " + std::to_string(var->length) + ")";
+        return reference(array->name) + "[" + subscript + "]";
+    }
+    if (auto field = dynamic_cast<FieldAccessNode *>(expr))
+        return operand(field->record.get()) + "." + field->fieldName;
+
+    throw std::runtime_error("نوع تعبير غير مدعوم: " + std::string(expr->getTypeName()));
+}
+
+// معامل داخل تعبير أكبر: العمليات تُحاط بأقواس فلا تعتمد على أولويات C
+std::string StructuredCGenerator::operand(ASTNode *expr) const
+{
+    if (dynamic_cast<BinaryOpNode *>(expr) || dynamic_cast<UnaryOpNode *>(expr))
+        return "(" + expression(expr) + ")";
+    return expression(expr);
+}
+
+void StructuredCGenerator::block(std::ostream &out, const std::vector<std::unique_ptr<ASTNode>> &body, int depth)
+{
+    scopes.emplace_back();
+    for (auto &stmt : body)
+    {
+        if (stmt)
+            statement(out, stmt.get(), depth);
+    }
+    scopes.pop_back();
+}
+
+void StructuredCGenerator::variableDeclaration(std::ostream &out, VariableDeclarationNode *node, int depth)
+{
+    const std::string indent(depth * 4, ' ');
+    std::string init = node->initialValue ? expression(node->initialValue.get()) : "";
+
+    Variable var;
+    if (node->typeNode)
+        var = resolveType(static_cast<TypeNode *>(node->typeNode.get()), node->name);
+    else
+        var.ctype = node->initialValue ? typeOf(node->initialValue.get()) : "int";
+
+    // متغير مشترك مع الإجراءات: معرف في مستوى الملف، تبقى تهيئته هنا
+    if (!insideProcedure && scopes.size() == 1 && globals.count(node->name))
+    {
+        if (!init.empty())
+            out << indent << node->name << " = " << init << ";" << std::endl;
+        return;
+    }
+
+    out << indent << declaration(node->name, var, init) << std::endl;
+    scopes.back()[node->name] = var;
+}
+
+void StructuredCGenerator::statement(std::ostream &out, ASTNode *stmt, int depth)
+{
+    const std::string indent(depth * 4, ' ');
+
+    if (auto decl = dynamic_cast<VariableDeclarationNode *>(stmt))
+    {
+        variableDeclaration(out, decl, depth);
+    }
+    else if (auto decl = dynamic_cast<ConstantDeclarationNode *>(stmt))
+    {
+        std::string value = expression(decl->value.get());
+        if (!insideProcedure && scopes.size() == 1 && globals.count(decl->name))
+        {
+            out << indent << decl->name << " = " << value << ";" << std::endl;
+            return;
+        }
+        Variable var;
+        var.ctype = typeOf(decl->value.get());
+        out << indent << "const " << declaration(decl->name, var, value) << std::endl;
+        scopes.back()[decl->name] = var;
+    }
+    else if (auto assignment = dynamic_cast<AssignmentNode *>(stmt))
+    {
+        out << indent << expression(assignment->left.get()) << " = "
+            << expression(assignment->value.get()) << ";" << std::endl;
+    }
+    else if (auto print = dynamic_cast<PrintNode *>(stmt))
+    {
+        std::string type = typeOf(print->expression.get());
+        std::string format = type == "char*" ? "%s" : type == "double" ? "%g"
+                                                                       : "%d";
+        out << indent << "printf(\"" << format << "\\n\", " << expression(print->expression.get())
+            << ");" << std::endl;
+    }
+    else if (auto read = dynamic_cast<ReadNode *>(stmt))
+    {
+        VariableNode target(read->variableName);
+        std::string type = typeOf(&target);
+        std::string name = reference(read->variableName);
+        if (type == "char*")
+        {
+            out << indent << name << " = malloc(256);" << std::endl;
+            out << indent << "scanf(\"%255s\", " << name << ");" << std::endl;
+        }
+        else
+        {
+            out << indent << "scanf(\"" << (type == "double" ? "%lf" : "%d") << "\", &" << name
+                << ");" << std::endl;
+        }
+    }
+    else if (auto ifStmt = dynamic_cast<IfNode *>(stmt))
+    {
+        out << indent << "if (" << expression(ifStmt->condition.get()) << ")" << std::endl;
+        out << indent << "{" << std::endl;
+        block(out, ifStmt->thenBranch, depth + 1);
+        out << indent << "}" << std::endl;
+        if (!ifStmt->elseBranch.empty())
+        {
+            out << indent << "else" << std::endl;
+            out << indent << "{" << std::endl;
+            block(out, ifStmt->elseBranch, depth + 1);
+            out << indent << "}" << std::endl;
+        }
+    }
+    else if (auto loop = dynamic_cast<WhileNode *>(stmt))
+    {
+        out << indent << "while (" << expression(loop->condition.get()) << ")" << std::endl;
+        out << indent << "{" << std::endl;
+        block(out, loop->body, depth + 1);
+        out << indent << "}" << std::endl;
+    }
+    else if (auto loop = dynamic_cast<RepeatNode *>(stmt))
+    {
+        // كرر-حتى: يُعاد الجسم ما دام الشرط خاطئاً
+        out << indent << "do" << std::endl;
+        out << indent << "{" << std::endl;
+        block(out, loop->body, depth + 1);
+        out << indent << "} while (!" << operand(loop->condition.get()) << ");" << std::endl;
+    }
+    else if (auto loop = dynamic_cast<ForNode *>(stmt))
+    {
+        // العداد غير المعرف يصبح متغيراً خاصاً بالحلقة كما في C99
+        std::string init = reference(loop->iteratorName);
+        scopes.emplace_back();
+        if (!lookup(loop->iteratorName))
+        {
+            init = "int " + loop->iteratorName;
+            scopes.back()[loop->iteratorName].ctype = "int";
+        }
+        std::string iterator = reference(loop->iteratorName);
+        std::string step = iterator + "++";
+        auto literal = dynamic_cast<LiteralNode *>(loop->stepValue.get());
+        if (loop->stepValue && !(literal && literal->value == "1"))
+            step = iterator + " += " + operand(loop->stepValue.get());
+
+        out << indent << "for (" << init << " = " << expression(loop->startValue.get()) << "; "
+            << iterator << " <= " << operand(loop->endValue.get()) << "; " << step << ")" << std::endl;
+        out << indent << "{" << std::endl;
+        block(out, loop->body, depth + 1);
+        out << indent << "}" << std::endl;
+        scopes.pop_back();
+    }
+    else if (dynamic_cast<ProcedureDeclarationNode *>(stmt))
+    {
+        // الإجراءات تُكتب دوال مستقلة قبل main
+    }
+    else if (auto call = dynamic_cast<ProcedureCallNode *>(stmt))
+    {
+        ProcedureDeclarationNode *proc = nullptr;
+        for (auto *candidate : procedures)
+        {
+            if (candidate->name == call->name)
+                proc = candidate;
+        }
+        if (!proc)
+        {
+            out << indent << "// استدعاء إجراء غير معرف: " << call->name << std::endl;
+            return;
+        }
+        if (proc->parameters.size() != call->arguments.size())
+        {
+            throw std::runtime_error("عدد المعاملات لا يطابق تعريف الإجراء: " + call->name);
+        }
+
+        out << indent << "proc_" << call->name << "(";
+        for (size_t i = 0; i < call->arguments.size(); ++i)
+        {
+            out << (i == 0 ? "" : ", ");
+            if (!proc->parameters[i].isByReference)
+            {
+                out << expression(call->arguments[i].get());
+                continue;
+            }
+            // بالمرجع: يُمرر عنوان متغير المستدعي أو عنصر القائمة، أو المؤشر نفسه إن كان معاملاً بالمرجع
+            if (auto access = dynamic_cast<IndexAccessNode *>(call->arguments[i].get()))
+            {
+                out << "&" << expression(access);
+                continue;
+            }
+            auto var = dynamic_cast<VariableNode *>(call->arguments[i].get());
+            if (!var)
+            {
+                throw std::runtime_error("المعامل بالمرجع يجب أن يكون متغيراً في استدعاء: " + call->name);
+            }
+            const Variable *info = lookup(var->name);
+            if (info && info->reference && var->name.find('.') == std::string::npos)
+                out << var->name;
+            else
+                out << "&" << var->name;
+        }
+        out << ");" << std::endl;
+    }
+    else if (auto ret = dynamic_cast<ReturnNode *>(stmt))
+    {
+        out << indent << "return " << (ret->value ? expression(ret->value.get()) : "0") << ";" << std::endl;
+    }
+    else if (auto var = dynamic_cast<VariableNode *>(stmt))
+    {
+        if (var->name != "__empty__")
+            consoleErrors() << "⚠️  جملة غير معروفة في المولد المهيكل: " << var->name << std::endl;
+    }
+    else
+    {
+        consoleErrors() << "⚠️  نوع جملة غير معروف في المولد المهيكل: " << stmt->getTypeName() << std::endl;
+    }
+}
+
+std::string StructuredCGenerator::signature(ProcedureDeclarationNode *node) const
+{
+    std::string text = "int proc_" + node->name + "(";
+    for (size_t i = 0; i < node->parameters.size(); ++i)
+    {
+        const auto &param = node->parameters[i];
+        auto prim = dynamic_cast<PrimitiveTypeNode *>(param.type.get());
+        if (!prim || typeNames.count(prim->name))
+        {
+            throw std::runtime_error("معاملات المصفوفات والسجلات غير مدعومة في الإجراء: " + node->name);
+        }
+        std::string ctype = prim->name == "حقيقي" ? "double" : prim->name.rfind("خيط", 0) == 0 ? "char*"
+                                                                                                   : "int";
+        text += (i == 0 ? "" : ", ") + ctype + (param.isByReference ? " *" : " ") + param.name;
+    }
+    return text + ")";
+}
+
+void StructuredCGenerator::procedure(std::ostream &out, ProcedureDeclarationNode *node)
+{
+    insideProcedure = true;
+    scopes.assign(1, {});
+    for (const auto &param : node->parameters)
+    {
+        Variable var = resolveType(param.type.get(), param.name);
+        var.reference = param.isByReference;
+        scopes.back()[param.name] = var;
+    }
+
+    out << std::endl
+        << signature(node) << std::endl;
+    out << "{" << std::endl;
+    for (auto &stmt : node->body)
+    {
+        if (stmt)
+            statement(out, stmt.get(), 1);
+    }
+    if (node->body.empty() || !dynamic_cast<ReturnNode *>(node->body.back().get()))
+        out << "    return 0;" << std::endl;
+    out << "}" << std::endl;
+
+    scopes.clear();
+    insideProcedure = false;
+}
+
+void StructuredCGenerator::generate(std::ostream &out)
+{
+    if (!program)
+    {
+        throw std::runtime_error("لا توجد شجرة اشتقاق لتوليد كود C المهيكل");
+    }
+    collect();
+
+    out << "// كود C مهيكل مولد للغة العربية" << std::endl;
+    out << "// =============================" << std::endl
+        << std::endl;
+    out << "#include <stdio.h>" << std::endl;
+    out << "#include <stdlib.h>" << std::endl;
+
+    if (checkedArrays)
+    {
+        out << std::endl
+            << "static inline int checked_index(int index, int length)" << std::endl
+            << "{" << std::endl
+            << "    if (index < 0 || index >= length)" << std::endl
+            << "    {" << std::endl
+            << "        fprintf(stderr, \"خطأ وقت التنفيذ: فهرس خارج حدود القائمة\\n\");" << std::endl
+            << "        exit(1);" << std::endl
+            << "    }" << std::endl
+            << "    return index;" << std::endl
+            << "}" << std::endl;
+    }
+
+    for (const auto &name : recordOrder)
+    {
+        const Record &record = records.at(name);
+        out << std::endl
+            << "struct " << record.tag << std::endl
+            << "{" << std::endl;
+        for (const auto &field : record.fields)
+            out << "    " << field.second << " " << field.first << ";" << std::endl;
+        out << "};" << std::endl;
+    }
+
+    // المتغيرات المشتركة مع الإجراءات في مستوى الملف
+    bool first = true;
+    auto share = [&](const std::string &name, const Variable &var)
+    {
+        if (!sharedNames.count(name) || globals.count(name))
+            return;
+        out << (first ? "\n" : "") << declaration(name, var, "") << std::endl;
+        first = false;
+        globals[name] = var;
+    };
+    for (auto *list : {&program->declarations, &program->statements})
+    {
+        for (auto &node : *list)
+        {
+            if (auto decl = dynamic_cast<VariableDeclarationNode *>(node.get()))
+            {
+                Variable var;
+                if (decl->typeNode)
+                    var = resolveType(static_cast<TypeNode *>(decl->typeNode.get()), decl->name);
+                else
+                    var.ctype = decl->initialValue ? typeOf(decl->initialValue.get()) : "int";
+                share(decl->name, var);
+            }
+            else if (auto decl = dynamic_cast<ConstantDeclarationNode *>(node.get()))
+            {
+                Variable var;
+                var.ctype = typeOf(decl->value.get());
+                share(decl->name, var);
+            }
+        }
+    }
+
+    if (!procedures.empty())
+    {
+        out << std::endl;
+        for (auto *proc : procedures)
+            out << signature(proc) << ";" << std::endl;
+        for (auto *proc : procedures)
+            procedure(out, proc);
+    }
+
+    out << std::endl
+        << "int main()" << std::endl;
+    out << "{" << std::endl;
+    scopes.assign(1, {});
+    for (auto *list : {&program->declarations, &program->statements})
+    {
+        for (auto &node : *list)
+        {
+            if (node)
+                statement(out, node.get(), 1);
+        }
+    }
+    out << "    return 0;" << std::endl;
+    out << "}" << std::endl;
+    scopes.clear();
+}
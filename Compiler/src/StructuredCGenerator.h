@@ -0,0 +1,65 @@
+#ifndef STRUCTURED_C_GENERATOR_H
+#define STRUCTURED_C_GENERATOR_H
+
+#include "AST.h"
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// مولد C مهيكل: يكتب for/while/do/if مباشرة من شجرة الاشتقاق بدل علامات
+// goto التي ينتجها الكود الوسيط، ويعرّف كل متغير بنوعه في الكتلة التي
+// تحتويه. هكذا يرى مترجم C حلقات حقيقية يستطيع توجيهها (vectorize) وفكها
+class StructuredCGenerator
+{
+private:
+    struct Variable
+    {
+        std::string ctype;      // int أو double أو char* أو struct struct_<نوع>
+        int length = -1;        // طول المصفوفة، -1 للمتغير المفرد
+        bool reference = false; // معامل بالمرجع: يُقرأ ويُكتب عبر (*اسم)
+        std::string record;     // نوع السجل لمعرفة أنواع حقوله
+    };
+
+    struct Record
+    {
+        std::string tag; // struct_<نوع>
+        std::vector<std::pair<std::string, std::string>> fields; // الحقل -> نوع C
+    };
+
+    ProgramNode *program;
+    std::vector<ProcedureDeclarationNode *> procedures;
+    std::unordered_map<std::string, TypeNode *> typeNames; // أسماء الأنواع المعرفة بـ نوع
+    std::unordered_map<std::string, Record> records;
+    std::vector<std::string> recordOrder;
+    std::unordered_set<std::string> sharedNames; // متغيرات البرنامج التي تلمسها الإجراءات
+    std::unordered_map<std::string, Variable> globals;
+    std::vector<std::unordered_map<std::string, Variable>> scopes;
+    bool insideProcedure;
+    bool checkedArrays; // فهارس القوائم تمر عبر checked_index
+
+    void collect();
+    Variable resolveType(TypeNode *type, const std::string &name);
+    const Variable *lookup(const std::string &name) const;
+    std::string fieldType(const std::string &name) const;
+
+    std::string declaration(const std::string &name, const Variable &var, const std::string &init) const;
+    std::string reference(const std::string &name) const;
+    std::string typeOf(ASTNode *expr) const;
+    std::string expression(ASTNode *expr) const;
+    std::string operand(ASTNode *expr) const;
+
+    void block(std::ostream &out, const std::vector<std::unique_ptr<ASTNode>> &body, int depth);
+    void statement(std::ostream &out, ASTNode *stmt, int depth);
+    void variableDeclaration(std::ostream &out, VariableDeclarationNode *node, int depth);
+    void procedure(std::ostream &out, ProcedureDeclarationNode *node);
+    std::string signature(ProcedureDeclarationNode *node) const;
+
+public:
+    explicit StructuredCGenerator(ProgramNode *program, bool checkedArrays = false);
+
+    void generate(std::ostream &out);
+};
+
+#endif
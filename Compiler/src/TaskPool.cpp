@@ -0,0 +1,97 @@
+#include "TaskPool.h"
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    struct Queue
+    {
+        std::mutex lock;
+        std::deque<size_t> indices;
+    };
+}
+
+TaskPool::TaskPool(unsigned workers) : workers(workers)
+{
+    if (this->workers == 0)
+        this->workers = std::max(1u, std::thread::hardware_concurrency());
+}
+
+void TaskPool::add(std::function<void()> task)
+{
+    tasks.push_back(std::move(task));
+}
+
+void TaskPool::run()
+{
+    // توزيع دائري: المهمة i في طابور i mod الخيوط، فيتقدم الجميع بترتيب
+    // الإضافة تقريباً وتنتهي المهام الأولى أولاً
+    size_t count = std::max<size_t>(1, std::min<size_t>(workers, tasks.size()));
+    std::vector<Queue> queues(count);
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        queues[i % count].indices.push_back(i);
+    }
+
+    // لا تُضاف مهام أثناء التشغيل، فإذا فرغت كل الطوابير انتهى العمل
+    auto take = [&queues, count](size_t self, size_t &index)
+    {
+        for (size_t k = 0; k < count; ++k)
+        {
+            Queue &queue = queues[(self + k) % count];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (queue.indices.empty())
+                continue;
+            if (k == 0)
+            {
+                index = queue.indices.front();
+                queue.indices.pop_front();
+            }
+            else
+            {
+                index = queue.indices.back();
+                queue.indices.pop_back();
+            }
+            return true;
+        }
+        return false;
+    };
+
+    std::vector<std::exception_ptr> errors(tasks.size());
+    auto work = [&](size_t self)
+    {
+        size_t index;
+        while (take(self, index))
+        {
+            try
+            {
+                tasks[index]();
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < count; ++i)
+    {
+        threads.emplace_back(work, i);
+    }
+    work(0);
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    tasks.clear();
+
+    for (const auto &error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <functional>
+#include <vector>
+
+// تشغيل مهام مستقلة على عدد صغير من الخيوط بسرقة العمل (work stealing):
+// لكل خيط طابور يأخذ من أوله، ومن فرغ طابوره يسرق من آخر طابور غيره.
+// الخيط المستدعي يعمل معها، وrun() لا تعود إلا بعد انتهاء الجميع. إن رمت
+// مهام استثناء يُعاد رمي استثناء أسبقها في ترتيب الإضافة، فيبقى الخطأ
+// المبلَّغ نفسه في كل تشغيل
+class TaskPool
+{
+private:
+    std::vector<std::function<void()>> tasks;
+    unsigned workers;
+
+public:
+    // workers = 0: عدد أنوية المعالج
+    explicit TaskPool(unsigned workers = 0);
+
+    void add(std::function<void()> task);
+    void run();
+};
+
+#endif
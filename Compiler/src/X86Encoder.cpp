@@ -0,0 +1,498 @@
+#include "X86Encoder.h"
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const std::unordered_map<std::string, std::pair<int, int>> registers = {
+        {"%rax", {0, 8}}, {"%rcx", {1, 8}}, {"%rdx", {2, 8}}, {"%rbx", {3, 8}},
+        {"%rsp", {4, 8}}, {"%rbp", {5, 8}}, {"%rsi", {6, 8}}, {"%rdi", {7, 8}},
+        {"%r8", {8, 8}}, {"%r9", {9, 8}}, {"%r10", {10, 8}}, {"%r11", {11, 8}},
+        {"%r12", {12, 8}}, {"%r13", {13, 8}}, {"%r14", {14, 8}}, {"%r15", {15, 8}},
+        {"%eax", {0, 4}}, {"%ecx", {1, 4}}, {"%edx", {2, 4}}, {"%ebx", {3, 4}},
+        {"%esp", {4, 4}}, {"%ebp", {5, 4}}, {"%esi", {6, 4}}, {"%edi", {7, 4}},
+        {"%r8d", {8, 4}}, {"%r9d", {9, 4}}, {"%r10d", {10, 4}}, {"%r11d", {11, 4}},
+        {"%r12d", {12, 4}}, {"%r13d", {13, 4}}, {"%r14d", {14, 4}}, {"%r15d", {15, 4}}};
+
+    // رقم الحقل reg لمجموعة العمليات الحسابية (81 /digit) ومجموعة الإزاحة (C1 /digit)
+    const std::unordered_map<std::string, int> arithmetic = {
+        {"add", 0}, {"or", 1}, {"and", 4}, {"sub", 5}, {"xor", 6}, {"cmp", 7}};
+    const std::unordered_map<std::string, int> shifts = {{"shl", 4}, {"shr", 5}, {"sar", 7}};
+    const std::unordered_map<std::string, uint8_t> conditions = {
+        {"je", 0x84}, {"jne", 0x85}, {"jl", 0x8C}, {"jge", 0x8D}, {"jle", 0x8E}, {"jg", 0x8F},
+        {"jb", 0x82}, {"jae", 0x83}};
+
+    std::string trim(const std::string &text)
+    {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+            return "";
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    bool isNumber(const std::string &text)
+    {
+        size_t i = (!text.empty() && (text[0] == '-' || text[0] == '+')) ? 1 : 0;
+        if (i >= text.size())
+            return false;
+        for (; i < text.size(); ++i)
+        {
+            if (!std::isdigit(static_cast<unsigned char>(text[i])))
+                return false;
+        }
+        return true;
+    }
+
+    bool fitsInt8(int64_t value)
+    {
+        return value >= -128 && value <= 127;
+    }
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    // تقسيم المعاملات على الفواصل خارج الأقواس
+    std::vector<std::string> splitOperands(const std::string &text)
+    {
+        std::vector<std::string> parts;
+        std::string current;
+        int depth = 0;
+        for (char ch : text)
+        {
+            if (ch == '(')
+                depth++;
+            else if (ch == ')')
+                depth--;
+            if (ch == ',' && depth == 0)
+            {
+                parts.push_back(trim(current));
+                current.clear();
+            }
+            else
+                current += ch;
+        }
+        if (!trim(current).empty())
+            parts.push_back(trim(current));
+        return parts;
+    }
+
+    // محتوى سلسلة بين علامتي تنصيص بعد فك الهروب
+    std::string unquote(const std::string &text)
+    {
+        size_t open = text.find('"');
+        size_t close = text.rfind('"');
+        if (open == std::string::npos || close == open)
+            throw std::runtime_error("سلسلة غير صالحة في التجميع: " + text);
+        std::string result;
+        for (size_t i = open + 1; i < close; ++i)
+        {
+            if (text[i] != '\\' || i + 1 >= close)
+            {
+                result += text[i];
+                continue;
+            }
+            char next = text[++i];
+            result += next == 'n' ? '\n' : next == 't' ? '\t' : next;
+        }
+        return result;
+    }
+}
+
+X86Encoder::Operand X86Encoder::parseOperand(const std::string &text) const
+{
+    Operand operand;
+    auto reg = registers.find(text);
+    if (reg != registers.end())
+    {
+        operand.kind = Operand::Kind::Register;
+        operand.reg = reg->second.first;
+        operand.size = reg->second.second;
+        return operand;
+    }
+    if (!text.empty() && text[0] == '$')
+    {
+        operand.kind = Operand::Kind::Immediate;
+        std::string value = text.substr(1);
+        if (isNumber(value))
+            operand.value = std::stoll(value);
+        else
+            operand.symbol = value;
+        return operand;
+    }
+    size_t open = text.find('(');
+    if (open != std::string::npos)
+    {
+        // disp(base, index, scale) أو symbol(%rip)
+        operand.kind = Operand::Kind::Memory;
+        std::string displacement = text.substr(0, open);
+        std::vector<std::string> parts = splitOperands(text.substr(open + 1, text.find(')') - open - 1));
+        if (!parts.empty() && parts[0] == "%rip")
+        {
+            operand.rip = true;
+            operand.symbol = displacement;
+            return operand;
+        }
+        if (!displacement.empty())
+        {
+            if (!isNumber(displacement))
+                throw std::runtime_error("إزاحة غير مدعومة في التجميع: " + text);
+            operand.value = std::stoll(displacement);
+        }
+        if (parts.empty() || !registers.count(parts[0]))
+            throw std::runtime_error("عنوان ذاكرة غير مدعوم في التجميع: " + text);
+        operand.base = registers.at(parts[0]).first;
+        if (parts.size() > 1)
+            operand.index = registers.at(parts[1]).first;
+        if (parts.size() > 2)
+            operand.scale = std::stoi(parts[2]);
+        return operand;
+    }
+    // هدف قفزة أو استدعاء؛ @PLT لا معنى له بلا رابط
+    operand.symbol = text.substr(0, text.find('@'));
+    return operand;
+}
+
+void X86Encoder::emitRex(bool wide, int reg, const Operand &rm)
+{
+    uint8_t rex = 0x40 | (wide ? 0x08 : 0) | (reg >= 8 ? 0x04 : 0);
+    if (rm.kind == Operand::Kind::Register)
+        rex |= rm.reg >= 8 ? 0x01 : 0;
+    else if (!rm.rip)
+        rex |= (rm.index >= 8 ? 0x02 : 0) | (rm.base >= 8 ? 0x01 : 0);
+    if (rex != 0x40)
+        text.push_back(rex);
+}
+
+void X86Encoder::emitModRM(int reg, const Operand &rm, size_t trailing)
+{
+    uint8_t field = static_cast<uint8_t>((reg & 7) << 3);
+    if (rm.kind == Operand::Kind::Register)
+    {
+        text.push_back(0xC0 | field | (rm.reg & 7));
+        return;
+    }
+    if (rm.kind != Operand::Kind::Memory)
+        throw std::runtime_error("معامل غير صالح للتعليمة في التجميع");
+    if (rm.rip)
+    {
+        // العنوان نسبي لنهاية التعليمة، بعد أي ثابت يليه
+        text.push_back(0x05 | field);
+        fixups.push_back({Fixup::Kind::Relative, text.size(), text.size() + 4 + trailing, rm.symbol});
+        text.insert(text.end(), 4, 0);
+        return;
+    }
+
+    // %rsp و%r12 أساساً يحتاجان بايت SIB، و%rbp و%r13 بلا إزاحة يحتاجان disp8 صفراً
+    bool sib = rm.index >= 0 || (rm.base & 7) == 4;
+    int mod = rm.value == 0 && (rm.base & 7) != 5 ? 0 : fitsInt8(rm.value) ? 1 : 2;
+    text.push_back(static_cast<uint8_t>(mod << 6) | field | (sib ? 4 : (rm.base & 7)));
+    if (sib)
+    {
+        int scale = rm.scale == 8 ? 3 : rm.scale == 4 ? 2 : rm.scale == 2 ? 1 : 0;
+        int index = rm.index >= 0 ? (rm.index & 7) : 4;
+        text.push_back(static_cast<uint8_t>(scale << 6 | index << 3 | (rm.base & 7)));
+    }
+    for (int i = 0; i < (mod == 1 ? 1 : mod == 2 ? 4 : 0); ++i)
+    {
+        text.push_back(static_cast<uint8_t>(rm.value >> (8 * i)));
+    }
+}
+
+void X86Encoder::encode(std::initializer_list<uint8_t> opcode, bool wide, int reg, const Operand &rm,
+                        int immediateBytes, int64_t immediate, const std::string &immediateSymbol)
+{
+    emitRex(wide, reg, rm);
+    text.insert(text.end(), opcode.begin(), opcode.end());
+    emitModRM(reg, rm, immediateBytes);
+    if (!immediateSymbol.empty())
+    {
+        fixups.push_back({Fixup::Kind::Constant, text.size(), text.size() + 4, immediateSymbol});
+        text.insert(text.end(), 4, 0);
+        return;
+    }
+    for (int i = 0; i < immediateBytes; ++i)
+    {
+        text.push_back(static_cast<uint8_t>(immediate >> (8 * i)));
+    }
+}
+
+void X86Encoder::branch(std::initializer_list<uint8_t> opcode, const Operand &target)
+{
+    // كل القفزات rel32: الحجم معروف في مرور واحد وتُحل الأهداف في النهاية
+    text.insert(text.end(), opcode.begin(), opcode.end());
+    fixups.push_back({Fixup::Kind::Relative, text.size(), text.size() + 4, target.symbol});
+    text.insert(text.end(), 4, 0);
+}
+
+void X86Encoder::instruction(const std::string &mnemonic, const std::vector<Operand> &operands)
+{
+    auto operand = [&](size_t k) -> const Operand &
+    {
+        if (k >= operands.size())
+            throw std::runtime_error("معاملات ناقصة للتعليمة: " + mnemonic);
+        return operands[k];
+    };
+    std::string stem = mnemonic.substr(0, mnemonic.size() - 1);
+    bool wide = mnemonic.back() == 'q';
+
+    if (mnemonic == "movq" || mnemonic == "movl")
+    {
+        const Operand &source = operand(0);
+        const Operand &dest = operand(1);
+        if (source.kind == Operand::Kind::Immediate)
+            encode({0xC7}, wide, 0, dest, 4, source.value, source.symbol);
+        else if (source.kind == Operand::Kind::Register)
+            encode({0x89}, wide, source.reg, dest);
+        else
+            encode({0x8B}, wide, dest.reg, source);
+    }
+    else if (mnemonic == "movabsq")
+    {
+        const Operand &dest = operand(1);
+        text.push_back(0x48 | (dest.reg >= 8 ? 0x01 : 0));
+        text.push_back(static_cast<uint8_t>(0xB8 + (dest.reg & 7)));
+        for (int i = 0; i < 8; ++i)
+        {
+            text.push_back(static_cast<uint8_t>(operand(0).value >> (8 * i)));
+        }
+    }
+    else if (mnemonic == "leaq")
+        encode({0x8D}, true, operand(1).reg, operand(0));
+    else if (mnemonic == "movslq")
+        encode({0x63}, true, operand(1).reg, operand(0));
+    else if ((mnemonic.back() == 'l' || wide) && arithmetic.count(stem))
+    {
+        int digit = arithmetic.at(stem);
+        const Operand &source = operand(0);
+        const Operand &dest = operand(1);
+        if (source.kind == Operand::Kind::Immediate && source.symbol.empty() && fitsInt8(source.value))
+            encode({0x83}, wide, digit, dest, 1, source.value);
+        else if (source.kind == Operand::Kind::Immediate)
+            encode({0x81}, wide, digit, dest, 4, source.value, source.symbol);
+        else if (source.kind == Operand::Kind::Register)
+            encode({static_cast<uint8_t>(digit * 8 + 1)}, wide, source.reg, dest);
+        else
+            encode({static_cast<uint8_t>(digit * 8 + 3)}, wide, dest.reg, source);
+    }
+    else if (mnemonic == "imull" || mnemonic == "imulq")
+    {
+        const Operand &source = operand(0);
+        const Operand &dest = operand(1);
+        if (source.kind == Operand::Kind::Immediate && fitsInt8(source.value))
+            encode({0x6B}, wide, dest.reg, dest, 1, source.value);
+        else if (source.kind == Operand::Kind::Immediate)
+            encode({0x69}, wide, dest.reg, dest, 4, source.value);
+        else
+            encode({0x0F, 0xAF}, wide, dest.reg, source);
+    }
+    else if ((mnemonic.back() == 'l' || wide) && shifts.count(stem))
+        encode({0xC1}, wide, shifts.at(stem), operand(1), 1, operand(0).value);
+    else if (mnemonic == "idivl")
+        encode({0xF7}, false, 7, operand(0));
+    else if (mnemonic == "cltd")
+        text.push_back(0x99);
+    else if (mnemonic == "pushq")
+    {
+        if (operand(0).reg >= 8)
+            text.push_back(0x41);
+        text.push_back(static_cast<uint8_t>(0x50 + (operand(0).reg & 7)));
+    }
+    else if (mnemonic == "leave")
+        text.push_back(0xC9);
+    else if (mnemonic == "ret")
+        text.push_back(0xC3);
+    else if (mnemonic == "rep" && operand(0).symbol == "stosq")
+        text.insert(text.end(), {0xF3, 0x48, 0xAB});
+    else if (mnemonic == "jmp")
+        branch({0xE9}, operand(0));
+    else if (mnemonic == "call")
+        branch({0xE8}, operand(0));
+    else if (conditions.count(mnemonic))
+        branch({0x0F, conditions.at(mnemonic)}, operand(0));
+    else
+        throw std::runtime_error("تعليمة x86-64 غير مدعومة في الترميز الداخلي: " + mnemonic);
+}
+
+void X86Encoder::directive(const std::string &name, const std::string &args)
+{
+    if (name == ".text")
+        section = Section::Text;
+    else if (name == ".bss")
+        section = Section::Bss;
+    else if (name == ".section")
+        section = trim(args).rfind(".rodata", 0) == 0 ? Section::Data : section;
+    else if (name == ".string" || name == ".ascii")
+    {
+        std::string bytes = unquote(args);
+        data.insert(data.end(), bytes.begin(), bytes.end());
+        if (name == ".string")
+            data.push_back(0);
+    }
+    else if (name == ".zero")
+    {
+        size_t count = std::stoul(trim(args));
+        if (section == Section::Bss)
+            bssSize += count;
+        else
+            data.insert(data.end(), count, 0);
+    }
+    else if (name == ".align")
+    {
+        size_t alignment = std::stoul(trim(args));
+        if (section == Section::Bss)
+            bssSize = alignUp(bssSize, alignment);
+        else if (section == Section::Data)
+            data.resize(alignUp(data.size(), alignment), 0);
+    }
+    else if (name == ".set")
+    {
+        // .set اسم, . - تسمية: طول ما كُتب منذ التسمية في القسم نفسه
+        std::vector<std::string> parts = splitOperands(args);
+        std::string expression = parts.size() > 1 ? parts[1] : "";
+        if (isNumber(expression))
+            constants[parts[0]] = std::stoll(expression);
+        else if (expression.rfind(". - ", 0) == 0 && labels.count(trim(expression.substr(4))))
+        {
+            const Label &start = labels.at(trim(expression.substr(4)));
+            size_t here = section == Section::Data ? data.size() : section == Section::Bss ? bssSize : text.size();
+            constants[parts[0]] = static_cast<int64_t>(here - start.offset);
+        }
+        else
+            throw std::runtime_error("تعبير .set غير مدعوم: " + args);
+    }
+    else if (name == ".globl")
+        globalSymbols.push_back(trim(args));
+    // .type و.section .note لا تغير الصورة
+}
+
+void X86Encoder::line(const std::string &source)
+{
+    // إزالة التعليق خارج السلاسل
+    std::string current;
+    bool quoted = false;
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        char ch = source[i];
+        if (ch == '"' && (i == 0 || source[i - 1] != '\\'))
+            quoted = !quoted;
+        if (ch == '#' && !quoted)
+            break;
+        current += ch;
+    }
+    current = trim(current);
+
+    // التسميات في أول السطر، وقد يليها توجيه على السطر نفسه
+    while (!current.empty())
+    {
+        size_t end = 0;
+        while (end < current.size() &&
+               (std::isalnum(static_cast<unsigned char>(current[end])) || current[end] == '_' || current[end] == '.'))
+        {
+            end++;
+        }
+        if (end == 0 || end >= current.size() || current[end] != ':')
+            break;
+        std::string name = current.substr(0, end);
+        size_t offset = section == Section::Data ? data.size() : section == Section::Bss ? bssSize : text.size();
+        if (!labels.emplace(name, Label{section, offset}).second)
+            throw std::runtime_error("تسمية معرفة مرتين في التجميع: " + name);
+        current = trim(current.substr(end + 1));
+    }
+    if (current.empty())
+        return;
+
+    size_t space = current.find_first_of(" \t");
+    std::string head = current.substr(0, space);
+    std::string rest = space == std::string::npos ? "" : trim(current.substr(space));
+    if (head[0] == '.')
+    {
+        directive(head, rest);
+        return;
+    }
+    if (section != Section::Text)
+        throw std::runtime_error("تعليمة خارج قسم الكود: " + current);
+
+    std::vector<Operand> operands;
+    for (const auto &part : splitOperands(rest))
+    {
+        operands.push_back(parseOperand(part));
+    }
+    instruction(head, operands);
+}
+
+void X86Encoder::finish()
+{
+    // كل دالة خارجية تحصل على جسر: jmp *(%rip) يليه عنوانها المطلق وقت الربط
+    for (const auto &fixup : fixups)
+    {
+        if (relocatable || fixup.kind != Fixup::Kind::Relative || labels.count(fixup.symbol))
+            continue;
+        labels[fixup.symbol] = Label{Section::Text, text.size()};
+        text.insert(text.end(), {0xFF, 0x25, 0, 0, 0, 0});
+        trampolines.push_back({fixup.symbol, text.size()});
+        text.insert(text.end(), 8, 0);
+    }
+    dataOffset = alignUp(text.size(), 4096);
+    bssOffset = alignUp(dataOffset + data.size(), 16);
+}
+
+void X86Encoder::assemble(const std::string &source, bool relocatable)
+{
+    this->relocatable = relocatable;
+    size_t start = 0;
+    while (start <= source.size())
+    {
+        size_t end = source.find('\n', start);
+        if (end == std::string::npos)
+            end = source.size();
+        line(source.substr(start, end - start));
+        start = end + 1;
+    }
+    finish();
+}
+
+size_t X86Encoder::addressOf(const std::string &symbol) const
+{
+    auto it = labels.find(symbol);
+    if (it == labels.end())
+        throw std::runtime_error("رمز غير معرف في التجميع: " + symbol);
+    const Label &label = it->second;
+    size_t base = label.section == Section::Text ? 0 : label.section == Section::Data ? dataOffset : bssOffset;
+    return base + label.offset;
+}
+
+void X86Encoder::link(uint8_t *base, const std::unordered_map<std::string, void *> &externals) const
+{
+    std::memcpy(base, text.data(), text.size());
+    std::memcpy(base + dataOffset, data.data(), data.size());
+    std::memset(base + bssOffset, 0, bssSize);
+
+    auto write32 = [&](size_t position, int64_t value)
+    {
+        int32_t field = static_cast<int32_t>(value);
+        std::memcpy(base + position, &field, 4);
+    };
+    for (const auto &fixup : fixups)
+    {
+        if (fixup.kind == Fixup::Kind::Constant)
+        {
+            auto it = constants.find(fixup.symbol);
+            if (it == constants.end())
+                throw std::runtime_error("ثابت غير معرف في التجميع: " + fixup.symbol);
+            write32(fixup.position, it->second);
+        }
+        else
+            write32(fixup.position, static_cast<int64_t>(addressOf(fixup.symbol)) - static_cast<int64_t>(fixup.end));
+    }
+    for (const auto &trampoline : trampolines)
+    {
+        auto it = externals.find(trampoline.first);
+        if (it == externals.end())
+            throw std::runtime_error("دالة خارجية غير معروفة في التشغيل المباشر: " + trampoline.first);
+        std::memcpy(base + trampoline.second, &it->second, 8);
+    }
+}
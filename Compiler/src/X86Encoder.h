@@ -0,0 +1,102 @@
+#ifndef X86_ENCODER_H
+#define X86_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ترميز داخلي لتجميع x86-64 إلى كود آلة، بلا as ولا ملفات مؤقتة. يقبل
+// فقط الصيغ التي ينتجها X86Generator: تعليماته وتوجيهات .string/.zero/.set.
+// الصورة الناتجة: الكود ثم (من بداية صفحة جديدة) البيانات الثابتة ثم .bss
+class X86Encoder
+{
+private:
+    enum class Section
+    {
+        Text,
+        Data,
+        Bss
+    };
+
+    struct Operand
+    {
+        enum class Kind
+        {
+            Register,
+            Immediate,
+            Memory,
+            Symbol
+        } kind = Kind::Symbol;
+        int reg = -1;  // رقم السجل 0-15
+        int size = 8;  // 4 أو 8 بايت للسجل
+        int64_t value = 0;    // الثابت أو الإزاحة
+        std::string symbol;   // ثابت رمزي، أو عنوان نسبي لـ %rip، أو هدف قفزة
+        int base = -1;
+        int index = -1;
+        int scale = 1;
+        bool rip = false;
+    };
+
+    struct Fixup
+    {
+        enum class Kind
+        {
+            Relative, // الهدف - نهاية التعليمة، في 4 بايت
+            Constant  // قيمة ثابت .set في 4 بايت
+        } kind;
+        size_t position;  // موضع الحقل في الكود
+        size_t end;       // نهاية التعليمة التي تحمله
+        std::string symbol;
+    };
+
+    struct Label
+    {
+        Section section;
+        size_t offset;
+    };
+
+    std::vector<uint8_t> text;
+    std::vector<uint8_t> data;
+    size_t bssSize = 0;
+    Section section = Section::Text;
+    std::unordered_map<std::string, Label> labels;
+    std::unordered_map<std::string, int64_t> constants;
+    std::vector<Fixup> fixups;
+    std::vector<std::pair<std::string, size_t>> trampolines; // دالة خارجية -> موضع عنوانها في الكود
+    std::vector<std::string> globalSymbols;                  // أسماء .globl
+    bool relocatable = false; // ملف كائن: الرموز الخارجية تبقى إزاحات للرابط بلا جسور
+    size_t dataOffset = 0;
+    size_t bssOffset = 0;
+
+    void line(const std::string &source);
+    void directive(const std::string &name, const std::string &args);
+    void instruction(const std::string &mnemonic, const std::vector<Operand> &operands);
+    Operand parseOperand(const std::string &text) const;
+
+    void emitRex(bool wide, int reg, const Operand &rm);
+    void emitModRM(int reg, const Operand &rm, size_t trailing);
+    void encode(std::initializer_list<uint8_t> opcode, bool wide, int reg, const Operand &rm,
+                int immediateBytes = 0, int64_t immediate = 0, const std::string &immediateSymbol = "");
+    void branch(std::initializer_list<uint8_t> opcode, const Operand &target);
+    void finish();
+
+    size_t addressOf(const std::string &symbol) const;
+
+    friend class ElfWriter;
+
+public:
+    // relocatable لكتابة ملف كائن بـ ElfWriter بدل الربط في الذاكرة
+    void assemble(const std::string &source, bool relocatable = false);
+
+    // حجم الصورة كاملة، وحجم الكود في أولها (مضاعف حجم الصفحة)
+    size_t imageSize() const { return bssOffset + bssSize; }
+    size_t codeSize() const { return dataOffset; }
+
+    // نسخ الصورة إلى base وحل العناوين؛ الدوال الخارجية تُقفز إليها عبر الجسور
+    void link(uint8_t *base, const std::unordered_map<std::string, void *> &externals) const;
+    size_t entryPoint(const std::string &symbol) const { return addressOf(symbol); }
+};
+
+#endif
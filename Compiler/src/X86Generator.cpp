@@ -0,0 +1,902 @@
+#include "X86Generator.h"
+#include "CFG.h"
+#include "OutputBuffer.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    // السجلات التي يحفظها المستدعى في System V: تبقى سليمة عبر printf وscanf
+    const std::vector<std::string> calleeSaved = {"%rbx", "%r12", "%r13", "%r14", "%r15"};
+    const std::unordered_map<std::string, std::string> lowHalf = {
+        {"%rbx", "%ebx"}, {"%r12", "%r12d"}, {"%r13", "%r13d"}, {"%r14", "%r14d"}, {"%r15", "%r15d"}};
+    // أول ستة معاملات صحيحة للدالة
+    const char *argumentRegisters[] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
+
+    // قيمة الثابت كما يراها int في C: الكسور تُقطع والقيم الكبيرة تلتف
+    int32_t constantValue(const std::string &operand)
+    {
+        if (operand == "صح")
+            return 1;
+        if (operand == "خطأ")
+            return 0;
+        if (operand.find('.') != std::string::npos)
+            return static_cast<int32_t>(std::stod(operand));
+        return static_cast<int32_t>(std::stoll(operand));
+    }
+
+    bool isMemory(const std::string &operand)
+    {
+        return operand.find('(') != std::string::npos;
+    }
+
+    bool isImmediate(const std::string &operand)
+    {
+        return !operand.empty() && operand[0] == '$';
+    }
+}
+
+X86Generator::X86Generator(const std::vector<Instruction> &code, std::vector<const ProcedureFrame *> owner,
+                           const std::unordered_map<std::string, ProcedureFrame> &frames,
+                           const std::unordered_map<std::string, std::string> &symbolTable,
+                           const std::vector<std::string> &stringLiterals, bool allocateRegisters,
+                           bool recycleTempSlots)
+    : code(code), owner(std::move(owner)), frames(frames), symbolTable(symbolTable),
+      stringLiterals(stringLiterals), allocateRegisters(allocateRegisters), recycleTempSlots(recycleTempSlots),
+      out(nullptr), frame(nullptr), layout(nullptr)
+{
+}
+
+std::string X86Generator::metaOf(const std::string &name) const
+{
+    if (frame && frame->owns(name))
+        return frame->symbols.at(name);
+    auto it = symbolTable.find(name);
+    return it == symbolTable.end() ? "" : it->second;
+}
+
+int X86Generator::slotSize(const std::string &meta) const
+{
+    // array:<elem>:<len> يحجز خانة لكل عنصر
+    if (meta.rfind("array:", 0) == 0)
+    {
+        size_t colon = meta.rfind(':');
+        if (colon != std::string::npos && colon > strlen("array:"))
+            return 8 * std::max(1, std::atoi(meta.c_str() + colon + 1));
+    }
+    return 8;
+}
+
+void X86Generator::analyze()
+{
+    // كما في مولد MIPS: المتغيرات العامة التي تلمسها الإجراءات أو يُمرر
+    // عنوانها تبقى في الذاكرة، ومؤقتات الإجراءات تعيش في إطاراتها
+    std::unordered_map<std::string, std::string> frameSymbols;
+    std::unordered_set<std::string> referenceParams;
+    for (const auto &entry : frames)
+    {
+        frameSymbols.insert(entry.second.symbols.begin(), entry.second.symbols.end());
+        referenceParams.insert(entry.second.byReference.begin(), entry.second.byReference.end());
+    }
+    std::unordered_set<std::string> pinnedToMemory;
+    std::unordered_map<const ProcedureFrame *, std::set<std::string>> frameNames;
+    std::set<std::string> globalNames;
+    for (const auto &symbol : symbolTable)
+    {
+        globalNames.insert(symbol.first);
+    }
+    std::vector<std::string> names;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        const Instruction &instr = code[i];
+        if (instr.type == InstructionType::ARG && instr.operand3 == "ref")
+            pinnedToMemory.insert(instr.operand2);
+        names.clear();
+        getUsedNames(instr, names);
+        names.push_back(getDefinedName(instr));
+        for (const auto &name : names)
+        {
+            if (name.empty())
+                continue;
+            if (!owner[i])
+            {
+                if (!isTempName(name))
+                    globalNames.insert(name);
+                continue;
+            }
+            // حقل سجل محلي (اسم.حقل) له خانته في الإطار كالمحليات
+            if (isTempName(name))
+                frameTemps.insert(name);
+            else if (!owner[i]->owns(name) && !owner[i]->owns(name.substr(0, name.find('.'))))
+            {
+                pinnedToMemory.insert(name);
+                globalNames.insert(name);
+                continue;
+            }
+            frameNames[owner[i]].insert(name);
+        }
+    }
+
+    // أسماء المصدر عربية، فتحصل الرموز العامة والإجراءات على تسميات ASCII
+    int index = 0;
+    for (const auto &name : globalNames)
+    {
+        globals[name] = "var_" + std::to_string(index++);
+    }
+    index = 0;
+    for (const auto &instr : code)
+    {
+        if (instr.type == InstructionType::FUNC)
+            procedures[instr.operand1] = "fn_" + std::to_string(index++);
+    }
+
+    allocator = std::make_unique<RegisterAllocator>(code, [&, frameSymbols, referenceParams, pinnedToMemory](const std::string &name)
+                                                    {
+                                                        if (pinnedToMemory.count(name) || referenceParams.count(name))
+                                                            return false;
+                                                        if (isTempName(name))
+                                                            return true;
+                                                        auto it = frameSymbols.find(name);
+                                                        if (it == frameSymbols.end())
+                                                        {
+                                                            it = symbolTable.find(name);
+                                                            if (it == symbolTable.end())
+                                                                return false;
+                                                        }
+                                                        return it->second.rfind("primitive:", 0) == 0 || it->second == "ثابت"; });
+    if (allocateRegisters)
+        allocator->allocate(calleeSaved);
+
+    // مؤقتات الإجراءات التي لا تتداخل أعمارها تتشارك خانة في الإطار، في كل
+    // المستويات: حجم الإطار يحدد عمق التعاود الممكن قبل نفاد المكدس
+    RegisterAllocator frameSlots(code, [this](const std::string &name)
+                                 { return frameTemps.count(name) && !allocator->inRegister(name); });
+    frameSlots.allocateSlots("f");
+
+    // تخطيط الإطار تحت %rbp: خانات ما بقي في الذاكرة ثم السجلات المحفوظة
+    for (const auto &entry : frames)
+    {
+        const ProcedureFrame *procedure = &entry.second;
+        FrameLayout &frameLayout = layouts[procedure];
+        std::vector<std::string> ordered(procedure->parameters.begin(), procedure->parameters.end());
+        for (const auto &local : procedure->locals)
+        {
+            // السجل نفسه لا يُقرأ إلا حقلاً حقلاً، فتحجز خانات حقوله فقط
+            if (procedure->symbols.at(local).rfind("record:", 0) != 0)
+                ordered.push_back(local);
+        }
+        for (const auto &name : frameNames[procedure])
+        {
+            if (name.find('.') != std::string::npos)
+            {
+                ordered.push_back(name);
+                frameLayout.fields.push_back(name);
+            }
+        }
+        for (const auto &name : frameNames[procedure])
+        {
+            if (isTempName(name))
+                ordered.push_back(name);
+        }
+
+        std::set<std::string> savedRegisters;
+        std::unordered_map<std::string, int> sharedOffsets; // خانة مشتركة -> إزاحتها في هذا الإطار
+        int offset = 0;
+        for (const auto &name : ordered)
+        {
+            std::string reg = allocator->registerOf(name);
+            if (!reg.empty())
+                savedRegisters.insert(reg);
+            else if (!frameLayout.slots.count(name))
+            {
+                std::string shared = procedure->owns(name) ? "" : frameSlots.registerOf(name);
+                auto reused = sharedOffsets.find(shared);
+                if (reused != sharedOffsets.end())
+                {
+                    frameLayout.slots[name] = reused->second;
+                    continue;
+                }
+                auto meta = procedure->symbols.find(name);
+                offset += slotSize(meta == procedure->symbols.end() ? "" : meta->second);
+                frameLayout.slots[name] = -offset;
+                if (!shared.empty())
+                    sharedOffsets[shared] = -offset;
+            }
+        }
+        for (const auto &reg : savedRegisters)
+        {
+            offset += 8;
+            frameLayout.saved.push_back({reg, -offset});
+        }
+        frameLayout.size = (offset + 15) / 16 * 16;
+    }
+
+    memorySlots = std::make_unique<RegisterAllocator>(code, [this](const std::string &name)
+                                                      { return isTempName(name) && !allocator->inRegister(name) && !frameTemps.count(name); });
+    if (recycleTempSlots)
+        memorySlots->allocateSlots("t");
+}
+
+void X86Generator::instr(const std::string &op, const std::string &args)
+{
+    *out << "    " << op;
+    if (!args.empty())
+        *out << " " << args;
+    *out << "\n";
+}
+
+std::string X86Generator::registerOf(const std::string &name) const
+{
+    return allocator->registerOf(name);
+}
+
+std::string X86Generator::memory(const std::string &name) const
+{
+    if (layout)
+    {
+        auto it = layout->slots.find(name);
+        if (it != layout->slots.end())
+            return std::to_string(it->second) + "(%rbp)";
+    }
+    if (isTempName(name))
+    {
+        std::string slot = memorySlots->registerOf(name);
+        return "temp_" + (slot.empty() ? name : slot).substr(1) + "(%rip)";
+    }
+    auto it = globals.find(name);
+    if (it == globals.end())
+        throw std::runtime_error("اسم غير معروف في توليد x86-64: " + name);
+    return it->second + "(%rip)";
+}
+
+std::string X86Generator::address(const std::string &name, const std::string &pointer)
+{
+    // المعامل بالمرجع: الخانة تحمل عنوان متغير المستدعي
+    if (frame && frame->byReference.count(name))
+    {
+        instr("movq", memory(name) + ", " + pointer);
+        return "(" + pointer + ")";
+    }
+    return memory(name);
+}
+
+std::string X86Generator::source32(const std::string &operand, const std::string &pointer)
+{
+    std::string reg = registerOf(operand);
+    if (!reg.empty())
+        return lowHalf.at(reg);
+    if (operand.rfind("str_", 0) == 0)
+    {
+        instr("leaq", operand + "(%rip), %rax");
+        return "%eax";
+    }
+    if (isConstantOperand(operand))
+        return "$" + std::to_string(constantValue(operand));
+    return address(operand, pointer);
+}
+
+std::string X86Generator::source64(const std::string &operand, const std::string &pointer)
+{
+    std::string reg = registerOf(operand);
+    if (!reg.empty())
+        return reg;
+    if (operand.rfind("str_", 0) == 0)
+    {
+        instr("leaq", operand + "(%rip), " + pointer);
+        return pointer;
+    }
+    if (isConstantOperand(operand))
+        return "$" + std::to_string(constantValue(operand));
+    return address(operand, pointer);
+}
+
+void X86Generator::store32(const std::string &name, const std::string &value)
+{
+    std::string reg = registerOf(name);
+    if (reg.empty())
+        instr("movl", value + ", " + address(name, "%r11"));
+    else if (lowHalf.at(reg) != value)
+        instr("movl", value + ", " + lowHalf.at(reg));
+}
+
+void X86Generator::store64(const std::string &name, const std::string &value)
+{
+    std::string reg = registerOf(name);
+    if (reg.empty())
+        instr("movq", value + ", " + address(name, "%r11"));
+    else if (reg != value)
+        instr("movq", value + ", " + reg);
+}
+
+void X86Generator::copy(const std::string &dest, const std::string &source)
+{
+    // النسخ بـ 64 بت حتى تنتقل عناوين السلاسل سليمة
+    std::string value = source64(source, "%r10");
+    if (registerOf(dest).empty() && isMemory(value))
+    {
+        instr("movq", value + ", %rax");
+        value = "%rax";
+    }
+    store64(dest, value);
+}
+
+void X86Generator::arrayBase(const std::string &name, const std::string &target)
+{
+    if (frame && frame->byReference.count(name))
+        instr("movq", memory(name) + ", " + target);
+    else
+        instr("leaq", memory(name) + ", " + target);
+}
+
+std::string X86Generator::element(const std::string &arrayName, const std::string &index)
+{
+    arrayBase(arrayName, "%r10");
+    if (isConstantOperand(index) && index.rfind("str_", 0) != 0)
+        return std::to_string(8LL * constantValue(index)) + "(%r10)";
+    instr("movslq", source32(index, "%r11") + ", %rcx");
+    return "(%r10,%rcx,8)";
+}
+
+void X86Generator::binary(const char *op, const Instruction &instr)
+{
+    // الصيغة الثنائية: op1 = op1 (عملية) op2
+    const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+    const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+
+    // يُحسب الناتج في سجل الهدف مباشرة ما لم يكن هو سجل المعامل الأيمن
+    std::string dest = registerOf(instr.operand1);
+    std::string rightReg = registerOf(right);
+    std::string result = !dest.empty() && dest != rightReg ? lowHalf.at(dest) : "%eax";
+
+    std::string value = source32(left, "%r10");
+    if (value != result)
+        this->instr("movl", value + ", " + result);
+    this->instr(op, source32(right, "%r11") + ", " + result);
+    store32(instr.operand1, result);
+}
+
+void X86Generator::divide(const Instruction &instr, bool remainder)
+{
+    const std::string &left = instr.operand3.empty() ? instr.operand1 : instr.operand2;
+    const std::string &right = instr.operand3.empty() ? instr.operand2 : instr.operand3;
+
+    // idivl يقسم %edx:%eax فيضع الناتج في %eax والباقي في %edx
+    this->instr("movl", source32(left, "%r10") + ", %eax");
+    this->instr("cltd");
+    std::string divisor = source32(right, "%r11");
+    if (isImmediate(divisor))
+    {
+        this->instr("movl", divisor + ", %ecx");
+        divisor = "%ecx";
+    }
+    this->instr("idivl", divisor);
+    store32(instr.operand1, remainder ? "%edx" : "%eax");
+}
+
+void X86Generator::leaveFrame()
+{
+    for (const auto &saved : layout->saved)
+    {
+        instr("movq", std::to_string(saved.second) + "(%rbp), " + saved.first);
+    }
+    instr("leave");
+}
+
+void X86Generator::emitData()
+{
+    *out << "    .section .rodata\n";
+    *out << "int_format: .string \"%d\\n\"\n";
+    *out << "str_format: .string \"%s\\n\"\n";
+    *out << "read_format: .string \"%d\"\n";
+
+    // تعريف السلاسل النصية
+    for (size_t i = 0; i < stringLiterals.size(); ++i)
+    {
+        *out << "str_" << i << ": .string \"" << escapeString(stringLiterals[i]) << "\"\n";
+    }
+
+    // المتغيرات العامة ومؤقتات البرنامج الرئيسي تبدأ بصفر في .bss
+    *out << "\n    .bss\n";
+    *out << "    .align 8\n";
+    std::vector<std::pair<std::string, std::string>> ordered;
+    for (const auto &global : globals)
+    {
+        ordered.push_back({global.second, global.first});
+    }
+    std::sort(ordered.begin(), ordered.end(), [](const auto &a, const auto &b)
+              { return std::stoi(a.first.substr(4)) < std::stoi(b.first.substr(4)); });
+    for (const auto &global : ordered)
+    {
+        auto meta = symbolTable.find(global.second);
+        *out << global.first << ": .zero " << slotSize(meta == symbolTable.end() ? "" : meta->second)
+             << "    # " << global.second << "\n";
+    }
+
+    std::set<int> temps;
+    for (const auto &instr : code)
+    {
+        std::vector<std::string> names;
+        getUsedNames(instr, names);
+        names.push_back(getDefinedName(instr));
+        for (const auto &name : names)
+        {
+            if (!isTempName(name) || allocator->inRegister(name) || frameTemps.count(name))
+                continue;
+            std::string slot = memorySlots->registerOf(name);
+            temps.insert(std::stoi((slot.empty() ? name : slot).substr(1)));
+        }
+    }
+    for (int temp : temps)
+    {
+        *out << "temp_" << temp << ": .zero 8\n";
+    }
+}
+
+void X86Generator::emitRuntime(bool checksBounds)
+{
+    // وقت التشغيل: دوال صغيرة فوق printf وscanf. عند الدخول يكون %rsp
+    // منزاحاً 8 بايت عن المحاذاة، فتحجز كل دالة ما يعيده إلى مضاعف 16
+    *out << "\nrt_print_int:\n";
+    instr("subq", "$8, %rsp");
+    instr("movl", "%edi, %esi");
+    instr("leaq", "int_format(%rip), %rdi");
+    instr("xorl", "%eax, %eax");
+    instr("call", "printf@PLT");
+    instr("addq", "$8, %rsp");
+    instr("ret");
+
+    *out << "\nrt_print_string:\n";
+    instr("subq", "$8, %rsp");
+    instr("movq", "%rdi, %rsi");
+    instr("leaq", "str_format(%rip), %rdi");
+    instr("xorl", "%eax, %eax");
+    instr("call", "printf@PLT");
+    instr("addq", "$8, %rsp");
+    instr("ret");
+
+    // القراءة الفاشلة تعيد صفراً كما في syscall 5 لمحاكي MIPS
+    *out << "\nrt_read_int:\n";
+    instr("subq", "$24, %rsp");
+    instr("movl", "$0, 12(%rsp)");
+    instr("leaq", "12(%rsp), %rsi");
+    instr("leaq", "read_format(%rip), %rdi");
+    instr("xorl", "%eax, %eax");
+    instr("call", "scanf@PLT");
+    instr("movl", "12(%rsp), %eax");
+    instr("addq", "$24, %rsp");
+    instr("ret");
+
+    // فشل فحص الحدود: رسالة على stderr ثم exit(1) الذي يفرغ stdout أولاً.
+    // يُقفز إليه من جسم دالة فالمكدس محاذى عند الاستدعاء
+    if (checksBounds)
+    {
+        *out << "\nrt_bounds_error:\n";
+        instr("movl", "$2, %edi");
+        instr("leaq", "bounds_message(%rip), %rsi");
+        instr("movl", "$bounds_message_length, %edx");
+        instr("call", "write@PLT");
+        instr("movl", "$1, %edi");
+        instr("call", "exit@PLT");
+
+        *out << "\n    .section .rodata\n";
+        *out << "bounds_message: .ascii \"خطأ وقت التنفيذ: فهرس خارج حدود القائمة\\n\"\n";
+        *out << "    .set bounds_message_length, . - bounds_message\n";
+    }
+}
+
+void X86Generator::generate(std::ostream &stream)
+{
+    out = &stream;
+    analyze();
+
+    *out << "# كود تجميعي x86-64 مولد للغة العربية (GNU as, System V)\n";
+    *out << "# للبناء: gcc <الملف>.s -o <البرنامج>\n";
+    *out << "# =======================================================\n\n";
+
+    emitData();
+
+    *out << "\n    .text\n";
+    *out << "    .globl main\n";
+    *out << "    .type main, @function\n";
+    *out << "main:\n";
+    instr("pushq", "%rbp");
+    instr("movq", "%rsp, %rbp");
+
+    // ما في السجلات ويُقرأ قبل الكتابة يبدأ بصفر كما في .bss
+    for (const auto &name : allocator->getLiveAtEntry())
+    {
+        std::string reg = lowHalf.at(registerOf(name));
+        instr("xorl", reg + ", " + reg);
+    }
+
+    // تسميات محلية لا تظهر في جدول رموز الكائن
+    auto label = [](const std::string &name)
+    {
+        return "." + name;
+    };
+
+    // لتتبع آخر عملية مقارنة
+    std::string lastCmpLeft;
+    std::string lastCmpRight;
+
+    auto branch = [&](const char *op, const std::string &target)
+    {
+        // cmpl يقبل ذاكرة في طرف واحد فقط، والطرف الأيسر لا يكون ثابتاً
+        std::string left = source32(lastCmpLeft, "%r10");
+        std::string right = source32(lastCmpRight, "%r11");
+        if (isImmediate(left) || (isMemory(left) && isMemory(right)))
+        {
+            instr("movl", left + ", %eax");
+            left = "%eax";
+        }
+        instr("cmpl", right + ", " + left);
+        instr(op, label(target));
+    };
+
+    auto test = [&](const char *op, const std::string &operand, const std::string &target)
+    {
+        std::string value = source32(operand, "%r10");
+        if (isImmediate(value))
+        {
+            instr("movl", value + ", %eax");
+            value = "%eax";
+        }
+        instr("cmpl", "$0, " + value);
+        instr(op, label(target));
+    };
+
+    auto exitProgram = [&]()
+    {
+        instr("xorl", "%edi, %edi");
+        instr("call", "exit@PLT");
+    };
+
+    // معاملات الاستدعاء التالي بالترتيب
+    std::vector<const Instruction *> pendingArgs;
+    bool checksBounds = false;
+
+    for (size_t index = 0; index < code.size(); ++index)
+    {
+        const Instruction &current = code[index];
+        frame = owner[index];
+        layout = frame ? &layouts.at(frame) : nullptr;
+
+        switch (current.type)
+        {
+        case InstructionType::LOAD:
+        case InstructionType::STORE:
+            copy(current.operand1, current.operand2);
+            break;
+
+        case InstructionType::ADD:
+            binary("addl", current);
+            break;
+
+        case InstructionType::SUB:
+            binary("subl", current);
+            break;
+
+        case InstructionType::MUL:
+            binary("imull", current);
+            break;
+
+        case InstructionType::DIV:
+            divide(current, false);
+            break;
+
+        case InstructionType::MOD:
+            divide(current, true);
+            break;
+
+        case InstructionType::SHL:
+        case InstructionType::SHR:
+        case InstructionType::SAR:
+        case InstructionType::BITAND:
+        {
+            const char *op = current.type == InstructionType::SHL   ? "shll"
+                             : current.type == InstructionType::SHR ? "shrl"
+                             : current.type == InstructionType::SAR ? "sarl"
+                                                                    : "andl";
+            std::string dest = registerOf(current.operand1);
+            std::string result = dest.empty() ? "%eax" : lowHalf.at(dest);
+            std::string value = source32(current.operand2, "%r10");
+            if (value != result)
+                instr("movl", value + ", " + result);
+            instr(op, "$" + std::to_string(constantValue(current.operand3)) + ", " + result);
+            store32(current.operand1, result);
+            break;
+        }
+
+        case InstructionType::MULHI:
+        {
+            // الجداء الكامل في 64 بت ثم نصفه الأعلى
+            std::string value = source32(current.operand2, "%r10");
+            instr(isImmediate(value) ? "movq" : "movslq", value + ", %rax");
+            long long magic = std::stoll(current.operand3);
+            if (magic >= INT32_MIN && magic <= INT32_MAX)
+                instr("imulq", "$" + current.operand3 + ", %rax");
+            else
+            {
+                instr("movabsq", "$" + current.operand3 + ", %rcx");
+                instr("imulq", "%rcx, %rax");
+            }
+            instr("sarq", "$32, %rax");
+            store32(current.operand1, "%eax");
+            break;
+        }
+
+        case InstructionType::LOAD_INDEXED:
+        {
+            std::string slot = element(current.operand2, current.operand3);
+            std::string dest = registerOf(current.operand1);
+            if (!dest.empty())
+                instr("movq", slot + ", " + dest);
+            else
+            {
+                instr("movq", slot + ", %rax");
+                store64(current.operand1, "%rax");
+            }
+            break;
+        }
+
+        case InstructionType::STORE_INDEXED:
+        {
+            std::string slot = element(current.operand1, current.operand2);
+            std::string value = source64(current.operand3, "%r11");
+            if (isMemory(value))
+            {
+                instr("movq", value + ", %rax");
+                value = "%rax";
+            }
+            instr("movq", value + ", " + slot);
+            break;
+        }
+
+        case InstructionType::BOUNDS:
+        {
+            // مقارنة بلا إشارة: الفهرس السالب يصبح عدداً كبيراً فيفشل الشرط نفسه
+            std::string value = source32(current.operand1, "%r10");
+            if (isImmediate(value))
+            {
+                instr("movl", value + ", %eax");
+                value = "%eax";
+            }
+            instr("cmpl", "$" + current.operand2 + ", " + value);
+            instr("jae", "rt_bounds_error");
+            checksBounds = true;
+            break;
+        }
+
+        case InstructionType::PRINT:
+            if (current.operand1 == "STRING")
+            {
+                instr("leaq", current.operand2 + "(%rip), %rdi");
+                instr("call", "rt_print_string");
+            }
+            else if (current.operand1 == "VARIABLE" && metaOf(current.operand2) == "primitive:char*")
+            {
+                instr("movq", source64(current.operand2, "%r10") + ", %rdi");
+                instr("call", "rt_print_string");
+            }
+            else
+            {
+                instr("movl", source32(current.operand2, "%r10") + ", %edi");
+                instr("call", "rt_print_int");
+            }
+            break;
+
+        case InstructionType::READ:
+            instr("call", "rt_read_int");
+            store32(current.operand1, "%eax");
+            break;
+
+        case InstructionType::JMP:
+            instr("jmp", label(current.operand1));
+            break;
+
+        case InstructionType::JZ:
+            test("je", current.operand1, current.operand2);
+            break;
+
+        case InstructionType::JNZ:
+            test("jne", current.operand1, current.operand2);
+            break;
+
+        case InstructionType::LABEL:
+            *out << label(current.operand1) << ":\n";
+            break;
+
+        case InstructionType::CMP:
+            // المقارنة تُنفذ مع القفزة الشرطية التالية
+            lastCmpLeft = current.operand1;
+            lastCmpRight = current.operand2;
+            break;
+
+        case InstructionType::JE:
+            branch("je", current.operand1);
+            break;
+
+        case InstructionType::JNE:
+            branch("jne", current.operand1);
+            break;
+
+        case InstructionType::JG:
+            branch("jg", current.operand1);
+            break;
+
+        case InstructionType::JL:
+            branch("jl", current.operand1);
+            break;
+
+        case InstructionType::JGE:
+            branch("jge", current.operand1);
+            break;
+
+        case InstructionType::JLE:
+            branch("jle", current.operand1);
+            break;
+
+        case InstructionType::HALT:
+            exitProgram();
+            break;
+
+        case InstructionType::FUNC:
+        {
+            // مقدمة الإجراء: إطار %rbp وحفظ السجلات المستخدمة
+            *out << "\n"
+                 << procedures.at(current.operand1) << ":    # " << current.operand1 << "\n";
+            instr("pushq", "%rbp");
+            instr("movq", "%rsp, %rbp");
+            if (layout->size > 0)
+                instr("subq", "$" + std::to_string(layout->size) + ", %rsp");
+            for (const auto &saved : layout->saved)
+            {
+                instr("movq", saved.first + ", " + std::to_string(saved.second) + "(%rbp)");
+            }
+
+            // أول ستة معاملات في السجلات، والباقي فوق عنوان العودة
+            for (size_t k = 0; k < frame->parameters.size(); ++k)
+            {
+                const std::string &param = frame->parameters[k];
+                std::string source = k < 6 ? argumentRegisters[k] : "%rax";
+                if (k >= 6)
+                    instr("movq", std::to_string(16 + 8 * static_cast<int>(k - 6)) + "(%rbp), %rax");
+                std::string reg = registerOf(param);
+                instr("movq", source + ", " + (reg.empty() ? memory(param) : reg));
+            }
+
+            // المتغيرات المحلية وحقول السجلات المحلية تبدأ بصفر في كل استدعاء
+            for (const auto &field : layout->fields)
+                instr("movq", "$0, " + memory(field));
+            for (const auto &local : frame->locals)
+            {
+                if (!layout->slots.count(local) && registerOf(local).empty())
+                    continue;
+                std::string reg = registerOf(local);
+                int size = slotSize(frame->symbols.at(local));
+                if (!reg.empty())
+                    instr("xorl", lowHalf.at(reg) + ", " + lowHalf.at(reg));
+                else if (size > 8)
+                {
+                    instr("leaq", memory(local) + ", %rdi");
+                    instr("movl", "$" + std::to_string(size / 8) + ", %ecx");
+                    instr("xorl", "%eax, %eax");
+                    instr("rep stosq");
+                }
+                else
+                    instr("movq", "$0, " + memory(local));
+            }
+            break;
+        }
+
+        case InstructionType::ARG:
+            pendingArgs.push_back(&current);
+            break;
+
+        case InstructionType::CALL:
+        {
+            if (!procedures.count(current.operand1))
+            {
+                // إجراء غير معرّف: لا يوجد ما يُقفز إليه
+                *out << "    # " << current.toString() << "\n";
+                pendingArgs.clear();
+                break;
+            }
+
+            // قيمة المعامل أو عنوانه في السجل المطلوب
+            auto argument = [&](const Instruction &arg, const std::string &target)
+            {
+                if (isElementReference(arg))
+                {
+                    // عنوان العنصر، دون %rcx الذي قد يحمل المعامل الرابع
+                    arrayBase(arg.operand2, "%r10");
+                    if (isConstantOperand(arg.operand3))
+                        instr("leaq", std::to_string(8LL * constantValue(arg.operand3)) + "(%r10), " + target);
+                    else
+                    {
+                        instr("movslq", source32(arg.operand3, "%r11") + ", %r11");
+                        instr("leaq", "(%r10,%r11,8), " + target);
+                    }
+                }
+                else if (arg.operand3 == "ref")
+                    arrayBase(arg.operand2, target);
+                else
+                {
+                    std::string value = source64(arg.operand2, "%r10");
+                    if (value != target)
+                        instr("movq", value + ", " + target);
+                }
+            };
+
+            // المعاملات بعد السادس تُدفع من الأخير، مع حشوة تحفظ محاذاة 16 بايت
+            int stackArgs = pendingArgs.size() > 6 ? static_cast<int>(pendingArgs.size()) - 6 : 0;
+            int stackBytes = 8 * (stackArgs + stackArgs % 2);
+            if (stackArgs % 2)
+                instr("subq", "$8, %rsp");
+            for (size_t k = pendingArgs.size(); k-- > 6;)
+            {
+                argument(*pendingArgs[k], "%rax");
+                instr("pushq", "%rax");
+            }
+            for (size_t k = 0; k < pendingArgs.size() && k < 6; ++k)
+            {
+                argument(*pendingArgs[k], argumentRegisters[k]);
+            }
+            pendingArgs.clear();
+
+            const std::string &target = procedures.at(current.operand1);
+            if (current.operand3 == "tail" && frame && stackArgs == 0)
+            {
+                // استدعاء أخير: المعاملات في السجلات، فيُحرر الإطار ويعود
+                // المستدعى مباشرة إلى من استدعانا
+                leaveFrame();
+                instr("jmp", target);
+                break;
+            }
+            instr("call", target);
+            if (stackBytes > 0)
+                instr("addq", "$" + std::to_string(stackBytes) + ", %rsp");
+            if (current.operand3 == "tail" && frame)
+                instr("jmp", label("Lend_" + procedures.at(frame->label)));
+            break;
+        }
+
+        case InstructionType::RET:
+            if (!frame)
+            {
+                // إرجاع في البرنامج الرئيسي ينهي التنفيذ
+                exitProgram();
+                break;
+            }
+            if (!current.operand1.empty())
+            {
+                std::string value = source32(current.operand1, "%r10");
+                if (value != "%eax")
+                    instr("movl", value + ", %eax");
+            }
+            instr("jmp", label("Lend_" + procedures.at(frame->label)));
+            break;
+
+        default:
+            *out << "    # " << current.toString() << "\n";
+            break;
+        }
+
+        // خاتمة الإجراء بعد آخر تعليماته: استعادة السجلات والعودة إلى المستدعي
+        if (frame && (index + 1 == code.size() || owner[index + 1] != frame))
+        {
+            *out << label("Lend_" + procedures.at(frame->label)) << ":\n";
+            leaveFrame();
+            instr("ret");
+        }
+    }
+    frame = nullptr;
+    layout = nullptr;
+
+    emitRuntime(checksBounds);
+
+    *out << "\n    .section .note.GNU-stack,\"\",@progbits\n";
+    out = nullptr;
+}
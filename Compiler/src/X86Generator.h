@@ -0,0 +1,79 @@
+#ifndef X86_GENERATOR_H
+#define X86_GENERATOR_H
+
+#include "Instruction.h"
+#include "ProcedureFrame.h"
+#include "RegisterAllocator.h"
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// مولد تجميع x86-64 بصيغة GNU as لواجهة System V: يُجمّع ويُربط بـ gcc
+// مباشرة ويعتمد على printf وscanf من مكتبة C في وقت التشغيل الصغير.
+// كل اسم يشغل 8 بايت (السلاسل عناوين)، والحساب يتم بسجلات 32 بت كما في int
+class X86Generator
+{
+private:
+    struct FrameLayout
+    {
+        std::unordered_map<std::string, int> slots;             // الاسم -> الإزاحة تحت %rbp
+        std::vector<std::pair<std::string, int>> saved;         // السجلات التي يحفظها الإجراء
+        std::vector<std::string> fields;                        // حقول السجلات المحلية، تُصفّر مع المحليات
+        int size = 0;                                           // مضاعف 16 ليبقى المكدس محاذى عند الاستدعاء
+    };
+
+    const std::vector<Instruction> &code;
+    std::vector<const ProcedureFrame *> owner; // الإطار المالك لكل تعليمة (nullptr للبرنامج الرئيسي)
+    const std::unordered_map<std::string, ProcedureFrame> &frames;
+    const std::unordered_map<std::string, std::string> &symbolTable;
+    const std::vector<std::string> &stringLiterals;
+    bool allocateRegisters;
+    bool recycleTempSlots;
+
+    std::unique_ptr<RegisterAllocator> allocator;
+    std::unique_ptr<RegisterAllocator> memorySlots;
+    std::unordered_set<std::string> frameTemps;
+    std::unordered_map<std::string, std::string> globals;    // الاسم العام -> تسمية ASCII في .bss
+    std::unordered_map<std::string, std::string> procedures; // تسمية الإجراء -> تسمية ASCII
+    std::unordered_map<const ProcedureFrame *, FrameLayout> layouts;
+
+    std::ostream *out;
+    const ProcedureFrame *frame; // الإجراء الذي تُولد تعليماته الآن
+    const FrameLayout *layout;
+
+    void analyze();
+    std::string metaOf(const std::string &name) const;
+    int slotSize(const std::string &meta) const;
+
+    void instr(const std::string &op, const std::string &args = "");
+    std::string registerOf(const std::string &name) const;
+    std::string memory(const std::string &name) const;
+    std::string address(const std::string &name, const std::string &pointer);
+    std::string source32(const std::string &operand, const std::string &pointer);
+    std::string source64(const std::string &operand, const std::string &pointer);
+    void store32(const std::string &name, const std::string &value);
+    void store64(const std::string &name, const std::string &value);
+    void copy(const std::string &dest, const std::string &source);
+    void arrayBase(const std::string &name, const std::string &target);
+    std::string element(const std::string &arrayName, const std::string &index);
+    void binary(const char *op, const Instruction &instr);
+    void divide(const Instruction &instr, bool remainder);
+    void leaveFrame();
+
+    void emitData();
+    void emitRuntime(bool checksBounds);
+
+public:
+    X86Generator(const std::vector<Instruction> &code, std::vector<const ProcedureFrame *> owner,
+                 const std::unordered_map<std::string, ProcedureFrame> &frames,
+                 const std::unordered_map<std::string, std::string> &symbolTable,
+                 const std::vector<std::string> &stringLiterals, bool allocateRegisters, bool recycleTempSlots);
+
+    void generate(std::ostream &out);
+};
+
+#endif
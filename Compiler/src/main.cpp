@@ -5,9 +5,14 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstring>
+#include <mutex>
 #include "Lexer.h"
 #include "Parser.h"
 #include "Compiler.h"
+#include "PassManager.h"
+#include "TaskPool.h"
+#include "Console.h"
 
 // قراءة الملف العربي باستخدام الترميز الصحيح
 std::string readFile(const std::string &filename)
@@ -15,7 +20,7 @@ std::string readFile(const std::string &filename)
     std::ifstream file(filename, std::ios::binary);
     if (!file.is_open())
     {
-        std::cerr << "خطأ: لا يمكن فتح الملف: " << filename << std::endl;
+        consoleErrors() << "خطأ: لا يمكن فتح الملف: " << filename << std::endl;
         throw std::runtime_error("لا يمكن فتح الملف: " + filename);
     }
 
@@ -37,12 +42,12 @@ std::string readFile(const std::string &filename)
 
 void printTokens(const std::vector<Token> &tokens)
 {
-    std::cout << "🎯 الرموز المميزة:" << std::endl;
-    std::cout << "=================" << std::endl;
+    consoleOutput() << "🎯 الرموز المميزة:" << std::endl;
+    consoleOutput() << "=================" << std::endl;
 
     for (const auto &token : tokens)
     {
-        std::cout << "السطر " << token.line << ", العمود " << token.column << ": "
+        consoleOutput() << "السطر " << token.line << ", العمود " << token.column << ": "
                   << token.typeToString() << " -> '";
 
         // طباعة القيمة مع التعامل مع الأحرف غير القابلة للطباعة
@@ -50,16 +55,16 @@ void printTokens(const std::vector<Token> &tokens)
         {
             if (c >= 32 && c < 127)
             {
-                std::cout << c;
+                consoleOutput() << c;
             }
             else
             {
-                std::cout << "?";
+                consoleOutput() << "?";
             }
         }
-        std::cout << "'" << std::endl;
+        consoleOutput() << "'" << std::endl;
     }
-    std::cout << std::endl;
+    consoleOutput() << std::endl;
 }
 
 void displayHelp()
@@ -67,86 +72,83 @@ void displayHelp()
     std::cout << "🚀 مترجم اللغة العربية - الإصدار المتكامل" << std::endl;
     std::cout << "=========================================" << std::endl;
     std::cout << "استخدام: ArabicCompiler <ملف_المصدر> [خيارات]" << std::endl;
+    std::cout << "        ArabicCompiler -j<ن> <ملف> <ملف>... | @<قائمة_ملفات> [خيارات]" << std::endl;
     std::cout << std::endl;
     std::cout << "خيارات:" << std::endl;
     std::cout << "  --asm     توليد كود تجميعي (MIPS)" << std::endl;
+    std::cout << "  --x86-64  توليد تجميع x86-64 (GNU as) يُربط بـ gcc" << std::endl;
+    std::cout << "  --x86-64-obj كتابة ملف كائن ELF64 (.o) مباشرة دون as" << std::endl;
+    std::cout << "  --llvm    توليد LLVM IR نصي (.ll) يُترجم بـ clang" << std::endl;
+    std::cout << "  --run     تشغيل البرنامج مباشرة بكود آلة x86-64 في الذاكرة" << std::endl;
+    std::cout << "  --interpret تفسير البرنامج بآلة bytecode محمولة دون مترجم C" << std::endl;
     std::cout << "  --c       توليد كود C" << std::endl;
+    std::cout << "  --c-structured توليد كود C بحلقات وشروط حقيقية من شجرة الاشتقاق" << std::endl;
+    std::cout << "  --checked-arrays فحص حدود القوائم وقت التنفيذ" << std::endl;
     std::cout << "  --ir      توليد كود وسيط" << std::endl;
     std::cout << "  --all     توليد جميع المخرجات" << std::endl;
     std::cout << "  --tokens  عرض الرموز المميزة" << std::endl;
     std::cout << "  --ast     عرض شجرة الاشتقاق النحوي" << std::endl;
     std::cout << "  --help    عرض هذه المساعدة" << std::endl;
     std::cout << "  --debug-lexer طباعة معلومات تشخيصية للـ lexer (بايتس)" << std::endl;
+    std::cout << "  -O0       بدون تحسينات (أسرع ترجمة)" << std::endl;
+    std::cout << "  -O1       تحسينات أساسية (الافتراضي)" << std::endl;
+    std::cout << "  -O2       تحسينات مكثفة" << std::endl;
+    std::cout << "  --passes=<أسماء> اختيار التمريرات صراحة مفصولة بفواصل" << std::endl;
+    std::cout << "  --unroll-factor=<ن> عدد نسخ جسم الحلقة عند الفك الجزئي (الافتراضي 4)" << std::endl;
+    std::cout << "  -j<ن>     ترجمة عدة ملفات معاً على ن خيط (بدون ن: عدد الأنوية)" << std::endl;
+    std::cout << "  @<ملف>    قراءة ملفات المصدر من ملف قائمة، ملف في كل سطر" << std::endl;
+    std::cout << std::endl;
+    std::cout << "التمريرات المتاحة:" << std::endl;
+    PassManager().describe(std::cout);
     std::cout << std::endl;
     std::cout << "أمثلة:" << std::endl;
     std::cout << "  ArabicCompiler program.arabic --all" << std::endl;
     std::cout << "  ArabicCompiler program.arabic --asm --tokens" << std::endl;
     std::cout << "  ArabicCompiler program.arabic --tokens --ast" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --asm -O0" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --c --passes=licm,slots" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --asm -O2 --unroll-factor=8" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --c --checked-arrays" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --x86-64 && gcc program_output.s -o program" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --x86-64-obj && gcc program_output.o -o program" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --llvm && clang -O2 program_output.ll -o program" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --run" << std::endl;
+    std::cout << "  ArabicCompiler program.arabic --interpret -O2" << std::endl;
+    std::cout << "  ArabicCompiler -j16 a.arabic b.arabic c.arabic --all" << std::endl;
+    std::cout << "  ArabicCompiler -j @programs.txt --c -O2" << std::endl;
 }
 
-int main(int argc, char *argv[])
+// خيارات سطر الأوامر، مشتركة بين كل الملفات في الترجمة الدفعية
+struct Options
 {
-// إعداد الترميز للمخرجات العربية
-#ifdef _WIN32
-    system("chcp 65001 > nul");
-#endif
-
-    if (argc < 2 || (argc >= 2 && std::string(argv[1]) == "--help"))
-    {
-        displayHelp();
-        return 0;
-    }
-
-    std::string filename = argv[1];
     bool generateAsm = false;
     bool generateC = false;
+    bool generateX86 = false;
+    bool generateObject = false;
+    bool generateLLVM = false;
+    bool runProgram = false;
+    bool interpretProgram = false;
     bool generateIr = false;
+    bool structuredC = false;
+    bool checkedArrays = false;
     bool showTokens = false;
     bool showAST = false;
     bool debugLexer = false;
+    unsigned emitterThreads = 0; // 1 في الترجمة الدفعية: الملفات نفسها تُترجم متوازية
+    PassManager passManager;
+};
 
-    // معالجة الخيارات
-    for (int i = 2; i < argc; i++)
-    {
-        std::string option = argv[i];
-        if (option == "--asm")
-            generateAsm = true;
-        else if (option == "--c")
-            generateC = true;
-        else if (option == "--ir")
-            generateIr = true;
-        else if (option == "--all")
-        {
-            generateAsm = generateC = generateIr = true;
-        }
-        else if (option == "--tokens")
-            showTokens = true;
-        else if (option == "--ast")
-            showAST = true;
-        else if (option == "--debug-lexer")
-            debugLexer = true;
-        else
-        {
-            std::cerr << "❌ خيار غير معروف: " << option << std::endl;
-            displayHelp();
-            return 1;
-        }
-    }
-
-    // إذا لم يتم تحديد أي خيار، استخدم الافتراضي
-    if (!generateAsm && !generateC && !generateIr && !showTokens && !showAST)
-    {
-        generateAsm = true; // الافتراضي: توليد كود التجميع
-    }
-
+// ترجمة ملف مصدر واحد بالخيارات المعطاة، ويعيد رمز خروج المترجم لهذا الملف
+int compileFile(const std::string &filename, const Options &options)
+{
     try
     {
         std::string sourceCode = readFile(filename);
-        std::cout << "📁 جاري تحليل الملف: " << filename << std::endl;
-        std::cout << "📏 طول النص: " << sourceCode.length() << " حرف" << std::endl;
+        consoleOutput() << "📁 جاري تحليل الملف: " << filename << std::endl;
+        consoleOutput() << "📏 طول النص: " << sourceCode.length() << " حرف" << std::endl;
 
         // التحليل اللغوي
-        Lexer lexer(sourceCode, debugLexer);
+        Lexer lexer(sourceCode, options.debugLexer);
         auto tokens = lexer.tokenize();
 
         // التحقق من الأخطاء اللغوية
@@ -155,7 +157,7 @@ int main(int argc, char *argv[])
         {
             if (token.type == TokenType::ERROR)
             {
-                std::cerr << "❌ خطأ لغوي في السطر " << token.line
+                consoleErrors() << "❌ خطأ لغوي في السطر " << token.line
                           << ", العمود " << token.column << ": "
                           << token.value << std::endl;
                 hasLexicalErrors = true;
@@ -164,22 +166,22 @@ int main(int argc, char *argv[])
 
         if (hasLexicalErrors)
         {
-            std::cerr << "❌ فشل التحليل اللغوي بسبب وجود أخطاء." << std::endl;
+            consoleErrors() << "❌ فشل التحليل اللغوي بسبب وجود أخطاء." << std::endl;
             return 1;
         }
 
         // إذا طلب المستخدم عرض الرموز فقط
-        if (showTokens)
+        if (options.showTokens)
         {
             printTokens(tokens);
-            if (!generateAsm && !generateC && !generateIr && !showAST)
+            if (!options.generateAsm && !options.generateC && !options.generateIr && !options.generateX86 && !options.generateObject && !options.generateLLVM && !options.runProgram && !options.interpretProgram && !options.showAST)
             {
-                std::cout << "✅ عرض الرموز المميزة تم بنجاح!" << std::endl;
+                consoleOutput() << "✅ عرض الرموز المميزة تم بنجاح!" << std::endl;
                 return 0;
             }
         }
 
-        std::cout << "✅ التحليل اللغوي تم بنجاح! (" << tokens.size() << " رمز)" << std::endl;
+        consoleOutput() << "✅ التحليل اللغوي تم بنجاح! (" << tokens.size() << " رمز)" << std::endl;
 
         // التحليل النحوي
         Parser parser(tokens);
@@ -187,39 +189,42 @@ int main(int argc, char *argv[])
 
         if (!program)
         {
-            std::cerr << "❌ فشل التحليل النحوي." << std::endl;
+            consoleErrors() << "❌ فشل التحليل النحوي." << std::endl;
             return 1;
         }
 
-        std::cout << "✅ التحليل النحوي تم بنجاح!" << std::endl;
+        consoleOutput() << "✅ التحليل النحوي تم بنجاح!" << std::endl;
 
         // عرض شجرة الاشتقاق النحوي إذا طلب المستخدم
-        if (showAST)
+        if (options.showAST)
         {
-            std::cout << "🌳 شجرة الاشتقاق النحوي (AST):" << std::endl;
-            std::cout << "=============================" << std::endl;
+            consoleOutput() << "🌳 شجرة الاشتقاق النحوي (AST):" << std::endl;
+            consoleOutput() << "=============================" << std::endl;
 
             // استخدام المؤشر الخام مباشرة - لا نحتاج إلى إنشاء unique_ptr جديد
             // لأن program هو بالفعل unique_ptr ويدير الذاكرة
             parser.printAST(program.get());
             parser.printProgramStructure(program.get());
 
-            if (!generateAsm && !generateC && !generateIr)
+            if (!options.generateAsm && !options.generateC && !options.generateIr && !options.generateX86 && !options.generateObject && !options.generateLLVM && !options.runProgram && !options.interpretProgram)
             {
-                std::cout << "✅ عرض الشجرة النحوية تم بنجاح!" << std::endl;
+                consoleOutput() << "✅ عرض الشجرة النحوية تم بنجاح!" << std::endl;
                 return 0;
             }
         }
         // الترجمة
         Compiler compiler;
+        compiler.configure(options.passManager);
+        compiler.setCheckedArrays(options.checkedArrays);
         auto instructions = compiler.compile(std::move(program));
+        compiler.optimize(options.passManager);
 
         if (instructions.empty())
         {
-            std::cerr << "⚠️  لم يتم توليد أي تعليمات. قد يكون البرنامج فارغاً." << std::endl;
+            consoleErrors() << "⚠️  لم يتم توليد أي تعليمات. قد يكون البرنامج فارغاً." << std::endl;
         }
 
-        std::cout << "🔧 جاري توليد المخرجات..." << std::endl;
+        consoleOutput() << "🔧 جاري توليد المخرجات..." << std::endl;
 
         // توليد أسماء الملفات الناتجة
         std::string baseName = filename;
@@ -232,60 +237,297 @@ int main(int argc, char *argv[])
         // إضافة لاحقة لتجنب الكتابة فوق الملف الأصلي
         baseName = baseName + "_output";
 
-        // توليد المخرجات المطلوبة
-        bool generatedAnyOutput = false;
-
-        if (generateIr)
+        // توليد المخرجات المطلوبة: المولدات تقرأ الكود الوسيط فقط، فتعمل معاً
+        // وكل منها يكتب ملفه. الرسائل تُطبع بعد انتهائها بالترتيب المعتاد
+        TaskPool emitters(options.emitterThreads);
+        std::vector<std::string> generated;
+        auto addOutput = [&](const std::string &file, const std::string &message, void (Compiler::*emit)(const std::string &) const)
         {
-            std::string irFile = baseName + "_intermediate.txt";
-            compiler.generateIntermediateCode(irFile);
-            std::cout << "📄 تم توليد الكود الوسيط: " << irFile << std::endl;
-            generatedAnyOutput = true;
+            emitters.add([&compiler, emit, file]()
+                         { (compiler.*emit)(file); });
+            generated.push_back(message + file);
+        };
+
+        if (options.generateIr)
+            addOutput(baseName + "_intermediate.txt", "📄 تم توليد الكود الوسيط: ", &Compiler::generateIntermediateCode);
+        if (options.generateC)
+            addOutput(baseName + ".c", "📄 تم توليد كود C: ",
+                      options.structuredC ? &Compiler::generateStructuredCCode : &Compiler::generateCCode);
+        if (options.generateAsm)
+            addOutput(baseName + ".asm", "📄 تم توليد كود التجميع: ", &Compiler::generateAssembly);
+        if (options.generateX86)
+            addOutput(baseName + ".s", "📄 تم توليد كود x86-64: ", &Compiler::generateX86Assembly);
+        if (options.generateObject)
+            addOutput(baseName + ".o", "📄 تم توليد ملف كائن ELF: ", &Compiler::generateX86Object);
+        if (options.generateLLVM)
+            addOutput(baseName + ".ll", "📄 تم توليد كود LLVM IR: ", &Compiler::generateLLVMCode);
+
+        emitters.run();
+        for (const auto &message : generated)
+        {
+            consoleOutput() << message << std::endl;
         }
+        bool generatedAnyOutput = !generated.empty();
 
-        if (generateC)
+        // عرض إحصائيات وتعليمات وسيطة (لا داعي لها إذا كان المطلوب التشغيل فقط)
+        if (!instructions.empty() && (generatedAnyOutput || (!options.runProgram && !options.interpretProgram)))
         {
-            std::string cFile = baseName + ".c";
-            compiler.generateCCode(cFile);
-            std::cout << "📄 تم توليد كود C: " << cFile << std::endl;
-            generatedAnyOutput = true;
+            compiler.displayInstructions();
         }
 
-        if (generateAsm)
+        if (generatedAnyOutput)
         {
-            std::string asmFile = baseName + ".asm";
-            compiler.generateAssembly(asmFile);
-            std::cout << "📄 تم توليد كود التجميع: " << asmFile << std::endl;
-            generatedAnyOutput = true;
+            consoleOutput() << "🎉 الترجمة تمت بنجاح!" << std::endl;
+            consoleOutput() << "📊 الملفات الناتجة:" << std::endl;
+            if (options.generateIr)
+                consoleOutput() << "   - " << baseName << "_intermediate.txt (الكود الوسيط)" << std::endl;
+            if (options.generateC)
+                consoleOutput() << "   - " << baseName << ".c (كود C)" << std::endl;
+            if (options.generateAsm)
+                consoleOutput() << "   - " << baseName << ".asm (كود Assembly)" << std::endl;
+            if (options.generateX86)
+                consoleOutput() << "   - " << baseName << ".s (كود x86-64)" << std::endl;
+            if (options.generateObject)
+                consoleOutput() << "   - " << baseName << ".o (ملف كائن ELF)" << std::endl;
+            if (options.generateLLVM)
+                consoleOutput() << "   - " << baseName << ".ll (كود LLVM IR)" << std::endl;
         }
-
-        // عرض إحصائيات وتعليمات وسيطة
-        if (!instructions.empty())
+        else if (!options.runProgram && !options.interpretProgram)
         {
-            compiler.displayInstructions();
+            consoleOutput() << "ℹ️  لم يتم توليد أي مخرجات. تحقق من الخيارات المحددة." << std::endl;
         }
 
-        if (generatedAnyOutput)
+        // التشغيل المباشر: رمز خروج البرنامج يصبح رمز خروج المترجم
+        if (options.runProgram)
         {
-            std::cout << "🎉 الترجمة تمت بنجاح!" << std::endl;
-            std::cout << "📊 الملفات الناتجة:" << std::endl;
-            if (generateIr)
-                std::cout << "   - " << baseName << "_intermediate.txt (الكود الوسيط)" << std::endl;
-            if (generateC)
-                std::cout << "   - " << baseName << ".c (كود C)" << std::endl;
-            if (generateAsm)
-                std::cout << "   - " << baseName << ".asm (كود Assembly)" << std::endl;
+            consoleOutput() << "🚀 تشغيل البرنامج:" << std::endl;
+            return compiler.runProgram();
         }
-        else
+        if (options.interpretProgram)
         {
-            std::cout << "ℹ️  لم يتم توليد أي مخرجات. تحقق من الخيارات المحددة." << std::endl;
+            consoleOutput() << "🚀 تفسير البرنامج:" << std::endl;
+            return compiler.interpretProgram();
         }
     }
     catch (const std::exception &e)
     {
-        std::cerr << "❌ خطأ استثنائي: " << e.what() << std::endl;
+        consoleErrors() << "❌ خطأ استثنائي: " << e.what() << std::endl;
         return 1;
     }
 
     return 0;
-}
\ No newline at end of file
+}
+
+// ترجمة عدة ملفات في العملية نفسها: كل ملف مهمة في TaskPool، وما تطبعه
+// ترجمته يُلتقط ثم يُطبع كاملاً بترتيب الملفات في سطر الأوامر، فلا يتغير
+// المخرج بتغير عدد الخيوط أو ترتيب انتهائها
+int compileBatch(const std::vector<std::string> &sources, const Options &options, unsigned jobs)
+{
+    struct Result
+    {
+        std::ostringstream output;
+        std::ostringstream errors;
+        int status = 0;
+        bool done = false;
+    };
+    std::vector<Result> results(sources.size());
+    size_t nextToPrint = 0;
+    size_t failed = 0;
+    std::mutex printing;
+
+    TaskPool pool(jobs);
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        pool.add([&, i]()
+                 {
+                     Result &result = results[i];
+                     {
+                         ConsoleCapture capture(result.output, result.errors);
+                         result.status = compileFile(sources[i], options);
+                     }
+
+                     // طباعة ما اكتمل من أول القائمة وتحرير مخازنه
+                     std::lock_guard<std::mutex> guard(printing);
+                     result.done = true;
+                     while (nextToPrint < results.size() && results[nextToPrint].done)
+                     {
+                         Result &ready = results[nextToPrint++];
+                         std::cout << ready.output.str() << std::flush;
+                         std::cerr << ready.errors.str() << std::flush;
+                         if (ready.status != 0)
+                             ++failed;
+                         ready.output.str(std::string());
+                         ready.errors.str(std::string());
+                     } });
+    }
+    pool.run();
+
+    std::cout << "📊 الترجمة الدفعية: نجحت " << sources.size() - failed << " من " << sources.size()
+              << " ملف" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
+
+// ملف قائمة (@ملف): مسار مصدر في كل سطر، والأسطر الفارغة تُتجاهل
+void readResponseFile(const std::string &listName, std::vector<std::string> &sources)
+{
+    std::ifstream list(listName);
+    if (!list.is_open())
+        throw std::runtime_error("لا يمكن فتح ملف القائمة: " + listName);
+    std::string line;
+    while (std::getline(list, line))
+    {
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+            continue;
+        size_t last = line.find_last_not_of(" \t\r");
+        sources.push_back(line.substr(first, last - first + 1));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+// إعداد الترميز للمخرجات العربية
+#ifdef _WIN32
+    system("chcp 65001 > nul");
+#endif
+
+    if (argc < 2 || (argc >= 2 && std::string(argv[1]) == "--help"))
+    {
+        displayHelp();
+        return 0;
+    }
+
+    Options options;
+    std::vector<std::string> sources;
+    bool batch = false;
+    unsigned jobs = 0;
+    std::string explicitPasses;
+    std::string unrollFactor;
+
+    // معالجة الخيارات: ما لا يبدأ بـ - ملف مصدر، و@ملف قائمة ملفات مصدر
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (option.empty() || (option[0] != '-' && option[0] != '@'))
+            sources.push_back(option);
+        else if (option[0] == '@')
+        {
+            try
+            {
+                readResponseFile(option.substr(1), sources);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "❌ " << e.what() << std::endl;
+                return 1;
+            }
+            batch = true;
+        }
+        else if (option.rfind("-j", 0) == 0)
+        {
+            std::string count = option.substr(2);
+            if (count.size() > 4 || count.find_first_not_of("0123456789") != std::string::npos)
+            {
+                std::cerr << "❌ عدد الخيوط يجب أن يكون عدداً صحيحاً: " << option << std::endl;
+                return 1;
+            }
+            jobs = count.empty() ? 0 : static_cast<unsigned>(std::stoi(count));
+            batch = true;
+        }
+        else if (option == "--asm")
+            options.generateAsm = true;
+        else if (option == "--c")
+            options.generateC = true;
+        else if (option == "--x86-64")
+            options.generateX86 = true;
+        else if (option == "--x86-64-obj")
+            options.generateObject = true;
+        else if (option == "--llvm")
+            options.generateLLVM = true;
+        else if (option == "--run")
+            options.runProgram = true;
+        else if (option == "--interpret")
+            options.interpretProgram = true;
+        else if (option == "--c-structured")
+            options.generateC = options.structuredC = true;
+        else if (option == "--checked-arrays")
+            options.checkedArrays = true;
+        else if (option == "--ir")
+            options.generateIr = true;
+        else if (option == "--all")
+        {
+            options.generateAsm = options.generateC = options.generateIr = options.generateX86 = options.generateObject = options.generateLLVM = true;
+        }
+        else if (option == "--tokens")
+            options.showTokens = true;
+        else if (option == "--ast")
+            options.showAST = true;
+        else if (option == "--debug-lexer")
+            options.debugLexer = true;
+        else if (option == "-O0" || option == "-O1" || option == "-O2")
+            options.passManager.setOptimizationLevel(option[2] - '0');
+        else if (option.rfind("--passes=", 0) == 0)
+            explicitPasses = option.substr(strlen("--passes="));
+        else if (option.rfind("--unroll-factor=", 0) == 0)
+            unrollFactor = option.substr(strlen("--unroll-factor="));
+        else
+        {
+            std::cerr << "❌ خيار غير معروف: " << option << std::endl;
+            displayHelp();
+            return 1;
+        }
+    }
+
+    if (!explicitPasses.empty())
+    {
+        try
+        {
+            options.passManager.setPasses(explicitPasses);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "❌ " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    if (!unrollFactor.empty())
+    {
+        try
+        {
+            if (unrollFactor.size() > 2 || unrollFactor.find_first_not_of("0123456789") != std::string::npos)
+                throw std::runtime_error("معامل فك الحلقات يجب أن يكون عدداً صحيحاً: " + unrollFactor);
+            options.passManager.setUnrollFactor(std::stoi(unrollFactor));
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "❌ " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    // إذا لم يتم تحديد أي خيار، استخدم الافتراضي
+    if (!options.generateAsm && !options.generateC && !options.generateIr && !options.generateX86 && !options.generateObject && !options.generateLLVM && !options.runProgram && !options.interpretProgram && !options.showTokens && !options.showAST)
+    {
+        options.generateAsm = true; // الافتراضي: توليد كود التجميع
+    }
+
+    if (sources.empty())
+    {
+        std::cerr << "❌ لم يُحدد ملف مصدر" << std::endl;
+        displayHelp();
+        return 1;
+    }
+
+    if (!batch && sources.size() == 1)
+        return compileFile(sources[0], options);
+
+    // البرامج تُشغل في العملية نفسها وتكتب إلى stdout مباشرة، فلا تُشغل دفعياً
+    if (options.runProgram || options.interpretProgram)
+    {
+        std::cerr << "❌ --run و--interpret لا يعملان مع الترجمة الدفعية" << std::endl;
+        return 1;
+    }
+    options.emitterThreads = 1;
+    return compileBatch(sources, options, jobs);
+}
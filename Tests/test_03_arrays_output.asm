@@ -2,19 +2,7 @@
 # =============================
 
 .data
-أرقام: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
-t3: .word 0
-t4: .word 0
-t5: .word 0
-t6: .word 0
-t7: .word 0
-t8: .word 0
-t9: .word 0
-t10: .word 0
-t11: .word 0
+أرقام: .space 20
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -23,43 +11,45 @@ str_format: .asciiz "%s"
 .globl main
 main:
     li $t0, 10
-    sw $t0, t0
-    li $t0, 0
-    sw $t0, t1
-    # STORE_INDEXED أرقام[t1], t0
+    li $t1, 0
+    sll $t9, $t1, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 20
-    sw $t0, t2
-    li $t0, 1
-    sw $t0, t3
-    # STORE_INDEXED أرقام[t3], t2
+    li $t2, 1
+    sll $t9, $t2, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 30
-    sw $t0, t4
-    li $t0, 2
-    sw $t0, t5
-    # STORE_INDEXED أرقام[t5], t4
-    li $t0, 0
-    sw $t0, t6
-    # LOAD_INDEXED t7, أرقام[t6]
+    li $t3, 2
+    sll $t9, $t3, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    sll $t9, $t1, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    lw $t3, 0($t9)
     li $v0, 1
-    lw $a0, t7
+    move $a0, $t3
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 1
-    sw $t0, t8
-    # LOAD_INDEXED t9, أرقام[t8]
+    sll $t9, $t2, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    lw $t1, 0($t9)
     li $v0, 1
-    lw $a0, t9
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 2
-    sw $t0, t10
-    # LOAD_INDEXED t11, أرقام[t10]
     li $v0, 1
-    lw $a0, t11
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
@@ -2,10 +2,8 @@
 # =============================
 
 .data
-موظف: .word 0
-الشخص: .word 0
-t0: .word 0
-t1: .word 0
+موظف: .space 8
+الشخص: .space 8
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -15,21 +13,17 @@ str_0: .asciiz "أحمد"
 .globl main
 main:
     la $t0, str_0
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, موظف.الاسم
+    sw $t0, موظف
     li $t0, 30
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, موظف.العمر
+    sw $t0, موظف+4
     li $v0, 1
-    lw $a0, موظف.الاسم
+    lw $a0, موظف
     syscall
     li $v0, 4
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, موظف.العمر
+    lw $a0, موظف+4
     syscall
     li $v0, 4
     la $a0, newline
@@ -10,8 +10,9 @@ str_format: .asciiz "%s"
 .text
 .globl main
 main:
+    move $t0, $zero
     li $v0, 1
-    lw $a0, رقم_صحيح
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
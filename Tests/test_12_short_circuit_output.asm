@@ -0,0 +1,95 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ع: .word 0
+أرقام: .space 12
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "التقييم المختصر:"
+str_1: .asciiz "داخل المجال"
+str_2: .asciiz "خارج المجال"
+str_3: .asciiz "العنصر الأخير"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 5
+    li $t1, 0
+    sll $t9, $t1, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    li $t0, 10
+    li $t2, 1
+    sll $t9, $t2, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    li $t0, 15
+    li $t2, 2
+    sll $t9, $t2, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    li $t3, 7
+    move $t4, $t3
+    li $t5, 3
+    # CMP t6, t8
+    bge $t3, $t5, L0
+    sll $t9, $t3, 2
+    la $t8, أرقام
+    addu $t9, $t9, $t8
+    lw $t6, 0($t9)
+    # CMP t10, t1
+    ble $t6, $t1, L0
+    li $v0, 4
+    la $a0, str_1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    j L1
+    L0:
+    li $v0, 4
+    la $a0, str_2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    L1:
+    move $t4, $t2
+    # CMP t5, t8
+    bge $t2, $t5, L4
+    # CMP t4, t4
+    bne $t0, $t0, L2
+    L4:
+    li $v0, 4
+    la $a0, str_3
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    L2:
+    li $t0, 0
+    # CMP t5, t1
+    ble $t2, $t1, L5
+    # CMP t5, t8
+    bge $t2, $t5, L5
+    li $t0, 1
+    L5:
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
@@ -0,0 +1,63 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ن: .word 0
+م: .word 0
+ك: .word 0
+ع: .word 0
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "نقل الثوابت خارج الحلقات:"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t0, 4
+    move $t2, $t0
+    li $t2, 1
+    move $t3, $t2
+    # CMP t2, t1
+    bgt $t2, $t0, L1
+    li $t4, 2
+    mul $t5, $t0, $t4
+    li $t6, 3
+    mul $t7, $t0, $t6
+    L0:
+    move $t6, $t3
+    move $s0, $t6
+    move $s1, $t6
+    # CMP t5, t9
+    bgt $t6, $t5, L3
+    L2:
+    move $s2, $t1
+    add $s3, $s2, $t7
+    move $t1, $s3
+    move $s1, $s0
+    add $s2, $s1, $t4
+    move $s0, $s2
+    # CMP t16, t9
+    ble $s2, $t5, L2
+    L3:
+    add $s0, $t6, $t2
+    move $t3, $s0
+    # CMP t21, t1
+    ble $s0, $t0, L0
+    L1:
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
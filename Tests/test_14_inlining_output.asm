@@ -0,0 +1,101 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ضاعف_أ: .word 0
+م: .word 0
+اجمع_ب: .word 0
+ع: .word 0
+س: .word 0
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+str_1: .asciiz "ضاعف"
+str_2: .asciiz "اجمع"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 5
+    move $t1, $t0
+    li $t2, 0
+    move $t3, $t2
+    move $t4, $t0
+    li $v0, 4
+    la $a0, str_1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t5, 2
+    mul $t6, $t0, $t5
+    move $t3, $t6
+    move $t4, $t2
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 1
+    move $a0, $t3
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t0, $t2
+    li $t3, 1
+    move $t1, $t3
+    li $t4, 4
+    # CMP t8, t10
+    bgt $t3, $t4, L2
+    L1:
+    move $t5, $t1
+    move $t6, $t5
+    li $v0, 4
+    la $a0, str_2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    # CMP t11, t1
+    blt $t5, $t2, L3
+    move $t7, $t0
+    add $s0, $t7, $t5
+    move $t0, $s0
+    L3:
+    add $t7, $t5, $t3
+    move $t1, $t7
+    # CMP t18, t10
+    ble $t7, $t4, L1
+    L2:
+    li $t1, 7
+    sub $t3, $t2, $t1
+    move $t6, $t3
+    li $v0, 4
+    la $a0, str_2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    # CMP t22, t1
+    blt $t3, $t2, L6
+    move $t1, $t0
+    add $t2, $t1, $t3
+    move $t0, $t2
+    L6:
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
@@ -0,0 +1,175 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+خمسة_ه: .word 0
+خمسة_د: .word 0
+خمسة_ب: .word 0
+خمسة_أ: .word 0
+خمسة_ج: .word 0
+ح: .word 0
+ن: .word 0
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 6
+    move $a0, $t0
+    la $a1, ن
+    jal proc_مضروب
+    li $v0, 1
+    lw $a0, ن
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 10
+    move $a0, $t0
+    la $a1, ح
+    jal proc_فيبو
+    li $v0, 1
+    lw $a0, ح
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 1
+    move $t1, $t0
+    li $t0, 2
+    move $t2, $t0
+    li $t0, 3
+    move $t3, $t0
+    li $t0, 4
+    move $t4, $t0
+    li $t0, 5
+    move $t5, $t0
+    move $t5, $t1
+    move $t1, $t2
+    li $t2, 10
+    mul $t6, $t1, $t2
+    add $t1, $t5, $t6
+    move $t2, $t3
+    li $t3, 100
+    mul $t5, $t2, $t3
+    add $t2, $t1, $t5
+    move $t1, $t4
+    li $t3, 1000
+    mul $t4, $t1, $t3
+    add $t1, $t2, $t4
+    li $t2, 10000
+    mul $t3, $t0, $t2
+    add $t2, $t1, $t3
+    sw $t2, ن
+    li $v0, 1
+    lw $a0, ن
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $a0, $t0
+    la $a1, ح
+    jal proc_مضروب
+    li $v0, 1
+    lw $a0, ح
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
+    proc_مضروب:
+    addiu $sp, $sp, -32
+    sw $ra, 28($sp)
+    sw $fp, 24($sp)
+    move $fp, $sp
+    sw $t0, 8($fp)
+    sw $t1, 12($fp)
+    sw $t2, 16($fp)
+    sw $t3, 20($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    sw $zero, 4($fp)
+    move $t1, $t0
+    li $t2, 1
+    # CMP t25, t26
+    bgt $t1, $t2, L2
+    lw $t9, 0($fp)
+    sw $t2, 0($t9)
+    j end_proc_مضروب
+    L2:
+    sub $t3, $t1, $t2
+    move $a0, $t3
+    addiu $a1, $fp, 4
+    jal proc_مضروب
+    lw $t1, 4($fp)
+    move $t2, $t0
+    mul $t0, $t1, $t2
+    lw $t9, 0($fp)
+    sw $t0, 0($t9)
+    end_proc_مضروب:
+    lw $t0, 8($fp)
+    lw $t1, 12($fp)
+    lw $t2, 16($fp)
+    lw $t3, 20($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    jr $ra
+    proc_فيبو:
+    addiu $sp, $sp, -40
+    sw $ra, 36($sp)
+    sw $fp, 32($sp)
+    move $fp, $sp
+    sw $t0, 12($fp)
+    sw $t1, 16($fp)
+    sw $t2, 20($fp)
+    sw $t3, 24($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    sw $zero, 4($fp)
+    sw $zero, 8($fp)
+    move $t1, $t0
+    li $t2, 2
+    # CMP t34, t35
+    bge $t1, $t2, L4
+    lw $t9, 0($fp)
+    sw $t1, 0($t9)
+    j end_proc_فيبو
+    L4:
+    li $t2, 1
+    sub $t3, $t1, $t2
+    move $a0, $t3
+    addiu $a1, $fp, 4
+    jal proc_فيبو
+    move $t1, $t0
+    li $t0, 2
+    sub $t2, $t1, $t0
+    move $a0, $t2
+    addiu $a1, $fp, 8
+    jal proc_فيبو
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    add $t2, $t0, $t1
+    lw $t9, 0($fp)
+    sw $t2, 0($t9)
+    end_proc_فيبو:
+    lw $t0, 12($fp)
+    lw $t1, 16($fp)
+    lw $t2, 20($fp)
+    lw $t3, 24($fp)
+    move $sp, $fp
+    lw $ra, 36($sp)
+    lw $fp, 32($sp)
+    addiu $sp, $sp, 40
+    jr $ra
@@ -0,0 +1,345 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ق: .word 0
+ن: .word 0
+زوج: .space 8
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 1071
+    li $t1, 462
+    move $a0, $t0
+    move $a1, $t1
+    la $a2, ن
+    jal proc_قاسم
+    li $v0, 1
+    lw $a0, ن
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 1
+    sw $t0, ق
+    li $t0, 10
+    move $a0, $t0
+    la $a1, ق
+    jal proc_مضروب
+    li $v0, 1
+    lw $a0, ق
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    sw $t0, ن
+    li $t0, 100000
+    move $a0, $t0
+    la $a1, ن
+    jal proc_عد
+    li $v0, 1
+    lw $a0, ن
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 4
+    move $a0, $t0
+    jal proc_تراكم
+    li $v0, 10
+    syscall
+    proc_قاسم:
+    addiu $sp, $sp, -40
+    sw $ra, 36($sp)
+    sw $fp, 32($sp)
+    move $fp, $sp
+    sw $t0, 4($fp)
+    sw $t1, 8($fp)
+    sw $t2, 12($fp)
+    sw $t3, 16($fp)
+    sw $t4, 20($fp)
+    sw $t5, 24($fp)
+    move $t0, $a0
+    move $t1, $a1
+    sw $a2, 0($fp)
+    move $t3, $zero
+    L10:
+    move $t2, $t1
+    li $t3, 0
+    # CMP t7, t8
+    bne $t2, $t3, L0
+    move $t3, $t0
+    lw $t9, 0($fp)
+    sw $t3, 0($t9)
+    j end_proc_قاسم
+    L0:
+    move $t3, $t0
+    div $t4, $t3, $t2
+    mul $t5, $t4, $t2
+    sub $t2, $t3, $t5
+    move $t3, $t2
+    move $t4, $t1
+    move $t0, $t4
+    move $t1, $t2
+    li $t3, 0
+    j L10
+    end_proc_قاسم:
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    lw $t4, 20($fp)
+    lw $t5, 24($fp)
+    move $sp, $fp
+    lw $ra, 36($sp)
+    lw $fp, 32($sp)
+    addiu $sp, $sp, 40
+    jr $ra
+    proc_مضروب:
+    addiu $sp, $sp, -32
+    sw $ra, 28($sp)
+    sw $fp, 24($sp)
+    move $fp, $sp
+    sw $t0, 4($fp)
+    sw $t1, 8($fp)
+    sw $t2, 12($fp)
+    sw $t3, 16($fp)
+    sw $t4, 20($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    L11:
+    move $t1, $t0
+    li $t2, 1
+    # CMP t19, t20
+    ble $t1, $t2, end_proc_مضروب
+    L2:
+    lw $t3, 0($fp)
+    lw $t3, 0($t3)
+    mul $t4, $t3, $t1
+    lw $t9, 0($fp)
+    sw $t4, 0($t9)
+    move $t1, $t0
+    sub $t3, $t1, $t2
+    move $t0, $t3
+    j L11
+    end_proc_مضروب:
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    lw $t4, 20($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    jr $ra
+    proc_عد:
+    addiu $sp, $sp, -32
+    sw $ra, 28($sp)
+    sw $fp, 24($sp)
+    move $fp, $sp
+    sw $t0, 4($fp)
+    sw $t1, 8($fp)
+    sw $t2, 12($fp)
+    sw $t3, 16($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    move $t1, $t0
+    li $t2, 0
+    # CMP t27, t28
+    ble $t1, $t2, L4
+    lw $t1, 0($fp)
+    lw $t1, 0($t1)
+    li $t2, 1
+    add $t3, $t1, $t2
+    lw $t9, 0($fp)
+    sw $t3, 0($t9)
+    move $t1, $t0
+    sub $t0, $t1, $t2
+    move $a0, $t0
+    lw $a1, 0($fp)
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    j proc_زوجي
+    L4:
+    end_proc_عد:
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    jr $ra
+    proc_تراكم:
+    addiu $sp, $sp, -104
+    sw $ra, 100($sp)
+    sw $fp, 96($sp)
+    move $fp, $sp
+    sw $t0, 68($fp)
+    sw $t1, 72($fp)
+    sw $t2, 76($fp)
+    sw $t3, 80($fp)
+    sw $t4, 84($fp)
+    sw $t5, 88($fp)
+    sw $t6, 92($fp)
+    move $t0, $a0
+    sw $zero, 0($fp)
+    sw $zero, 4($fp)
+    sw $zero, 8($fp)
+    addiu $t8, $fp, 12
+    addiu $t9, $t8, 48
+    clear_proc_تراكم_12:
+    sw $zero, 0($t8)
+    addiu $t8, $t8, 4
+    bne $t8, $t9, clear_proc_تراكم_12
+    sw $zero, 60($fp)
+    sw $zero, 64($fp)
+    L12:
+    li $t1, 0
+    sll $t9, $t1, 2
+    addu $t9, $t9, $fp
+    lw $t2, 0($t9)
+    li $t3, 11
+    sll $t9, $t3, 2
+    addu $t9, $t9, $fp
+    lw $t4, 12($t9)
+    add $t5, $t2, $t4
+    lw $t4, 60($fp)
+    add $t6, $t5, $t4
+    li $v0, 1
+    move $a0, $t6
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t4, 5
+    add $t5, $t2, $t4
+    sll $t9, $t1, 2
+    addu $t9, $t9, $fp
+    sw $t5, 0($t9)
+    sll $t9, $t3, 2
+    addu $t9, $t9, $fp
+    lw $t1, 12($t9)
+    li $t2, 6
+    add $t4, $t1, $t2
+    sll $t9, $t3, 2
+    addu $t9, $t9, $fp
+    sw $t4, 12($t9)
+    lw $t1, 60($fp)
+    li $t2, 7
+    add $t3, $t1, $t2
+    sw $t3, 60($fp)
+    move $t1, $t0
+    li $t2, 1
+    # CMP t55, t56
+    ble $t1, $t2, L6
+    sub $t3, $t1, $t2
+    move $t0, $t3
+    li $t1, 0
+    li $t2, 0
+    sll $t9, $t2, 2
+    addu $t9, $t9, $fp
+    sw $t1, 0($t9)
+    li $t2, 1
+    sll $t9, $t2, 2
+    addu $t9, $t9, $fp
+    sw $t1, 0($t9)
+    li $t2, 2
+    sll $t9, $t2, 2
+    addu $t9, $t9, $fp
+    sw $t1, 0($t9)
+    li $t1, 0
+    li $t2, 0
+    L13:
+    sll $t9, $t2, 2
+    addu $t9, $t9, $fp
+    sw $t1, 12($t9)
+    li $t3, 1
+    add $t4, $t2, $t3
+    move $t2, $t4
+    li $t3, 12
+    # CMP t75, t76
+    blt $t4, $t3, L13
+    li $t1, 0
+    sw $t1, 60($fp)
+    j L12
+    L6:
+    end_proc_تراكم:
+    lw $t0, 68($fp)
+    lw $t1, 72($fp)
+    lw $t2, 76($fp)
+    lw $t3, 80($fp)
+    lw $t4, 84($fp)
+    lw $t5, 88($fp)
+    lw $t6, 92($fp)
+    move $sp, $fp
+    lw $ra, 100($sp)
+    lw $fp, 96($sp)
+    addiu $sp, $sp, 104
+    jr $ra
+    proc_زوجي:
+    addiu $sp, $sp, -32
+    sw $ra, 28($sp)
+    sw $fp, 24($sp)
+    move $fp, $sp
+    sw $t0, 4($fp)
+    sw $t1, 8($fp)
+    sw $t2, 12($fp)
+    sw $t3, 16($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    move $t1, $t0
+    li $t2, 0
+    # CMP t60, t61
+    ble $t1, $t2, L8
+    lw $t1, 0($fp)
+    lw $t1, 0($t1)
+    li $t2, 2
+    add $t3, $t1, $t2
+    lw $t9, 0($fp)
+    sw $t3, 0($t9)
+    move $t1, $t0
+    li $t0, 1
+    sub $t2, $t1, $t0
+    move $a0, $t2
+    lw $a1, 0($fp)
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    j proc_عد
+    L8:
+    end_proc_زوجي:
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    lw $t3, 16($fp)
+    move $sp, $fp
+    lw $ra, 28($sp)
+    lw $fp, 24($sp)
+    addiu $sp, $sp, 32
+    jr $ra
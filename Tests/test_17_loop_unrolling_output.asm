@@ -0,0 +1,144 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+س: .word 0
+ع: .word 0
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 1
+    move $t3, $t2
+    mul $t4, $t3, $t3
+    add $t3, $t0, $t4
+    move $t1, $t3
+    li $t2, 2
+    move $t4, $t2
+    mul $t5, $t4, $t4
+    add $t4, $t3, $t5
+    move $t1, $t4
+    li $t2, 3
+    move $t3, $t2
+    mul $t5, $t3, $t3
+    add $t6, $t4, $t5
+    move $t1, $t6
+    li $t2, 4
+    move $t4, $t2
+    mul $t5, $t4, $t4
+    add $t4, $t6, $t5
+    move $t1, $t4
+    li $t2, 5
+    move $t5, $t2
+    mul $t6, $t5, $t5
+    add $t5, $t4, $t6
+    move $t1, $t5
+    li $t2, 6
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t1, $t0
+    li $t2, 1
+    L0:
+    move $t4, $t1
+    move $t5, $t2
+    add $t6, $t4, $t5
+    move $t1, $t6
+    li $t9, 1
+    add $t4, $t5, $t9
+    move $t2, $t4
+    add $t5, $t6, $t4
+    move $t1, $t5
+    li $t9, 1
+    add $t6, $t4, $t9
+    move $t2, $t6
+    add $t4, $t5, $t6
+    move $t1, $t4
+    li $t9, 1
+    add $t5, $t6, $t9
+    move $t2, $t5
+    add $t6, $t4, $t5
+    move $t1, $t6
+    li $t9, 1
+    add $t4, $t5, $t9
+    move $t2, $t4
+    # CMP t46, 49
+    li $t9, 49
+    blt $t4, $t9, L0
+    add $t5, $t6, $t4
+    move $t1, $t5
+    li $t9, 1
+    add $t6, $t4, $t9
+    move $t2, $t6
+    add $t4, $t5, $t6
+    move $t1, $t4
+    li $t9, 1
+    add $t4, $t6, $t9
+    move $t2, $t4
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t1, $t0
+    li $t2, -3
+    move $t4, $t2
+    add $t5, $t0, $t4
+    move $t1, $t5
+    li $t2, 0
+    add $t4, $t5, $t0
+    move $t1, $t4
+    li $t2, 3
+    add $t0, $t4, $t3
+    move $t1, $t0
+    li $t2, 6
+    move $t3, $t2
+    add $t4, $t0, $t3
+    move $t1, $t4
+    li $t2, 9
+    move $t0, $t2
+    add $t3, $t4, $t0
+    move $t1, $t3
+    li $t2, 12
+    move $t0, $t2
+    add $t4, $t3, $t0
+    move $t1, $t4
+    li $t2, 15
+    move $t0, $t2
+    add $t3, $t4, $t0
+    move $t1, $t3
+    li $t2, 18
+    move $t0, $t2
+    add $t4, $t3, $t0
+    move $t1, $t4
+    li $t2, 21
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 1
+    move $a0, $t2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
@@ -0,0 +1,45 @@
+// كود C مهيكل مولد للغة العربية
+// =============================
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main()
+{
+    int أ[100] = {0};
+    int ب[100] = {0};
+    int ع = 0;
+    int م = 0;
+    printf("%s\n", "بدء");
+    for (ع = 0; ع <= 99; ع++)
+    {
+        أ[ع] = ع * 2;
+        ب[ع] = ع + 1;
+    }
+    for (ع = 0; ع <= 99; ع++)
+    {
+        أ[ع] = أ[ع] + ب[ع];
+    }
+    م = 0;
+    ع = 0;
+    while (ع < 100)
+    {
+        if (أ[ع] > 100)
+        {
+            م = م + أ[ع];
+        }
+        else
+        {
+            م = م - 1;
+        }
+        ع = ع + 1;
+    }
+    printf("%d\n", م);
+    do
+    {
+        printf("%d\n", ع);
+        ع = ع - 40;
+    } while (!(ع < 0));
+    printf("%d\n", ع);
+    return 0;
+}
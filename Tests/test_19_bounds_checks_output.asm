@@ -0,0 +1,166 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+م: .word 0
+ع: .word 0
+ن: .word 0
+أ: .space 40
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+bounds_message: .asciiz "خطأ وقت التنفيذ: فهرس خارج حدود القائمة"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 9
+    # CMP t0, t2
+    bgt $t0, $t2, L1
+    li $t3, 1
+    move $t4, $t1
+    li $t9, 3
+    mul $t5, $t4, $t9
+    L0:
+    move $t4, $t1
+    move $t6, $t5
+    sll $t9, $t4, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    sw $t6, 0($t9)
+    add $t6, $t4, $t3
+    move $t1, $t6
+    li $t9, 3
+    add $t5, $t5, $t9
+    # CMP t8, t2
+    ble $t6, $t2, L0
+    L1:
+    li $t3, 8
+    move $t4, $t3
+    move $t4, $t0
+    li $t5, 1
+    move $t1, $t5
+    # CMP t12, t10
+    bgt $t5, $t3, L3
+    li $t9, 1
+    add $t6, $t5, $t9
+    sltiu $t9, $t6, 10
+    beqz $t9, bounds_error
+    li $t9, 1
+    add $t6, $t3, $t9
+    sltiu $t9, $t6, 10
+    beqz $t9, bounds_error
+    li $t9, 1
+    sub $t6, $t5, $t9
+    sltiu $t9, $t6, 10
+    beqz $t9, bounds_error
+    li $t9, 1
+    sub $t6, $t3, $t9
+    sltiu $t9, $t6, 10
+    beqz $t9, bounds_error
+    L2:
+    move $t6, $t4
+    move $t7, $t1
+    add $s0, $t7, $t5
+    sll $t9, $s0, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $s1, 0($t9)
+    add $s2, $t6, $s1
+    sub $t6, $t7, $t5
+    sll $t9, $t6, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $t7, 0($t9)
+    sub $t6, $s2, $t7
+    move $t4, $t6
+    move $t1, $s0
+    # CMP t22, t10
+    ble $s0, $t3, L2
+    L3:
+    li $v0, 1
+    move $a0, $t4
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t1, $t0
+    li $t6, 10
+    # CMP t0, t35
+    bge $t0, $t6, L5
+    L4:
+    move $t0, $t4
+    move $t7, $t1
+    sltiu $t9, $t7, 10
+    beqz $t9, bounds_error
+    sll $t9, $t7, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $s0, 0($t9)
+    add $s1, $t0, $s0
+    move $t4, $s1
+    add $t0, $t7, $t5
+    move $t1, $t0
+    # CMP t42, t35
+    blt $t0, $t6, L4
+    L5:
+    li $v0, 1
+    move $a0, $t4
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 7
+    move $t1, $t0
+    # CMP t45, t10
+    bgt $t0, $t3, L7
+    L6:
+    move $t0, $t1
+    add $t4, $t0, $t5
+    sltiu $t9, $t4, 10
+    beqz $t9, bounds_error
+    sll $t9, $t4, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $t0, 0($t9)
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t1, $t4
+    # CMP t50, t10
+    ble $t4, $t3, L6
+    L7:
+    sll $t9, $t2, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $t0, 0($t9)
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
+    bounds_error:
+    li $v0, 4
+    la $a0, bounds_message
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 17
+    li $a0, 1
+    syscall
@@ -0,0 +1,96 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ع: .word 0
+ص: .word 0
+س: .word 0
+أ: .space 40
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 9
+    # CMP t0, t2
+    bgt $t0, $t2, L1
+    li $t0, 1
+    L0:
+    move $t3, $t1
+    add $t4, $t3, $t0
+    sll $t9, $t3, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    sw $t4, 0($t9)
+    move $t1, $t4
+    # CMP t5, t2
+    ble $t4, $t2, L0
+    L1:
+    li $t0, 6
+    move $t1, $t0
+    sll $t9, $t0, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $t1, 0($t9)
+    add $t2, $t1, $t1
+    move $t1, $t2
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    mul $t2, $t0, $t0
+    sub $t3, $t2, $t2
+    move $t1, $t3
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t3, 2
+    add $t4, $t0, $t3
+    mul $t3, $t4, $t4
+    move $t1, $t3
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t3, 3
+    # CMP t10, t31
+    ble $t0, $t3, L2
+    mul $t0, $t4, $t3
+    move $t1, $t0
+    j L3
+    L2:
+    move $t1, $t2
+    L3:
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t1, $t2
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
@@ -0,0 +1,85 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+صنف_ك: .word 0
+ع: .word 0
+ص: .word 0
+س: .word 0
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 5
+    li $t3, 0
+    sub $t3, $t0, $t2
+    move $t2, $t3
+    li $t4, 200
+    # CMP t2, t4
+    bge $t3, $t4, L1
+    li $t3, 1
+    li $t5, 100
+    li $t6, 2
+    li $t7, 1
+    li $s0, 2
+    li $s1, 150
+    li $s2, 10
+    li $s3, 50
+    L0:
+    move $s4, $t2
+    move $s5, $s4
+    # CMP t5, t0
+    bge $s4, $t0, L3
+    li $s5, 0
+    sub $s5, $t0, $t3
+    move $s6, $s5
+    j L8
+    L3:
+    # CMP t5, t0
+    bne $s4, $t0, L5
+    move $s6, $t0
+    j L8
+    L5:
+    # CMP t5, t14
+    ble $s4, $t5, L7
+    move $s6, $t6
+    j L8
+    L7:
+    move $s6, $t7
+    L8:
+    move $s5, $t1
+    move $s7, $s6
+    add $s6, $s5, $s7
+    move $t1, $s6
+    # CMP t18, t21
+    bne $s7, $s0, L11
+    # CMP t5, t23
+    ble $s4, $s1, L11
+    add $s5, $s6, $s2
+    move $t1, $s5
+    L11:
+    add $s5, $s4, $s3
+    move $t2, $s5
+    # CMP t29, t4
+    blt $s5, $t4, L0
+    L1:
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
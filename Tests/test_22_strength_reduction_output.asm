@@ -0,0 +1,179 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+س: .word 0
+ع: .word 0
+أ: .space 160
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 1
+    move $t3, $t2
+    li $t4, 39
+    # CMP t1, t3
+    bgt $t2, $t4, L1
+    li $t2, 2
+    move $t5, $t3
+    sll $t6, $t5, 2
+    li $t9, 12
+    mul $t7, $t5, $t9
+    L0:
+    move $t5, $t3
+    move $s0, $t6
+    sll $t9, $t5, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    sw $s0, 0($t9)
+    move $s1, $t1
+    move $s2, $t7
+    add $s3, $s1, $s2
+    add $s1, $s3, $s0
+    move $t1, $s1
+    add $s0, $t5, $t2
+    move $t3, $s0
+    li $t9, 8
+    add $t6, $t6, $t9
+    li $t9, 24
+    add $t7, $t7, $t9
+    # CMP t18, t3
+    ble $s0, $t4, L0
+    L1:
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    sll $t9, $t4, 2
+    la $t8, أ
+    addu $t9, $t9, $t8
+    lw $t2, 0($t9)
+    li $v0, 1
+    move $a0, $t2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t3, $t0
+    move $t1, $t0
+    li $t2, 100
+    # CMP t0, t25
+    bge $t0, $t2, L3
+    li $t4, 3
+    move $t5, $t3
+    li $t9, 7
+    mul $t6, $t5, $t9
+    L2:
+    move $t5, $t1
+    move $t7, $t3
+    move $s0, $t6
+    add $s1, $t5, $s0
+    move $t1, $s1
+    add $t5, $t7, $t4
+    move $t3, $t5
+    li $t9, 21
+    add $t6, $t6, $t9
+    # CMP t33, t25
+    blt $t5, $t2, L2
+    L3:
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t2, $t3
+    sra $t3, $t2, 31
+    srl $t4, $t3, 29
+    add $t3, $t2, $t4
+    li $t9, -8
+    and $t4, $t3, $t9
+    sub $t3, $t2, $t4
+    li $v0, 1
+    move $a0, $t3
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t2, 1234567
+    li $t3, 0
+    sub $t3, $t0, $t2
+    move $t1, $t3
+    sra $t0, $t3, 31
+    srl $t1, $t0, 29
+    add $t0, $t3, $t1
+    sra $t1, $t0, 3
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t9, 1717986919
+    mult $t3, $t9
+    mfhi $t0
+    sra $t1, $t0, 2
+    srl $t0, $t3, 31
+    add $t2, $t1, $t0
+    li $v0, 1
+    move $a0, $t2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t9, 1717986919
+    mult $t3, $t9
+    mfhi $t0
+    sra $t1, $t0, 2
+    srl $t0, $t3, 31
+    add $t2, $t1, $t0
+    li $t9, 10
+    mul $t0, $t2, $t9
+    sub $t1, $t3, $t0
+    li $v0, 1
+    move $a0, $t1
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t9, -1840700269
+    mult $t3, $t9
+    mfhi $t0
+    add $t1, $t0, $t3
+    sra $t0, $t1, 2
+    srl $t1, $t3, 31
+    add $t2, $t0, $t1
+    li $v0, 1
+    move $a0, $t2
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    sra $t0, $t3, 31
+    srl $t1, $t0, 28
+    add $t0, $t3, $t1
+    li $t9, -16
+    and $t1, $t0, $t9
+    sub $t0, $t3, $t1
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
@@ -0,0 +1,255 @@
+# كود تجميعي x86-64 مولد للغة العربية (GNU as, System V)
+# للبناء: gcc <الملف>.s -o <البرنامج>
+# =======================================================
+
+    .section .rodata
+int_format: .string "%d\n"
+str_format: .string "%s\n"
+read_format: .string "%d"
+str_0: .string "بدء"
+
+    .bss
+    .align 8
+var_0: .zero 8    # ثمانية_أ
+var_1: .zero 8    # ثمانية_ب
+var_2: .zero 8    # ثمانية_ج
+var_3: .zero 8    # ثمانية_د
+var_4: .zero 8    # ثمانية_ز
+var_5: .zero 8    # ثمانية_ه
+var_6: .zero 8    # ثمانية_و
+var_7: .zero 64    # جدول
+var_8: .zero 8    # ع
+var_9: .zero 8    # مجموع_مربعات_ك
+var_10: .zero 8    # مجموع_مربعات_م
+var_11: .zero 80    # مجموع_مربعات_مربعات
+var_12: .zero 8    # مجموع_مربعات_مربعات_مسح
+var_13: .zero 8    # ن
+temp_0: .zero 8
+temp_1: .zero 8
+temp_2: .zero 8
+temp_3: .zero 8
+temp_4: .zero 8
+
+    .text
+    .globl main
+    .type main, @function
+main:
+    pushq %rbp
+    movq %rsp, %rbp
+    leaq str_0(%rip), %rdi
+    call rt_print_string
+    movq $1, %rbx
+    movq %rbx, %r12
+    movq $2, %r12
+    movq %r12, %r13
+    movq $3, %r13
+    movq %r13, %r14
+    movq $4, temp_0(%rip)
+    movq temp_0(%rip), %r15
+    movq $5, temp_1(%rip)
+    movq temp_1(%rip), %rax
+    movq %rax, var_5(%rip)
+    movq $6, temp_2(%rip)
+    movq temp_2(%rip), %rax
+    movq %rax, var_6(%rip)
+    movq $7, %r15
+    movq %r15, var_4(%rip)
+    movl %r12d, %eax
+    imull %r12d, %eax
+    movl %eax, temp_3(%rip)
+    movl %ebx, %r12d
+    addl temp_3(%rip), %r12d
+    movl %r13d, %eax
+    imull %r13d, %eax
+    movl %eax, temp_3(%rip)
+    movl %r12d, %r13d
+    addl temp_3(%rip), %r13d
+    movl temp_0(%rip), %r12d
+    imull temp_0(%rip), %r12d
+    movl %r13d, %eax
+    addl %r12d, %eax
+    movl %eax, temp_3(%rip)
+    movl temp_1(%rip), %r12d
+    imull temp_1(%rip), %r12d
+    movl temp_3(%rip), %r13d
+    addl %r12d, %r13d
+    movl temp_2(%rip), %r12d
+    imull temp_2(%rip), %r12d
+    movl %r13d, %eax
+    addl %r12d, %eax
+    movl %eax, temp_1(%rip)
+    movl %r15d, %r12d
+    imull %r15d, %r12d
+    movl temp_1(%rip), %r13d
+    addl %r12d, %r13d
+    movq %r13, var_13(%rip)
+    movl var_13(%rip), %edi
+    call rt_print_int
+    movq $10, temp_1(%rip)
+    movq temp_1(%rip), %rax
+    movq %rax, var_9(%rip)
+    movq $0, temp_2(%rip)
+    movq temp_2(%rip), %rax
+    movq %rax, var_12(%rip)
+.L2:
+    movq var_12(%rip), %r13
+    leaq var_11(%rip), %r10
+    movslq %r13d, %rcx
+    movq temp_2(%rip), %rax
+    movq %rax, (%r10,%rcx,8)
+    movl %r13d, %r14d
+    addl %ebx, %r14d
+    movq %r14, var_12(%rip)
+    cmpl temp_1(%rip), %r14d
+    jl .L2
+    movq temp_2(%rip), %r13
+    movl temp_1(%rip), %eax
+    subl %ebx, %eax
+    movl %eax, temp_3(%rip)
+    movl temp_2(%rip), %eax
+    cmpl temp_3(%rip), %eax
+    jg .L4
+.L3:
+    movq %r13, %r14
+    movl %r14d, %eax
+    imull %r14d, %eax
+    movl %eax, temp_1(%rip)
+    leaq var_11(%rip), %r10
+    movslq %r14d, %rcx
+    movq temp_1(%rip), %rax
+    movq %rax, (%r10,%rcx,8)
+    movl %r14d, %r12d
+    addl %ebx, %r12d
+    movq %r12, %r13
+    cmpl temp_3(%rip), %r12d
+    jle .L3
+.L4:
+    movq temp_2(%rip), %rax
+    movq %rax, var_13(%rip)
+    movq temp_2(%rip), %r13
+    movl temp_2(%rip), %eax
+    cmpl temp_3(%rip), %eax
+    jg .L6
+.L5:
+    movq var_13(%rip), %r12
+    movq %r13, %r14
+    leaq var_11(%rip), %r10
+    movslq %r14d, %rcx
+    movq (%r10,%rcx,8), %rax
+    movq %rax, temp_1(%rip)
+    movl %r12d, %eax
+    addl temp_1(%rip), %eax
+    movl %eax, temp_4(%rip)
+    movq temp_4(%rip), %rax
+    movq %rax, var_13(%rip)
+    movl %r14d, %r12d
+    addl %ebx, %r12d
+    movq %r12, %r13
+    cmpl temp_3(%rip), %r12d
+    jle .L5
+.L6:
+    movl var_13(%rip), %edi
+    call rt_print_int
+    movq temp_2(%rip), %r12
+    cmpl %r15d, temp_2(%rip)
+    jg .L8
+    movq $37, temp_1(%rip)
+.L7:
+    movq %r12, %r14
+    movl %r14d, %r13d
+    subl temp_0(%rip), %r13d
+    movl %r13d, %eax
+    imull temp_1(%rip), %eax
+    movl %eax, temp_3(%rip)
+    leaq var_7(%rip), %r10
+    movslq %r14d, %rcx
+    movq temp_3(%rip), %rax
+    movq %rax, (%r10,%rcx,8)
+    movl %r14d, %r13d
+    addl %ebx, %r13d
+    movq %r13, %r12
+    cmpl %r15d, %r13d
+    jle .L7
+.L8:
+    movq temp_2(%rip), %r12
+    cmpl %r15d, temp_2(%rip)
+    jg .L10
+.L9:
+    movq %r12, %r13
+    leaq var_7(%rip), %r10
+    movslq %r13d, %rcx
+    movq (%r10,%rcx,8), %r14
+    movslq %r14d, %rax
+    imulq $-1840700269, %rax
+    sarq $32, %rax
+    movl %eax, temp_0(%rip)
+    movl temp_0(%rip), %eax
+    addl %r14d, %eax
+    movl %eax, temp_1(%rip)
+    movl temp_1(%rip), %eax
+    sarl $2, %eax
+    movl %eax, temp_0(%rip)
+    movl %r14d, %eax
+    shrl $31, %eax
+    movl %eax, temp_1(%rip)
+    movl temp_0(%rip), %eax
+    addl temp_1(%rip), %eax
+    movl %eax, temp_2(%rip)
+    movl temp_2(%rip), %edi
+    call rt_print_int
+    movl %r14d, %eax
+    sarl $31, %eax
+    movl %eax, temp_0(%rip)
+    movl temp_0(%rip), %eax
+    shrl $29, %eax
+    movl %eax, temp_1(%rip)
+    movl %r14d, %eax
+    addl temp_1(%rip), %eax
+    movl %eax, temp_0(%rip)
+    movl temp_0(%rip), %eax
+    andl $-8, %eax
+    movl %eax, temp_1(%rip)
+    movl %r14d, %eax
+    subl temp_1(%rip), %eax
+    movl %eax, temp_0(%rip)
+    movl temp_0(%rip), %edi
+    call rt_print_int
+    movl %r13d, %r14d
+    addl %ebx, %r14d
+    movq %r14, %r12
+    cmpl %r15d, %r14d
+    jle .L9
+.L10:
+    xorl %edi, %edi
+    call exit@PLT
+
+rt_print_int:
+    subq $8, %rsp
+    movl %edi, %esi
+    leaq int_format(%rip), %rdi
+    xorl %eax, %eax
+    call printf@PLT
+    addq $8, %rsp
+    ret
+
+rt_print_string:
+    subq $8, %rsp
+    movq %rdi, %rsi
+    leaq str_format(%rip), %rdi
+    xorl %eax, %eax
+    call printf@PLT
+    addq $8, %rsp
+    ret
+
+rt_read_int:
+    subq $24, %rsp
+    movl $0, 12(%rsp)
+    leaq 12(%rsp), %rsi
+    leaq read_format(%rip), %rdi
+    xorl %eax, %eax
+    call scanf@PLT
+    movl 12(%rsp), %eax
+    addq $24, %rsp
+    ret
+
+    .section .note.GNU-stack,"",@progbits
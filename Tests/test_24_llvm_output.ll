@@ -0,0 +1,229 @@
+; كود LLVM IR مولد للغة العربية
+; ===========================
+; clang -O2 program_output.ll -o program
+
+@.fmt.int = private unnamed_addr constant [4 x i8] c"%d\0A\00"
+@.fmt.str = private unnamed_addr constant [4 x i8] c"%s\0A\00"
+@.fmt.real = private unnamed_addr constant [4 x i8] c"%g\0A\00"
+@.fmt.read = private unnamed_addr constant [3 x i8] c"%d\00"
+@.fmt.readreal = private unnamed_addr constant [4 x i8] c"%lf\00"
+@.msg.bounds = private unnamed_addr constant [72 x i8] c"\D8\AE\D8\B7\D8\A3 \D9\88\D9\82\D8\AA \D8\A7\D9\84\D8\AA\D9\86\D9\81\D9\8A\D8\B0: \D9\81\D9\87\D8\B1\D8\B3 \D8\AE\D8\A7\D8\B1\D8\AC \D8\AD\D8\AF\D9\88\D8\AF \D8\A7\D9\84\D9\82\D8\A7\D8\A6\D9\85\D8\A9\0A"
+@.str.0 = private unnamed_addr constant [7 x i8] c"\D8\A8\D8\AF\D8\A1\00"
+@.str.1 = private unnamed_addr constant [19 x i8] c"\D8\B3 \D8\A3\D9\83\D8\A8\D8\B1 \D9\85\D9\86 7\00"
+
+@"س" = global double 0.0
+@"ص" = global double 0.0
+@"ع" = global i32 0
+@"قيم" = global [6 x i32] zeroinitializer
+@"مضاعف_أ" = global i32 0
+@"ن" = global i32 0
+
+define i32 @main() {
+entry:
+  %t0 = alloca double
+  store double 0.0, double* %t0
+  %t2 = alloca i32
+  store i32 0, i32* %t2
+  %t3 = alloca double
+  store double 0.0, double* %t3
+  %t4 = alloca i32
+  store i32 0, i32* %t4
+  %t5 = alloca double
+  store double 0.0, double* %t5
+  %t9 = alloca double
+  store double 0.0, double* %t9
+  %t11 = alloca i32
+  store i32 0, i32* %t11
+  %t12 = alloca i32
+  store i32 0, i32* %t12
+  %t14 = alloca i32
+  store i32 0, i32* %t14
+  %t15 = alloca i32
+  store i32 0, i32* %t15
+  %t17 = alloca i32
+  store i32 0, i32* %t17
+  %t18 = alloca i32
+  store i32 0, i32* %t18
+  %t19 = alloca i32
+  store i32 0, i32* %t19
+  %t22 = alloca i32
+  store i32 0, i32* %t22
+  %t24 = alloca i32
+  store i32 0, i32* %t24
+  %t25 = alloca i32
+  store i32 0, i32* %t25
+  %t28 = alloca i32
+  store i32 0, i32* %t28
+  %t30 = alloca i32
+  store i32 0, i32* %t30
+  %t34 = alloca i32
+  store i32 0, i32* %t34
+  %t35 = alloca i32
+  store i32 0, i32* %t35
+  %t37 = alloca i32
+  store i32 0, i32* %t37
+  %t39 = alloca i32
+  store i32 0, i32* %t39
+  %t41 = alloca i32
+  store i32 0, i32* %t41
+  %t42 = alloca i32
+  store i32 0, i32* %t42
+  br label %.b0
+.b0:
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.str, i64 0, i64 0), i8* getelementptr inbounds ([7 x i8], [7 x i8]* @.str.0, i64 0, i64 0))
+  store double 0x401E000000000000, double* %t0
+  %.v0 = load double, double* %t0
+  store double %.v0, double* @"س"
+  store i32 2, i32* %t2
+  %.v1 = load double, double* %t0
+  %.v2 = load i32, i32* %t2
+  %.v3 = sitofp i32 %.v2 to double
+  %.v4 = fmul double %.v1, %.v3
+  store double %.v4, double* %t3
+  store i32 1, i32* %t4
+  %.v5 = load double, double* %t3
+  %.v6 = load i32, i32* %t4
+  %.v7 = sitofp i32 %.v6 to double
+  %.v8 = fadd double %.v5, %.v7
+  store double %.v8, double* %t5
+  %.v9 = load double, double* %t5
+  store double %.v9, double* @"ص"
+  %.v10 = load double, double* %t5
+  %.v11 = fptosi double %.v10 to i32
+  store i32 %.v11, i32* @"ن"
+  %.v12 = load i32, i32* @"ن"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.int, i64 0, i64 0), i32 %.v12)
+  %.v13 = load double, double* %t0
+  %.v14 = load i32, i32* %t2
+  %.v15 = sitofp i32 %.v14 to double
+  %.v16 = fdiv double %.v13, %.v15
+  store double %.v16, double* %t9
+  %.v17 = load double, double* %t9
+  %.v18 = fptosi double %.v17 to i32
+  store i32 %.v18, i32* @"ن"
+  %.v19 = load i32, i32* @"ن"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.int, i64 0, i64 0), i32 %.v19)
+  store i32 7, i32* %t11
+  %.v20 = load double, double* %t0
+  %.v21 = load i32, i32* %t11
+  %.v22 = sitofp i32 %.v21 to double
+  %.v23 = fcmp ole double %.v20, %.v22
+  br i1 %.v23, label %L0, label %.b1
+.b1:
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.str, i64 0, i64 0), i8* getelementptr inbounds ([19 x i8], [19 x i8]* @.str.1, i64 0, i64 0))
+  br label %L0
+L0:
+  store i32 0, i32* %t12
+  %.v24 = load i32, i32* %t12
+  store i32 %.v24, i32* @"ع"
+  store i32 5, i32* %t14
+  %.v25 = load i32, i32* %t12
+  %.v26 = load i32, i32* %t14
+  %.v27 = icmp sgt i32 %.v25, %.v26
+  br i1 %.v27, label %L3, label %.b2
+.b2:
+  store i32 3, i32* %t18
+  br label %L2
+L2:
+  %.v28 = load i32, i32* @"ع"
+  store i32 %.v28, i32* %t15
+  %.v29 = load i32, i32* %t15
+  %.v30 = load i32, i32* %t15
+  %.v31 = mul i32 %.v29, %.v30
+  store i32 %.v31, i32* %t17
+  %.v32 = load i32, i32* %t17
+  %.v33 = load i32, i32* %t18
+  %.v34 = sub i32 %.v32, %.v33
+  store i32 %.v34, i32* %t19
+  %.v35 = load i32, i32* %t15
+  %.v36 = sext i32 %.v35 to i64
+  %.v37 = getelementptr inbounds [6 x i32], [6 x i32]* @"قيم", i64 0, i64 %.v36
+  %.v38 = load i32, i32* %t19
+  store i32 %.v38, i32* %.v37
+  %.v39 = load i32, i32* %t15
+  %.v40 = load i32, i32* %t4
+  %.v41 = add i32 %.v39, %.v40
+  store i32 %.v41, i32* %t22
+  %.v42 = load i32, i32* %t22
+  store i32 %.v42, i32* @"ع"
+  %.v43 = load i32, i32* %t22
+  %.v44 = load i32, i32* %t14
+  %.v45 = icmp sle i32 %.v43, %.v44
+  br i1 %.v45, label %L2, label %.b3
+.b3:
+  br label %L3
+L3:
+  store i32 4, i32* %t24
+  %.v46 = load i32, i32* %t24
+  %.v47 = sext i32 %.v46 to i64
+  %.v48 = getelementptr inbounds [6 x i32], [6 x i32]* @"قيم", i64 0, i64 %.v47
+  %.v49 = load i32, i32* %.v48
+  store i32 %.v49, i32* %t25
+  %.v50 = load i32, i32* %t25
+  store i32 %.v50, i32* @"مضاعف_أ"
+  %.v51 = load i32, i32* %t25
+  %.v52 = shl i32 %.v51, 1
+  store i32 %.v52, i32* %t28
+  %.v53 = load i32, i32* %t28
+  %.v54 = load i32, i32* %t4
+  %.v55 = add i32 %.v53, %.v54
+  store i32 %.v55, i32* %t30
+  %.v56 = load i32, i32* %t30
+  store i32 %.v56, i32* @"ن"
+  %.v57 = load i32, i32* @"ن"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.int, i64 0, i64 0), i32 %.v57)
+  %.v58 = load i32, i32* %t12
+  store i32 %.v58, i32* @"ع"
+  %.v59 = load i32, i32* %t12
+  %.v60 = load i32, i32* %t14
+  %.v61 = icmp sgt i32 %.v59, %.v60
+  br i1 %.v61, label %L6, label %.b4
+.b4:
+  br label %L5
+L5:
+  %.v62 = load i32, i32* @"ع"
+  store i32 %.v62, i32* %t34
+  %.v63 = load i32, i32* %t34
+  %.v64 = sext i32 %.v63 to i64
+  %.v65 = getelementptr inbounds [6 x i32], [6 x i32]* @"قيم", i64 0, i64 %.v64
+  %.v66 = load i32, i32* %.v65
+  store i32 %.v66, i32* %t35
+  %.v67 = load i32, i32* %t35
+  %.v68 = lshr i32 %.v67, 31
+  store i32 %.v68, i32* %t41
+  %.v69 = load i32, i32* %t35
+  %.v70 = load i32, i32* %t41
+  %.v71 = add i32 %.v69, %.v70
+  store i32 %.v71, i32* %t42
+  %.v72 = load i32, i32* %t42
+  %.v73 = ashr i32 %.v72, 1
+  store i32 %.v73, i32* %t37
+  %.v74 = load i32, i32* %t37
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.int, i64 0, i64 0), i32 %.v74)
+  %.v75 = load i32, i32* %t34
+  %.v76 = load i32, i32* %t4
+  %.v77 = add i32 %.v75, %.v76
+  store i32 %.v77, i32* %t39
+  %.v78 = load i32, i32* %t39
+  store i32 %.v78, i32* @"ع"
+  %.v79 = load i32, i32* %t39
+  %.v80 = load i32, i32* %t14
+  %.v81 = icmp sle i32 %.v79, %.v80
+  br i1 %.v81, label %L5, label %.b5
+.b5:
+  br label %L6
+L6:
+  ret i32 0
+}
+
+define internal void @rt.bounds_error() noreturn cold {
+entry:
+  call i64 @write(i32 2, i8* getelementptr inbounds ([72 x i8], [72 x i8]* @.msg.bounds, i64 0, i64 0), i64 72)
+  call void @exit(i32 1)
+  unreachable
+}
+
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i64 @write(i32, i8*, i64)
+declare void @exit(i32) noreturn
@@ -0,0 +1,186 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+ح: .word 0
+م: .word 0
+ع: .word 0
+.align 3
+ب: .space 24
+.align 3
+أ: .space 24
+ق: .space 48
+.align 3
+نقطة: .space 24
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+str_0: .asciiz "بدء"
+
+.text
+.globl main
+main:
+    li $v0, 4
+    la $a0, str_0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t0, 3
+    sw $t0, أ
+    li $t0, 4
+    sw $t0, أ+16
+    li $t1, 10
+    mul $t2, $t0, $t1
+    sw $t2, ب
+    lw $t1, أ
+    add $t3, $t1, $t2
+    sw $t3, ب+16
+    li $v0, 1
+    lw $a0, ب
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 1
+    lw $a0, ب+16
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $t1, 0
+    move $t2, $t1
+    move $t3, $t1
+    li $t4, 11
+    # CMP t8, t10
+    bgt $t1, $t4, L1
+    li $t5, 1
+    L0:
+    move $t6, $t2
+    mul $t7, $t6, $t6
+    sll $t9, $t6, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    sw $t7, 0($t9)
+    move $t3, $t2
+    add $t6, $t3, $t5
+    move $t2, $t6
+    # CMP t16, t10
+    ble $t6, $t4, L0
+    L1:
+    move $t3, $t1
+    move $t2, $t1
+    move $t5, $t1
+    # CMP t8, t10
+    bgt $t1, $t4, L3
+    li $t1, 1
+    L2:
+    move $t6, $t3
+    move $t7, $t2
+    sll $t9, $t7, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    lw $s0, 0($t9)
+    add $t7, $t6, $s0
+    move $t3, $t7
+    move $t5, $t2
+    add $t6, $t5, $t1
+    move $t2, $t6
+    # CMP t27, t10
+    ble $t6, $t4, L2
+    L3:
+    li $v0, 1
+    move $a0, $t3
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $a0, $t0
+    la $a1, ح
+    jal proc_مجموع
+    li $v0, 1
+    lw $a0, ح
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
+    proc_مجموع:
+    addiu $sp, $sp, -112
+    sw $ra, 108($sp)
+    sw $fp, 104($sp)
+    move $fp, $sp
+    sw $t0, 72($fp)
+    sw $t1, 76($fp)
+    sw $t2, 80($fp)
+    sw $t3, 84($fp)
+    sw $t4, 88($fp)
+    sw $t5, 92($fp)
+    sw $t6, 96($fp)
+    sw $t7, 100($fp)
+    move $t0, $a0
+    sw $a1, 0($fp)
+    addiu $t8, $fp, 4
+    addiu $t9, $t8, 64
+    clear_proc_مجموع_4:
+    sw $zero, 0($t8)
+    addiu $t8, $t8, 4
+    bne $t8, $t9, clear_proc_مجموع_4
+    move $t1, $zero
+    sw $zero, 68($fp)
+    move $t1, $t0
+    li $t2, 0
+    # CMP t30, t31
+    bgt $t1, $t2, L4
+    lw $t9, 0($fp)
+    sw $t2, 0($t9)
+    j end_proc_مجموع
+    L4:
+    move $t1, $t2
+    move $t3, $t2
+    li $t4, 15
+    # CMP t31, t35
+    bgt $t2, $t4, L7
+    move $t2, $t0
+    li $t5, 1
+    L6:
+    move $t6, $t1
+    mul $t7, $t6, $t2
+    sll $t9, $t6, 2
+    addu $t9, $t9, $fp
+    sw $t7, 4($t9)
+    move $t3, $t1
+    add $t6, $t3, $t5
+    move $t1, $t6
+    # CMP t41, t35
+    ble $t6, $t4, L6
+    L7:
+    move $t1, $t0
+    li $t0, 1
+    sub $t2, $t1, $t0
+    move $a0, $t2
+    addiu $a1, $fp, 68
+    jal proc_مجموع
+    li $t0, 15
+    sll $t9, $t0, 2
+    addu $t9, $t9, $fp
+    lw $t1, 4($t9)
+    lw $t0, 68($fp)
+    add $t2, $t1, $t0
+    lw $t9, 0($fp)
+    sw $t2, 0($t9)
+    end_proc_مجموع:
+    lw $t0, 72($fp)
+    lw $t1, 76($fp)
+    lw $t2, 80($fp)
+    lw $t3, 84($fp)
+    lw $t4, 88($fp)
+    lw $t5, 92($fp)
+    lw $t6, 96($fp)
+    lw $t7, 100($fp)
+    move $sp, $fp
+    lw $ra, 108($sp)
+    lw $fp, 104($sp)
+    addiu $sp, $sp, 112
+    jr $ra
@@ -0,0 +1,117 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+اجمع_ق: .space 12
+اجمع_ن: .word 0
+عد_م: .word 0
+عد_ن: .word 0
+اجمع_ز: .space 8
+ج: .word 0
+زوج: .space 8
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+
+.text
+.globl main
+main:
+    li $t0, 1
+    move $t1, $t0
+    li $t2, 3
+    # CMP t0, t2
+    bgt $t0, $t2, L1
+    li $t3, 0
+    L0:
+    move $t4, $t1
+    move $t5, $t4
+    move $t5, $t3
+    li $v0, 1
+    move $a0, $t5
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    add $t6, $t3, $t4
+    move $t5, $t6
+    li $v0, 1
+    move $a0, $t5
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    add $t5, $t4, $t0
+    move $t1, $t5
+    # CMP t9, t2
+    ble $t5, $t2, L0
+    L1:
+    move $t1, $t0
+    # CMP t0, t2
+    bgt $t0, $t2, L4
+    li $t3, 0
+    li $t4, 2
+    L3:
+    move $t5, $t1
+    move $t6, $t5
+    sll $t9, $t3, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    sw $t3, 0($t9)
+    sll $t9, $t0, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    sw $t3, 0($t9)
+    sll $t9, $t4, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    sw $t3, 0($t9)
+    sw $t3, اجمع_ز
+    sw $t3, اجمع_ز+4
+    sub $t6, $t5, $t0
+    sll $t9, $t6, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    lw $t7, 0($t9)
+    add $s0, $t7, $t5
+    sll $t9, $t6, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    sw $s0, 0($t9)
+    lw $t6, اجمع_ز
+    add $t7, $t6, $t5
+    sw $t7, اجمع_ز
+    sll $t9, $t3, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    lw $t6, 0($t9)
+    sll $t9, $t0, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    lw $s0, 0($t9)
+    add $s1, $t6, $s0
+    sll $t9, $t4, 2
+    la $t8, اجمع_ق
+    addu $t9, $t9, $t8
+    lw $t6, 0($t9)
+    add $s0, $s1, $t6
+    li $v0, 1
+    move $a0, $s0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    lw $t6, اجمع_ز+4
+    add $s0, $t7, $t6
+    li $v0, 1
+    move $a0, $s0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    add $t6, $t5, $t0
+    move $t1, $t6
+    # CMP t44, t2
+    ble $t6, $t2, L3
+    L4:
+    li $v0, 10
+    syscall
@@ -0,0 +1,326 @@
+# كود تجميعي مولد للغة العربية
+# =============================
+
+.data
+محلي_ي: .word 0
+محلي_ل: .space 16
+محلي_م: .word 0
+س: .word 0
+ع: .word 0
+ق: .space 24
+newline: .asciiz "\n"
+int_format: .asciiz "%d"
+str_format: .asciiz "%s"
+
+.text
+.globl main
+main:
+    li $t0, 0
+    move $t1, $t0
+    move $t2, $t0
+    li $t3, 5
+    # CMP t0, t2
+    bgt $t0, $t3, L1
+    li $t0, 1
+    move $t4, $t1
+    li $t9, 10
+    mul $t5, $t4, $t9
+    L0:
+    move $t4, $t1
+    move $t6, $t5
+    sll $t9, $t4, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    sw $t6, 0($t9)
+    move $t2, $t1
+    add $t4, $t2, $t0
+    move $t1, $t4
+    li $t9, 10
+    add $t5, $t5, $t9
+    # CMP t8, t2
+    ble $t4, $t3, L0
+    L1:
+    li $t0, 2
+    sll $t9, $t0, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    li $t0, 4
+    move $t1, $t0
+    li $t2, 1
+    add $t3, $t0, $t2
+    sll $t9, $t3, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    li $t0, 1
+    li $t2, 2
+    li $t3, 3
+    li $t4, 4
+    li $t5, 0
+    move $t6, $t1
+    sub $t7, $t6, $t0
+    addiu $sp, $sp, -8
+    move $a0, $t0
+    move $a1, $t2
+    move $a2, $t3
+    move $a3, $t4
+    sll $t9, $t5, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    addiu $t8, $t9, 0
+    sw $t8, 0($sp)
+    sll $t9, $t7, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    addiu $t8, $t9, 0
+    sw $t8, 4($sp)
+    jal proc_ستة
+    addiu $sp, $sp, 8
+    li $t0, 0
+    move $t1, $t0
+    li $t2, 5
+    # CMP t23, t25
+    bgt $t0, $t2, L3
+    li $t3, 1
+    L2:
+    move $t4, $t1
+    sll $t9, $t4, 2
+    la $t8, ق
+    addu $t9, $t9, $t8
+    lw $t5, 0($t9)
+    li $v0, 1
+    move $a0, $t5
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    add $t5, $t4, $t3
+    move $t1, $t5
+    # CMP t29, t25
+    ble $t5, $t2, L2
+    L3:
+    li $t1, 2
+    move $t2, $t1
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    li $t3, 1
+    sll $t9, $t3, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    sll $t9, $t1, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    li $t1, 3
+    sll $t9, $t1, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    move $t3, $t0
+    move $t4, $t0
+    # CMP t23, t36
+    bgt $t0, $t1, L6
+    L5:
+    move $t0, $t3
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    move $t0, $t2
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    li $t0, 1
+    move $t4, $t3
+    add $t1, $t4, $t0
+    move $t3, $t1
+    li $t0, 3
+    # CMP t44, t45
+    ble $t1, $t0, L5
+    L6:
+    li $t0, 0
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t1, 0($t9)
+    li $t4, 1
+    sll $t9, $t4, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t5, 0($t9)
+    li $t6, 10
+    mul $t7, $t5, $t6
+    add $t5, $t1, $t7
+    li $t1, 2
+    sll $t9, $t1, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t6, 0($t9)
+    li $t7, 100
+    mul $s0, $t6, $t7
+    add $t6, $t5, $s0
+    li $t5, 3
+    sll $t9, $t5, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t7, 0($t9)
+    li $s0, 1000
+    mul $s1, $t7, $s0
+    add $t7, $t6, $s1
+    li $v0, 1
+    move $a0, $t7
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    move $t2, $t0
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    sll $t9, $t4, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    sll $t9, $t1, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    sll $t9, $t5, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
+    move $t3, $t0
+    move $t1, $t0
+    # CMP t46, t58
+    bgt $t0, $t5, L9
+    L8:
+    move $t0, $t3
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    move $t0, $t2
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    addiu $a0, $t9, 0
+    jal proc_زد
+    li $t0, 1
+    move $t1, $t3
+    add $t4, $t1, $t0
+    move $t3, $t4
+    li $t0, 3
+    # CMP t76, t77
+    ble $t4, $t0, L8
+    L9:
+    li $t0, 0
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t1, 0($t9)
+    li $t0, 1
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t2, 0($t9)
+    li $t0, 10
+    mul $t3, $t2, $t0
+    add $t0, $t1, $t3
+    li $t1, 2
+    sll $t9, $t1, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t2, 0($t9)
+    li $t1, 100
+    mul $t3, $t2, $t1
+    add $t1, $t0, $t3
+    li $t0, 3
+    sll $t9, $t0, 2
+    la $t8, محلي_ل
+    addu $t9, $t9, $t8
+    lw $t2, 0($t9)
+    li $t0, 1000
+    mul $t3, $t2, $t0
+    add $t0, $t1, $t3
+    li $v0, 1
+    move $a0, $t0
+    syscall
+    li $v0, 4
+    la $a0, newline
+    syscall
+    li $v0, 10
+    syscall
+    proc_زد:
+    addiu $sp, $sp, -24
+    sw $ra, 20($sp)
+    sw $fp, 16($sp)
+    move $fp, $sp
+    sw $t0, 4($fp)
+    sw $t1, 8($fp)
+    sw $t2, 12($fp)
+    sw $a0, 0($fp)
+    lw $t0, 0($fp)
+    lw $t0, 0($t0)
+    li $t1, 1
+    add $t2, $t0, $t1
+    lw $t9, 0($fp)
+    sw $t2, 0($t9)
+    end_proc_زد:
+    lw $t0, 4($fp)
+    lw $t1, 8($fp)
+    lw $t2, 12($fp)
+    move $sp, $fp
+    lw $ra, 20($sp)
+    lw $fp, 16($sp)
+    addiu $sp, $sp, 24
+    jr $ra
+    proc_ستة:
+    addiu $sp, $sp, -40
+    sw $ra, 36($sp)
+    sw $fp, 32($sp)
+    move $fp, $sp
+    sw $t0, 8($fp)
+    sw $t1, 12($fp)
+    sw $t2, 16($fp)
+    sw $t3, 20($fp)
+    sw $t4, 24($fp)
+    move $t0, $a0
+    move $t1, $a1
+    move $t2, $a2
+    move $t3, $a3
+    lw $t8, 40($fp)
+    sw $t8, 0($fp)
+    lw $t8, 44($fp)
+    sw $t8, 4($fp)
+    move $t4, $t0
+    move $t0, $t1
+    add $t1, $t4, $t0
+    lw $t9, 0($fp)
+    sw $t1, 0($t9)
+    move $t0, $t2
+    move $t1, $t3
+    mul $t2, $t0, $t1
+    lw $t9, 4($fp)
+    sw $t2, 0($t9)
+    end_proc_ستة:
+    lw $t0, 8($fp)
+    lw $t1, 12($fp)
+    lw $t2, 16($fp)
+    lw $t3, 20($fp)
+    lw $t4, 24($fp)
+    move $sp, $fp
+    lw $ra, 36($sp)
+    lw $fp, 32($sp)
+    addiu $sp, $sp, 40
+    jr $ra
@@ -0,0 +1,168 @@
+; كود LLVM IR مولد للغة العربية
+; ===========================
+; clang -O2 program_output.ll -o program
+
+@.fmt.int = private unnamed_addr constant [4 x i8] c"%d\0A\00"
+@.fmt.str = private unnamed_addr constant [4 x i8] c"%s\0A\00"
+@.fmt.real = private unnamed_addr constant [4 x i8] c"%g\0A\00"
+@.fmt.read = private unnamed_addr constant [3 x i8] c"%d\00"
+@.fmt.readreal = private unnamed_addr constant [4 x i8] c"%lf\00"
+@.msg.bounds = private unnamed_addr constant [72 x i8] c"\D8\AE\D8\B7\D8\A3 \D9\88\D9\82\D8\AA \D8\A7\D9\84\D8\AA\D9\86\D9\81\D9\8A\D8\B0: \D9\81\D9\87\D8\B1\D8\B3 \D8\AE\D8\A7\D8\B1\D8\AC \D8\AD\D8\AF\D9\88\D8\AF \D8\A7\D9\84\D9\82\D8\A7\D8\A6\D9\85\D8\A9\0A"
+@.str.0 = private unnamed_addr constant [7 x i8] c"\D8\A8\D8\AF\D8\A1\00"
+@.str.1 = private unnamed_addr constant [19 x i8] c"\D8\B5 \D8\A3\D9\83\D8\A8\D8\B1 \D9\85\D9\86 4\00"
+
+@"س" = global double 0.0
+@"ص" = global double 0.0
+@"ع" = global i32 0
+@"م" = global [4 x double] zeroinitializer
+@"ن" = global i32 0
+
+define i32 @main() {
+entry:
+  %t0 = alloca double
+  store double 0.0, double* %t0
+  %t2 = alloca i32
+  store i32 0, i32* %t2
+  %t3 = alloca double
+  store double 0.0, double* %t3
+  %t6 = alloca double
+  store double 0.0, double* %t6
+  %t7 = alloca double
+  store double 0.0, double* %t7
+  %t8 = alloca double
+  store double 0.0, double* %t8
+  %t12 = alloca i32
+  store i32 0, i32* %t12
+  %t14 = alloca i32
+  store i32 0, i32* %t14
+  %t16 = alloca i32
+  store i32 0, i32* %t16
+  %t17 = alloca double
+  store double 0.0, double* %t17
+  %t19 = alloca i32
+  store i32 0, i32* %t19
+  %t20 = alloca i32
+  store i32 0, i32* %t20
+  %t23 = alloca double
+  store double 0.0, double* %t23
+  %t24 = alloca i32
+  store i32 0, i32* %t24
+  %t25 = alloca double
+  store double 0.0, double* %t25
+  %t26 = alloca double
+  store double 0.0, double* %t26
+  %t28 = alloca i32
+  store i32 0, i32* %t28
+  br label %.b0
+.b0:
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.str, i64 0, i64 0), i8* getelementptr inbounds ([7 x i8], [7 x i8]* @.str.0, i64 0, i64 0))
+  store double 0x401E000000000000, double* %t0
+  %.v0 = load double, double* %t0
+  store double %.v0, double* @"س"
+  store i32 2, i32* %t2
+  %.v1 = load double, double* %t0
+  %.v2 = load i32, i32* %t2
+  %.v3 = sitofp i32 %.v2 to double
+  %.v4 = fmul double %.v1, %.v3
+  store double %.v4, double* %t3
+  %.v5 = load double, double* %t3
+  store double %.v5, double* @"ص"
+  %.v6 = load double, double* @"ص"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.real, i64 0, i64 0), double %.v6)
+  %.v7 = load double, double* %t0
+  %.v8 = load i32, i32* %t2
+  %.v9 = sitofp i32 %.v8 to double
+  %.v10 = fdiv double %.v7, %.v9
+  store double %.v10, double* %t6
+  store double 0x3FD0000000000000, double* %t7
+  %.v11 = load double, double* %t6
+  %.v12 = load double, double* %t7
+  %.v13 = fadd double %.v11, %.v12
+  store double %.v13, double* %t8
+  %.v14 = load double, double* %t8
+  store double %.v14, double* @"ص"
+  %.v15 = load double, double* @"ص"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.real, i64 0, i64 0), double %.v15)
+  %.v16 = load double, double* %t3
+  %.v17 = fptosi double %.v16 to i32
+  store i32 %.v17, i32* @"ن"
+  %.v18 = load i32, i32* @"ن"
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.int, i64 0, i64 0), i32 %.v18)
+  store i32 0, i32* %t12
+  %.v19 = load i32, i32* %t12
+  store i32 %.v19, i32* @"ع"
+  store i32 3, i32* %t14
+  %.v20 = load i32, i32* %t12
+  %.v21 = load i32, i32* %t14
+  %.v22 = icmp sgt i32 %.v20, %.v21
+  br i1 %.v22, label %L1, label %.b1
+.b1:
+  store i32 1, i32* %t19
+  br label %L0
+L0:
+  %.v23 = load i32, i32* @"ع"
+  store i32 %.v23, i32* %t16
+  %.v24 = load double, double* %t0
+  %.v25 = load i32, i32* %t16
+  %.v26 = sitofp i32 %.v25 to double
+  %.v27 = fmul double %.v24, %.v26
+  store double %.v27, double* %t17
+  %.v28 = load i32, i32* %t16
+  %.v29 = sext i32 %.v28 to i64
+  %.v30 = getelementptr inbounds [4 x double], [4 x double]* @"م", i64 0, i64 %.v29
+  %.v31 = load double, double* %t17
+  store double %.v31, double* %.v30
+  %.v32 = load i32, i32* %t16
+  %.v33 = load i32, i32* %t19
+  %.v34 = add i32 %.v32, %.v33
+  store i32 %.v34, i32* %t20
+  %.v35 = load i32, i32* %t20
+  store i32 %.v35, i32* @"ع"
+  %.v36 = load i32, i32* %t20
+  %.v37 = load i32, i32* %t14
+  %.v38 = icmp sle i32 %.v36, %.v37
+  br i1 %.v38, label %L0, label %.b2
+.b2:
+  br label %L1
+L1:
+  %.v39 = load i32, i32* %t14
+  %.v40 = sext i32 %.v39 to i64
+  %.v41 = getelementptr inbounds [4 x double], [4 x double]* @"م", i64 0, i64 %.v40
+  %.v42 = load double, double* %.v41
+  store double %.v42, double* %t23
+  store i32 1, i32* %t24
+  %.v43 = load i32, i32* %t24
+  %.v44 = sext i32 %.v43 to i64
+  %.v45 = getelementptr inbounds [4 x double], [4 x double]* @"م", i64 0, i64 %.v44
+  %.v46 = load double, double* %.v45
+  store double %.v46, double* %t25
+  %.v47 = load double, double* %t23
+  %.v48 = load double, double* %t25
+  %.v49 = fsub double %.v47, %.v48
+  store double %.v49, double* %t26
+  %.v50 = load double, double* %t26
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.real, i64 0, i64 0), double %.v50)
+  store i32 4, i32* %t28
+  %.v51 = load double, double* %t8
+  %.v52 = load i32, i32* %t28
+  %.v53 = sitofp i32 %.v52 to double
+  %.v54 = fcmp ole double %.v51, %.v53
+  br i1 %.v54, label %L2, label %.b3
+.b3:
+  call i32 (i8*, ...) @printf(i8* getelementptr inbounds ([4 x i8], [4 x i8]* @.fmt.str, i64 0, i64 0), i8* getelementptr inbounds ([19 x i8], [19 x i8]* @.str.1, i64 0, i64 0))
+  br label %L2
+L2:
+  ret i32 0
+}
+
+define internal void @rt.bounds_error() noreturn cold {
+entry:
+  call i64 @write(i32 2, i8* getelementptr inbounds ([72 x i8], [72 x i8]* @.msg.bounds, i64 0, i64 0), i64 72)
+  call void @exit(i32 1)
+  unreachable
+}
+
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i64 @write(i32, i8*, i64)
+declare void @exit(i32) noreturn
@@ -2,239 +2,165 @@
 # =============================
 
 .data
-الأرقام: .word 0
 باي: .word 0
+ص: .word 0
 الحد_الأقصى: .word 0
+الجمع_النتيجة: .word 0
 س: .word 0
-ن: .word 0
-ص: .word 0
+.align 3
+ن: .space 8
 نص: .word 0
-علم: .word 0
-الشخص: .word 0
-الموظف: .word 0
-النتيجة: .word 0
 ع: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
-t3: .word 0
-t4: .word 0
-t5: .word 0
-t6: .word 0
-t7: .word 0
-t8: .word 0
-t9: .word 0
-t10: .word 0
-t11: .word 0
-t12: .word 0
-t13: .word 0
-t14: .word 0
-t15: .word 0
-t16: .word 0
-t17: .word 0
-t18: .word 0
-t19: .word 0
-t20: .word 0
-t21: .word 0
-t22: .word 0
+علم: .word 0
+الجمع_أ: .word 0
+الجمع_ب: .word 0
+الأرقام: .space 20
+الشخص: .space 8
+الموظف: .space 8
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
-str_0: .asciiz "مرحبا من الإجراء"
-str_1: .asciiz "المجموع: "
-str_2: .asciiz "مرحبا"
-str_3: .asciiz "=== اختبار التعليمات الأساسية ==="
-str_4: .asciiz "س = "
-str_5: .asciiz "=== اختبار جمل الشرط ==="
-str_6: .asciiz "س أكبر من 5"
-str_7: .asciiz "س أصغر من أو يساوي 5"
-str_8: .asciiz "=== اختبار حلقات التكرار ==="
-str_9: .asciiz "التكرار: "
-str_10: .asciiz "=== اختبار التعبيرات ==="
-str_11: .asciiz "س + ص = "
-str_12: .asciiz "س * ص = "
-str_13: .asciiz "=== اختبار القيم والثوابت ==="
-str_14: .asciiz "باي = "
-str_15: .asciiz "=== استدعاء الإجراءات ==="
+str_0: .asciiz "مرحبا"
+str_1: .asciiz "=== اختبار التعليمات الأساسية ==="
+str_2: .asciiz "س = "
+str_3: .asciiz "=== اختبار جمل الشرط ==="
+str_4: .asciiz "س أكبر من 5"
+str_5: .asciiz "س أصغر من أو يساوي 5"
+str_6: .asciiz "=== اختبار حلقات التكرار ==="
+str_7: .asciiz "التكرار: "
+str_8: .asciiz "=== اختبار التعبيرات ==="
+str_9: .asciiz "س + ص = "
+str_10: .asciiz "س * ص = "
+str_11: .asciiz "=== اختبار القيم والثوابت ==="
+str_12: .asciiz "باي = "
+str_13: .asciiz "=== استدعاء الإجراءات ==="
+str_14: .asciiz "مرحبا من الإجراء"
+str_15: .asciiz "المجموع: "
 
 .text
 .globl main
 main:
     li $t0, 3.14159
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, باي
+    move $t1, $t0
     li $t0, 100
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, الحد_الأقصى
-    proc_الطباعة_البسيطة:
+    move $t2, $t0
+    li $t0, 10
+    move $t2, $t0
+    li $t3, 20
+    move $t4, $t3
+    li $t4, 3.14
+    move $t5, $t4
+    la $t4, str_0
+    move $t5, $t4
+    li $t4, 1
+    move $t5, $t4
     li $v0, 4
-    la $a0, str_0
+    la $a0, str_1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    # UNKNOWN
-    proc_الجمع:
     li $v0, 4
-    la $a0, str_1
+    la $a0, str_2
     syscall
     li $v0, 4
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, النتيجة
+    move $a0, $t2
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    # UNKNOWN
-    li $t0, 10
-    sw $t0, t2
-    lw $t0, t2
-    sw $t0, س
-    li $t0, 20
-    sw $t0, t3
-    lw $t0, t3
-    sw $t0, ص
-    li $t0, 3.14
-    sw $t0, t4
-    lw $t0, t4
-    sw $t0, ن
-    la $t0, str_2
-    sw $t0, t5
-    lw $t0, t5
-    sw $t0, نص
-    lw $t0, صح
-    sw $t0, t6
-    lw $t0, t6
-    sw $t0, علم
     li $v0, 4
     la $a0, str_3
     syscall
     li $v0, 4
     la $a0, newline
     syscall
+    li $t2, 5
+    # CMP t2, t8
+    ble $t0, $t2, L0
     li $v0, 4
     la $a0, str_4
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $v0, 1
-    lw $a0, س
+    j L1
+    L0:
+    li $v0, 4
+    la $a0, str_5
     syscall
     li $v0, 4
     la $a0, newline
     syscall
+    L1:
     li $v0, 4
-    la $a0, str_5
+    la $a0, str_6
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, س
-    sw $t0, t7
-    li $t0, 5
-    sw $t0, t8
-    li $t0, 0
-    sw $t0, t9
-    lw $t1, t7
-    lw $t2, t8
-    # CMP t7, t8
-    lw $t1, t7
-    lw $t2, t8
-    bgt $t1, $t2, L2
-    j L3
+    li $t4, 1
+    move $t5, $t4
+    move $t6, $t4
+    li $t7, 3
+    # CMP t9, t11
+    bgt $t4, $t7, L3
     L2:
-    li $t0, 1
-    sw $t0, t9
-    L3:
-    lw $t0, t9
-    beqz $t0, L0
     li $v0, 4
-    la $a0, str_6
+    la $a0, str_7
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    j L1
-    L0:
-    li $v0, 4
-    la $a0, str_7
+    li $v0, 1
+    move $a0, $t5
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    L1:
+    move $t6, $t5
+    add $s0, $t6, $t4
+    move $t5, $s0
+    # CMP t13, t11
+    ble $s0, $t7, L2
+    L3:
     li $v0, 4
     la $a0, str_8
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 1
-    sw $t0, t10
-    lw $t0, t10
-    sw $t0, ع
-    L4:
-    lw $t0, ع
-    sw $t0, t11
-    li $t0, 3
-    sw $t0, t12
-    lw $t1, t11
-    lw $t2, t12
-    # CMP t11, t12
-    lw $t1, t11
-    lw $t2, t12
-    bgt $t1, $t2, L5
     li $v0, 4
     la $a0, str_9
     syscall
     li $v0, 4
     la $a0, newline
     syscall
+    add $t4, $t0, $t3
     li $v0, 1
-    lw $a0, ع
+    move $a0, $t4
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 1
-    sw $t0, t13
-    lw $t0, ع
-    sw $t0, t11
-    lw $t1, t11
-    lw $t2, t13
-    add $t0, $t1, $t2
-    sw $t0, t14
-    lw $t0, t14
-    sw $t0, ع
-    j L4
-    L5:
     li $v0, 4
     la $a0, str_10
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $v0, 4
-    la $a0, str_11
+    mul $t4, $t0, $t3
+    li $v0, 1
+    move $a0, $t4
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, س
-    sw $t0, t15
-    lw $t0, ص
-    sw $t0, t16
-    lw $t1, t15
-    lw $t2, t16
-    add $t0, $t1, $t2
-    sw $t0, t17
-    li $v0, 1
-    lw $a0, t17
+    li $v0, 4
+    la $a0, str_11
     syscall
     li $v0, 4
     la $a0, newline
@@ -245,16 +171,8 @@ main:
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, س
-    sw $t0, t18
-    lw $t0, ص
-    sw $t0, t19
-    lw $t1, t18
-    lw $t2, t19
-    mul $t0, $t1, $t2
-    sw $t0, t20
     li $v0, 1
-    lw $a0, t20
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
@@ -271,27 +189,21 @@ main:
     li $v0, 4
     la $a0, newline
     syscall
-    li $v0, 1
-    lw $a0, باي
+    move $t0, $t2
+    move $t0, $t7
+    li $t0, 0
+    move $t1, $t0
+    li $v0, 4
+    la $a0, str_15
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $v0, 4
-    la $a0, str_15
+    li $v0, 1
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    # UNKNOWN
-    li $t0, 5
-    sw $t0, t21
-    lw $t0, t21
-    sw $t0, param_0
-    li $t0, 3
-    sw $t0, t22
-    lw $t0, t22
-    sw $t0, param_1
-    # UNKNOWN
     li $v0, 10
     syscall
@@ -2,20 +2,14 @@
 # =============================
 
 .data
-باي: .word 0
-رقم_حقيقي: .word 0
-الحد_الأقصى: .word 0
-الرسالة: .word 0
-رقم_صحيح: .word 0
 علم: .word 0
+.align 3
+رقم_حقيقي: .space 8
+رقم_صحيح: .word 0
 نص: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
-t3: .word 0
-t4: .word 0
-t5: .word 0
-t6: .word 0
+الرسالة: .word 0
+الحد_الأقصى: .word 0
+باي: .word 0
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -33,18 +27,13 @@ str_9: .asciiz "قيمة الثابت الرسالة: "
 .text
 .globl main
 main:
+    move $t1, $zero
     li $t0, 3.14159
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, باي
-    li $t0, 100
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, الحد_الأقصى
-    la $t0, str_0
-    sw $t0, t2
-    lw $t0, t2
-    sw $t0, الرسالة
+    move $t2, $t0
+    li $t3, 100
+    move $t4, $t3
+    la $t3, str_0
+    move $t5, $t3
     li $v0, 4
     la $a0, str_1
     syscall
@@ -52,15 +41,12 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, رقم_صحيح
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 3.14159
-    sw $t0, t3
-    lw $t0, t3
-    sw $t0, رقم_حقيقي
+    move $t1, $t0
     li $v0, 4
     la $a0, str_2
     syscall
@@ -68,15 +54,13 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, رقم_حقيقي
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
     la $t0, str_3
-    sw $t0, t4
-    lw $t0, t4
-    sw $t0, نص
+    move $t1, $t0
     li $v0, 4
     la $a0, str_4
     syscall
@@ -84,15 +68,13 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, نص
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, صح
-    sw $t0, t5
-    lw $t0, t5
-    sw $t0, علم
+    li $t0, 1
+    move $t1, $t0
     li $v0, 4
     la $a0, str_5
     syscall
@@ -100,15 +82,13 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, علم
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, خطأ
-    sw $t0, t6
-    lw $t0, t6
-    sw $t0, علم
+    li $t0, 0
+    move $t1, $t0
     li $v0, 4
     la $a0, str_6
     syscall
@@ -116,7 +96,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, علم
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
@@ -128,7 +108,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, باي
+    move $a0, $t2
     syscall
     li $v0, 4
     la $a0, newline
@@ -140,7 +120,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الحد_الأقصى
+    move $a0, $t4
     syscall
     li $v0, 4
     la $a0, newline
@@ -152,7 +132,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الرسالة
+    move $a0, $t5
     syscall
     li $v0, 4
     la $a0, newline
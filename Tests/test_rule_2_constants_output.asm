@@ -2,12 +2,9 @@
 # =============================
 
 .data
-باي: .word 0
-الحد_الأقصى: .word 0
 الحد_الأدنى: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
+الحد_الأقصى: .word 0
+باي: .word 0
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -18,17 +15,11 @@ str_1: .asciiz "الحد الأقصى: "
 .globl main
 main:
     li $t0, 3.14159
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, باي
+    move $t1, $t0
     li $t0, 100
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, الحد_الأقصى
+    move $t2, $t0
     li $t0, 1
-    sw $t0, t2
-    lw $t0, t2
-    sw $t0, الحد_الأدنى
+    move $t3, $t0
     li $v0, 4
     la $a0, str_0
     syscall
@@ -36,7 +27,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, باي
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
@@ -48,7 +39,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الحد_الأقصى
+    move $a0, $t2
     syscall
     li $v0, 4
     la $a0, newline
@@ -2,22 +2,9 @@
 # =============================
 
 .data
-الأرقام: .word 0
-الأسعار: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
-t3: .word 0
-t4: .word 0
-t5: .word 0
-t6: .word 0
-t7: .word 0
-t8: .word 0
-t9: .word 0
-t10: .word 0
-t11: .word 0
-t12: .word 0
-t13: .word 0
+.align 3
+الأسعار: .space 24
+الأرقام: .space 20
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -28,41 +15,45 @@ str_1: .asciiz "السعر الأول: "
 .globl main
 main:
     li $t0, 10
-    sw $t0, t0
-    li $t0, 0
-    sw $t0, t1
-    # STORE_INDEXED الأرقام[t1], t0
+    li $t1, 0
+    sll $t9, $t1, 2
+    la $t8, الأرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 20
-    sw $t0, t2
-    li $t0, 1
-    sw $t0, t3
-    # STORE_INDEXED الأرقام[t3], t2
+    li $t2, 1
+    sll $t9, $t2, 2
+    la $t8, الأرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 30
-    sw $t0, t4
-    li $t0, 2
-    sw $t0, t5
-    # STORE_INDEXED الأرقام[t5], t4
+    li $t3, 2
+    sll $t9, $t3, 2
+    la $t8, الأرقام
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 99.99
-    sw $t0, t6
-    li $t0, 0
-    sw $t0, t7
-    # STORE_INDEXED الأسعار[t7], t6
+    sll $t9, $t1, 3
+    la $t8, الأسعار
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $t0, 149.50
-    sw $t0, t8
-    li $t0, 1
-    sw $t0, t9
-    # STORE_INDEXED الأسعار[t9], t8
+    sll $t9, $t2, 3
+    la $t8, الأسعار
+    addu $t9, $t9, $t8
+    sw $t0, 0($t9)
     li $v0, 4
     la $a0, str_0
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 0
-    sw $t0, t10
-    # LOAD_INDEXED t11, الأرقام[t10]
+    sll $t9, $t1, 2
+    la $t8, الأرقام
+    addu $t9, $t9, $t8
+    lw $t0, 0($t9)
     li $v0, 1
-    lw $a0, t11
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
@@ -73,11 +64,12 @@ main:
     li $v0, 4
     la $a0, newline
     syscall
-    li $t0, 0
-    sw $t0, t12
-    # LOAD_INDEXED t13, الأسعار[t12]
+    sll $t9, $t1, 3
+    la $t8, الأسعار
+    addu $t9, $t9, $t8
+    lw $t0, 0($t9)
     li $v0, 1
-    lw $a0, t13
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
@@ -2,11 +2,10 @@
 # =============================
 
 .data
-الموظف: .word 0
-الشخص: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
+.align 3
+الموظف: .space 16
+.align 3
+الشخص: .space 16
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -19,17 +18,11 @@ str_3: .asciiz "راتب الموظف: "
 .globl main
 main:
     la $t0, str_0
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, الموظف.الاسم
+    sw $t0, الموظف
     li $t0, 30
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, الموظف.العمر
+    sw $t0, الموظف+4
     li $t0, 5000.0
-    sw $t0, t2
-    lw $t0, t2
-    sw $t0, الموظف.الراتب
+    sw $t0, الموظف+8
     li $v0, 4
     la $a0, str_1
     syscall
@@ -37,7 +30,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الموظف.الاسم
+    lw $a0, الموظف
     syscall
     li $v0, 4
     la $a0, newline
@@ -49,7 +42,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الموظف.العمر
+    lw $a0, الموظف+4
     syscall
     li $v0, 4
     la $a0, newline
@@ -61,7 +54,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, الموظف.الراتب
+    lw $a0, الموظف+8
     syscall
     li $v0, 4
     la $a0, newline
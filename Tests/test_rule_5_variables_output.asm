@@ -2,11 +2,12 @@
 # =============================
 
 .data
-س: .word 0
-ن: .word 0
-ص: .word 0
 علم: .word 0
 نص: .word 0
+.align 3
+ن: .space 8
+ص: .word 0
+س: .word 0
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -19,6 +20,11 @@ str_4: .asciiz "علم = "
 .text
 .globl main
 main:
+    move $t0, $zero
+    move $t1, $zero
+    move $t2, $zero
+    move $t3, $zero
+    move $t4, $zero
     li $v0, 4
     la $a0, str_0
     syscall
@@ -26,7 +32,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, س
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
@@ -38,7 +44,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, ص
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
@@ -50,7 +56,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, ن
+    move $a0, $t3
     syscall
     li $v0, 4
     la $a0, newline
@@ -62,7 +68,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, نص
+    move $a0, $t4
     syscall
     li $v0, 4
     la $a0, newline
@@ -74,7 +80,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, علم
+    move $a0, $t2
     syscall
     li $v0, 4
     la $a0, newline
@@ -2,9 +2,9 @@
 # =============================
 
 .data
-النتيجة: .word 0
-t0: .word 0
-t1: .word 0
+الجمع_النتيجة: .word 0
+الجمع_ب: .word 0
+الجمع_أ: .word 0
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -16,15 +16,18 @@ str_3: .asciiz " = "
 .text
 .globl main
 main:
-    proc_السلام:
     li $v0, 4
     la $a0, str_0
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    # UNKNOWN
-    proc_الجمع:
+    li $t0, 5
+    move $t1, $t0
+    li $t0, 3
+    move $t2, $t0
+    li $t0, 0
+    move $t3, $t0
     li $v0, 4
     la $a0, str_1
     syscall
@@ -32,7 +35,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, أ
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
@@ -44,7 +47,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, ب
+    move $a0, $t2
     syscall
     li $v0, 4
     la $a0, newline
@@ -56,21 +59,10 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, النتيجة
+    move $a0, $t3
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    # UNKNOWN
-    # UNKNOWN
-    li $t0, 5
-    sw $t0, t0
-    lw $t0, t0
-    sw $t0, param_0
-    li $t0, 3
-    sw $t0, t1
-    lw $t0, t1
-    sw $t0, param_1
-    # UNKNOWN
     li $v0, 10
     syscall
@@ -3,11 +3,8 @@
 
 .data
 النتيجة: .word 0
-س: .word 0
 ص: .word 0
-t0: .word 0
-t1: .word 0
-t2: .word 0
+س: .word 0
 newline: .asciiz "\n"
 int_format: .asciiz "%d"
 str_format: .asciiz "%s"
@@ -18,6 +15,8 @@ str_2: .asciiz "النتيجة: "
 .text
 .globl main
 main:
+    move $t0, $zero
+    move $t1, $zero
     li $v0, 4
     la $a0, str_0
     syscall
@@ -25,7 +24,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, س
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline
@@ -37,21 +36,15 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, ص
+    move $a0, $t1
     syscall
     li $v0, 4
     la $a0, newline
     syscall
-    lw $t0, س
-    sw $t0, t0
-    lw $t0, ص
-    sw $t0, t1
-    lw $t1, t0
-    lw $t2, t1
-    add $t0, $t1, $t2
-    sw $t0, t2
-    lw $t0, t2
-    sw $t0, النتيجة
+    move $t2, $t0
+    move $t0, $t1
+    add $t1, $t2, $t0
+    move $t0, $t1
     li $v0, 4
     la $a0, str_2
     syscall
@@ -59,7 +52,7 @@ main:
     la $a0, newline
     syscall
     li $v0, 1
-    lw $a0, النتيجة
+    move $a0, $t0
     syscall
     li $v0, 4
     la $a0, newline